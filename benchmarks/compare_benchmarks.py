@@ -0,0 +1,116 @@
+# Compares two NVBench JSON outputs (e.g. operators_bench --json current.json)
+# against each other: a stored baseline and a current run.
+# Benchmark states are matched by benchmark name and axis values, and the mean
+# cold GPU time of each state is compared. A state regresses when it is slower
+# than the baseline by more than the threshold AND by more than the measured
+# noise (relative standard deviation) of both runs.
+# Exits with status 1 if any state regressed, so it can gate an upgrade.
+#
+# Usage:
+#   python3 compare_benchmarks.py baseline.json current.json [--threshold 0.05]
+#                                 [--benchmark advance] [--all]
+import argparse
+import json
+import sys
+
+TIME = "nv/cold/time/gpu/mean"
+NOISE = "nv/cold/time/gpu/stdev/relative"
+
+
+def summary_value(state, tag):
+    for summary in state.get("summaries") or []:
+        if summary["tag"] == tag:
+            for data in summary["data"]:
+                if data["name"] == "value":
+                    return float(data["value"])
+    return None
+
+
+def load_states(filename):
+    with open(filename) as f:
+        content = json.load(f)
+
+    states = {}
+    for benchmark in content["benchmarks"]:
+        for state in benchmark["states"]:
+            if state.get("is_skipped"):
+                continue
+            axes = tuple(
+                (axis["name"], str(axis["value"]))
+                for axis in state.get("axis_values") or []
+            )
+            time = summary_value(state, TIME)
+            if time is None:
+                continue
+            noise = summary_value(state, NOISE) or 0.0
+            states[(benchmark["name"], axes)] = (time, noise)
+    return states
+
+
+def format_state(key):
+    name, axes = key
+    return name + " " + " ".join(a + "=" + v for a, v in axes)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare NVBench JSON outputs against a baseline."
+    )
+    parser.add_argument("baseline", help="Baseline NVBench JSON")
+    parser.add_argument("current", help="Current NVBench JSON")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="Relative slowdown that counts as a regression (default = 0.05)",
+    )
+    parser.add_argument(
+        "--benchmark", default=None, help="Only compare this benchmark"
+    )
+    parser.add_argument(
+        "--all", action="store_true", help="Print every state, not only changes"
+    )
+    args = parser.parse_args()
+
+    baseline = load_states(args.baseline)
+    current = load_states(args.current)
+
+    regressions = 0
+    improvements = 0
+    for key in sorted(set(baseline) & set(current)):
+        if args.benchmark is not None and key[0] != args.benchmark:
+            continue
+        (base_time, base_noise) = baseline[key]
+        (time, noise) = current[key]
+        change = (time - base_time) / base_time
+        tolerance = max(args.threshold, base_noise + noise)
+
+        if change > tolerance:
+            status = "SLOWER"
+            regressions += 1
+        elif change < -tolerance:
+            status = "FASTER"
+            improvements += 1
+        else:
+            status = "SAME"
+
+        if args.all or status != "SAME":
+            print(
+                "%-6s %+7.2f%%  %10.3f us -> %10.3f us  %s"
+                % (status, 100 * change, 1e6 * base_time, 1e6 * time,
+                   format_state(key))
+            )
+
+    missing = sorted(set(baseline) - set(current))
+    for key in missing:
+        print("MISSING %s" % format_state(key))
+
+    print(
+        "%d regressions, %d improvements, %d states missing from the current "
+        "run" % (regressions, improvements, len(missing))
+    )
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,170 @@
+/**
+ * @file generators.hxx
+ * @brief Synthetic graph families (R-MAT, uniform random and 2D grid) for the
+ * operator benchmarks.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/error.hxx>
+#include <gunrock/formats/formats.hxx>
+
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace generators {
+using namespace gunrock;
+using namespace memory;
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+using coo_t = format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+/**
+ * @brief Fills `coo` with the given (undirected) edges, in both directions,
+ * with random weights in [1, 64).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void symmetrize(coo_t<vertex_t, edge_t, weight_t>& coo,
+                vertex_t n,
+                std::vector<std::pair<vertex_t, vertex_t>> const& edges,
+                std::mt19937& engine) {
+  std::uniform_real_distribution<weight_t> random_weight(1, 64);
+
+  coo.number_of_rows = n;
+  coo.number_of_columns = n;
+  coo.number_of_nonzeros = 2 * edges.size();
+  coo.row_indices.resize(coo.number_of_nonzeros);
+  coo.column_indices.resize(coo.number_of_nonzeros);
+  coo.nonzero_values.resize(coo.number_of_nonzeros);
+
+  for (std::size_t i = 0; i < edges.size(); ++i) {
+    auto [u, v] = edges[i];
+    weight_t w = random_weight(engine);
+    coo.row_indices[2 * i] = u;
+    coo.column_indices[2 * i] = v;
+    coo.nonzero_values[2 * i] = w;
+    coo.row_indices[2 * i + 1] = v;
+    coo.column_indices[2 * i + 1] = u;
+    coo.nonzero_values[2 * i + 1] = w;
+  }
+}
+
+/**
+ * @brief R-MAT graph (Chakrabarti et al.) with `2^scale` vertices and
+ * `edge_factor * 2^scale` undirected edges, using the Graph500 probabilities.
+ * Heavily skewed degree distribution.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+coo_t<vertex_t, edge_t, weight_t> rmat(int scale,
+                                       int edge_factor,
+                                       unsigned int seed = 0) {
+  constexpr double a = 0.57, b = 0.19, c = 0.19;
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<double> random(0, 1);
+
+  vertex_t n = vertex_t(1) << scale;
+  std::vector<std::pair<vertex_t, vertex_t>> edges(std::size_t(edge_factor) *
+                                                   n);
+  for (auto& edge : edges) {
+    vertex_t u = 0, v = 0;
+    for (int bit = 0; bit < scale; ++bit) {
+      double r = random(engine);
+      bool right = (r >= a && r < a + b) || (r >= a + b + c);
+      bool down = (r >= a + b);
+      u |= vertex_t(down) << bit;
+      v |= vertex_t(right) << bit;
+    }
+    edge = {u, v};
+  }
+
+  coo_t<vertex_t, edge_t, weight_t> coo;
+  symmetrize(coo, n, edges, engine);
+  return coo;
+}
+
+/**
+ * @brief Uniform random (Erdos-Renyi-like) graph with `2^scale` vertices and
+ * `edge_factor * 2^scale` undirected edges. Narrow degree distribution.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+coo_t<vertex_t, edge_t, weight_t> uniform(int scale,
+                                          int edge_factor,
+                                          unsigned int seed = 0) {
+  std::mt19937 engine(seed);
+  vertex_t n = vertex_t(1) << scale;
+  std::uniform_int_distribution<vertex_t> random_vertex(0, n - 1);
+
+  std::vector<std::pair<vertex_t, vertex_t>> edges(std::size_t(edge_factor) *
+                                                   n);
+  for (auto& edge : edges)
+    edge = {random_vertex(engine), random_vertex(engine)};
+
+  coo_t<vertex_t, edge_t, weight_t> coo;
+  symmetrize(coo, n, edges, engine);
+  return coo;
+}
+
+/**
+ * @brief 2D grid (4-point stencil) with `2^scale` vertices. Every vertex has
+ * at most 4 neighbors and the diameter is large.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+coo_t<vertex_t, edge_t, weight_t> grid(int scale, unsigned int seed = 0) {
+  std::mt19937 engine(seed);
+  vertex_t rows = vertex_t(1) << (scale / 2);
+  vertex_t columns = vertex_t(1) << (scale - scale / 2);
+
+  std::vector<std::pair<vertex_t, vertex_t>> edges;
+  edges.reserve(2 * std::size_t(rows) * columns);
+  for (vertex_t i = 0; i < rows; ++i)
+    for (vertex_t j = 0; j < columns; ++j) {
+      vertex_t v = i * columns + j;
+      if (j + 1 < columns)
+        edges.push_back({v, v + 1});
+      if (i + 1 < rows)
+        edges.push_back({v, v + columns});
+    }
+
+  coo_t<vertex_t, edge_t, weight_t> coo;
+  symmetrize(coo, rows * columns, edges, engine);
+  return coo;
+}
+
+/**
+ * @brief Generates (once per process, then cached) the graph of the given
+ * family: "rmat", "uniform" or "grid".
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+coo_t<vertex_t, edge_t, weight_t> const& generate(std::string const& family,
+                                                  int scale,
+                                                  int edge_factor) {
+  static std::map<std::tuple<std::string, int, int>,
+                  coo_t<vertex_t, edge_t, weight_t>>
+      cache;
+
+  auto key = std::make_tuple(family, scale, edge_factor);
+  auto it = cache.find(key);
+  if (it != cache.end())
+    return it->second;
+
+  if (family == "rmat")
+    cache[key] = rmat<vertex_t, edge_t, weight_t>(scale, edge_factor);
+  else if (family == "uniform")
+    cache[key] = uniform<vertex_t, edge_t, weight_t>(scale, edge_factor);
+  else if (family == "grid")
+    cache[key] = grid<vertex_t, edge_t, weight_t>(scale);
+  else
+    error::throw_if_exception(cudaErrorUnknown,
+                              "Unknown graph family: " + family);
+  return cache[key];
+}
+
+}  // namespace generators
@@ -0,0 +1,397 @@
+/**
+ * @file operators_bench.cu
+ * @brief Operator-level microbenchmarks: every advance load-balancing
+ * technique, every filter and uniquify algorithm, and neighborreduce (and
+ * its row kernels, per nonzero value type), swept over synthetic graph
+ * families and frontier densities.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @par Usage
+ * Axes can be narrowed (or widened) with NVBench's `-a`, for example
+ * `operators_bench -b advance -a Graph=rmat -a Scale=[16,20] --json out.json`,
+ * and two JSON outputs compared with `compare_benchmarks.py`.
+ */
+
+#include <gunrock/error.hxx>
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/cuda/cuda.hxx>
+#include <gunrock/framework/frontier/frontier.hxx>
+#include <gunrock/framework/frontier/near_far_frontier.hxx>
+#include <gunrock/framework/operators/operators.hxx>
+
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cuda_fp16.h>
+#include <cuda_bf16.h>
+
+#include <nvbench/nvbench.cuh>
+
+#include "generators.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using csr_t = format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+using frontier_t = frontier::frontier_t<vertex_t, edge_t>;
+
+NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
+    operators::load_balance_t,
+    [](operators::load_balance_t lb) {
+      return std::string(operators::load_balance_name(lb));
+    },
+    [](operators::load_balance_t) { return std::string{}; })
+
+NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
+    operators::filter_algorithm_t,
+    [](operators::filter_algorithm_t algorithm) {
+      constexpr const char* names[] = {"remove", "predicated", "compact",
+                                       "bypass"};
+      return std::string(names[algorithm]);
+    },
+    [](operators::filter_algorithm_t) { return std::string{}; })
+
+NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
+    operators::uniquify_algorithm_t,
+    [](operators::uniquify_algorithm_t algorithm) {
+      constexpr const char* names[] = {"unique", "unique_copy", "bitmap",
+                                       "cull"};
+      return std::string(names[algorithm]);
+    },
+    [](operators::uniquify_algorithm_t) { return std::string{}; })
+
+NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
+    operators::neighborreduce::kernel_t,
+    [](operators::neighborreduce::kernel_t kernel) {
+      constexpr const char* names[] = {"automatic", "csr_vector",
+                                       "csr_adaptive", "merge_path"};
+      return std::string(names[int(kernel)]);
+    },
+    [](operators::neighborreduce::kernel_t) { return std::string{}; })
+
+NVBENCH_DECLARE_TYPE_STRINGS(__half, "fp16", "__half");
+NVBENCH_DECLARE_TYPE_STRINGS(__nv_bfloat16, "bf16", "__nv_bfloat16");
+
+// Bucketing is benchmarked on its own, it needs a near/far frontier.
+using load_balance_list =
+    nvbench::enum_type_list<operators::load_balance_t,
+                            operators::load_balance_t::thread_mapped,
+                            operators::load_balance_t::warp_mapped,
+                            operators::load_balance_t::block_mapped,
+                            operators::load_balance_t::merge_path,
+                            operators::load_balance_t::merge_path_v2,
+                            operators::load_balance_t::work_stealing,
+                            operators::load_balance_t::adaptive>;
+
+using filter_list =
+    nvbench::enum_type_list<operators::filter_algorithm_t,
+                            operators::filter_algorithm_t::remove,
+                            operators::filter_algorithm_t::predicated,
+                            operators::filter_algorithm_t::compact,
+                            operators::filter_algorithm_t::bypass>;
+
+using uniquify_list =
+    nvbench::enum_type_list<operators::uniquify_algorithm_t,
+                            operators::uniquify_algorithm_t::unique,
+                            operators::uniquify_algorithm_t::unique_copy,
+                            operators::uniquify_algorithm_t::bitmap,
+                            operators::uniquify_algorithm_t::cull>;
+
+/**
+ * @brief Device CSR of the graph selected by the `Graph`, `Scale` and
+ * `EdgeFactor` axes of the state.
+ */
+csr_t get_csr(nvbench::state& state) {
+  auto const& coo = generators::generate<vertex_t, edge_t, weight_t>(
+      state.get_string("Graph"), state.get_int64("Scale"),
+      state.get_int64("EdgeFactor"));
+  csr_t csr;
+  csr.from_coo(coo);
+  return csr;
+}
+
+/**
+ * @brief Context on the stream NVBench times (`launch.get_stream()`), such
+ * that the operators' kernels, which run on the context's stream, are the ones
+ * measured.
+ */
+gcuda::multi_context_t make_context(nvbench::state& state) {
+  return gcuda::multi_context_t(0, state.get_cuda_stream().get_stream());
+}
+
+/**
+ * @brief Fills `f` with a pseudo-random `density` fraction of the vertices
+ * (selected by hashing the vertex id, so the frontier is the same for every
+ * algorithm).
+ */
+void sample_frontier(frontier_t& f, vertex_t n, double density) {
+  auto threshold = static_cast<unsigned int>(density * 4294967295.0);
+  auto is_sampled = [=] __device__(vertex_t const& v) -> bool {
+    unsigned int h = v;
+    h ^= h >> 16;
+    h *= 0x7feb352d;
+    h ^= h >> 15;
+    h *= 0x846ca68b;
+    h ^= h >> 16;
+    return h <= threshold;
+  };
+
+  f.reserve(n);
+  auto end = thrust::copy_if(
+      thrust::device, thrust::counting_iterator<vertex_t>(0),
+      thrust::counting_iterator<vertex_t>(n), f.data(), is_sampled);
+  f.set_number_of_elements(end - f.data());
+}
+
+/**
+ * @brief The neighbors (with duplicates) of the sampled frontier: the
+ * frontier a filter or uniquify sees right after an advance.
+ */
+template <typename graph_t>
+void advanced_frontier(graph_t& G,
+                       frontier_t& f,
+                       double density,
+                       gcuda::multi_context_t& context) {
+  frontier_t input(0, 1.0f, context.get_context(0)->stream());
+  thrust::device_vector<edge_t> segments;
+  sample_frontier(input, G.get_number_of_vertices(), density);
+
+  auto keep = [] __device__(vertex_t const& source, vertex_t const& neighbor,
+                            edge_t const& edge, weight_t const& weight)
+      -> bool { return true; };
+  operators::advance::execute<operators::load_balance_t::block_mapped>(
+      G, keep, &input, &f, segments, context);
+}
+
+template <operators::load_balance_t lb>
+void advance_bench(nvbench::state& state,
+                   nvbench::type_list<nvbench::enum_type<lb>>) {
+  auto csr = get_csr(state);
+  auto G = graph::build<memory_space_t::device>({}, csr);
+  auto context = make_context(state);
+  auto stream = context.get_context(0)->stream();
+
+  frontier_t input(0, 1.0f, stream), output(0, 1.0f, stream);
+  thrust::device_vector<edge_t> segments;
+  sample_frontier(input, G.get_number_of_vertices(),
+                  state.get_float64("Density"));
+
+  auto keep = [] __device__(vertex_t const& source, vertex_t const& neighbor,
+                            edge_t const& edge, weight_t const& weight)
+      -> bool { return true; };
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    operators::advance::execute<lb>(G, keep, &input, &output, segments,
+                                    context);
+  });
+}
+
+void bucketing_bench(nvbench::state& state) {
+  auto csr = get_csr(state);
+  auto G = graph::build<memory_space_t::device>({}, csr);
+  auto context = make_context(state);
+  auto stream = context.get_context(0)->stream();
+
+  frontier_t input(0, 1.0f, stream), output(0, 1.0f, stream);
+  frontier::near_far_frontier_t<vertex_t, edge_t, weight_t> buckets(8,
+                                                                    stream);
+  sample_frontier(input, G.get_number_of_vertices(),
+                  state.get_float64("Density"));
+
+  auto keep = [] __device__(vertex_t const& source, vertex_t const& neighbor,
+                            edge_t const& edge, weight_t const& weight)
+      -> bool { return true; };
+  auto priority = [] __device__(vertex_t const& v) -> weight_t {
+    return weight_t(v % 64);
+  };
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               buckets.reset(8);
+               timer.start();
+               operators::advance::bucketing::execute<
+                   operators::advance_direction_t::forward,
+                   operators::advance_io_type_t::vertices,
+                   operators::advance_io_type_t::vertices>(
+                   G, keep, priority, &input, &output, buckets,
+                   *(context.get_context(0)));
+               timer.stop();
+             });
+}
+
+template <operators::filter_algorithm_t algorithm>
+void filter_bench(nvbench::state& state,
+                  nvbench::type_list<nvbench::enum_type<algorithm>>) {
+  auto csr = get_csr(state);
+  auto G = graph::build<memory_space_t::device>({}, csr);
+  auto context = make_context(state);
+  auto stream = context.get_context(0)->stream();
+
+  frontier_t advanced(0, 1.0f, stream), input(0, 1.0f, stream),
+      output(0, 1.0f, stream);
+  advanced_frontier(G, advanced, state.get_float64("Density"), context);
+  auto size = advanced.get_number_of_elements();
+
+  auto is_odd = [] __device__(vertex_t const& v) -> bool { return v & 1; };
+
+  state.add_element_count(size, "Elements");
+  // Some algorithms filter in place, start every run from the same frontier.
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               input.reserve(size);
+               input.set_number_of_elements(size);
+               thrust::copy(context.get_context(0)->execution_policy(),
+                            advanced.begin(), advanced.end(), input.begin());
+               timer.start();
+               operators::filter::execute<algorithm>(G, is_odd, &input,
+                                                     &output, context);
+               timer.stop();
+             });
+}
+
+template <operators::uniquify_algorithm_t algorithm>
+void uniquify_bench(nvbench::state& state,
+                    nvbench::type_list<nvbench::enum_type<algorithm>>) {
+  auto csr = get_csr(state);
+  auto G = graph::build<memory_space_t::device>({}, csr);
+  auto context = make_context(state);
+  auto stream = context.get_context(0)->stream();
+
+  frontier_t advanced(0, 1.0f, stream), input(0, 1.0f, stream),
+      output(0, 1.0f, stream);
+  advanced_frontier(G, advanced, state.get_float64("Density"), context);
+  auto size = advanced.get_number_of_elements();
+
+  state.add_element_count(size, "Elements");
+  // Sorting algorithms sort the input, start every run from the same frontier.
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               input.reserve(size);
+               input.set_number_of_elements(size);
+               thrust::copy(context.get_context(0)->execution_policy(),
+                            advanced.begin(), advanced.end(), input.begin());
+               timer.start();
+               operators::uniquify::execute<algorithm>(&input, &output,
+                                                       context);
+               timer.stop();
+             });
+}
+
+void neighborreduce_bench(nvbench::state& state) {
+  auto csr = get_csr(state);
+  auto G = graph::build<memory_space_t::device>({}, csr);
+  auto context = make_context(state);
+
+  vertex_t n = G.get_number_of_vertices();
+  thrust::device_vector<weight_t> x(n, 1), y(n);
+  auto d_x = x.data().get();
+
+  auto spmv = [=] __device__(edge_t edge) -> weight_t {
+    return G.get_edge_weight(edge) * d_x[G.get_destination_vertex(edge)];
+  };
+  auto plus = [] __device__(weight_t a, weight_t b) { return a + b; };
+
+  // Neighborreduce does not use the enactor, there is none to pass.
+  void* E = nullptr;
+
+  state.add_element_count(G.get_number_of_edges(), "Edges");
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    operators::neighborreduce::execute(G, E, y.data().get(), spmv, plus,
+                                       weight_t(0), context);
+  });
+}
+
+using row_kernel_list =
+    nvbench::enum_type_list<operators::neighborreduce::kernel_t,
+                            operators::neighborreduce::kernel_t::automatic,
+                            operators::neighborreduce::kernel_t::csr_vector,
+                            operators::neighborreduce::kernel_t::csr_adaptive,
+                            operators::neighborreduce::kernel_t::merge_path>;
+using value_list = nvbench::type_list<float, __half, __nv_bfloat16>;
+
+// Row-wise SpMV, the nonzero values stored as `value_t` (fp32 accumulation).
+template <operators::neighborreduce::kernel_t kernel, typename value_t>
+void row_kernels_bench(
+    nvbench::state& state,
+    nvbench::type_list<nvbench::enum_type<kernel>, value_t>) {
+  auto csr = get_csr(state);
+  auto G = graph::build<memory_space_t::device>({}, csr);
+  auto context = make_context(state);
+
+  vertex_t n = G.get_number_of_vertices();
+  edge_t m = G.get_number_of_edges();
+  thrust::device_vector<weight_t> x(n, 1), y(n);
+  thrust::device_vector<value_t> values(m);
+  thrust::copy(thrust::device, G.get_nonzero_values(),
+               G.get_nonzero_values() + m, values.begin());
+  auto plan = operators::neighborreduce::make_plan<float>(G, context, kernel);
+
+  auto d_x = x.data().get();
+  auto d_y = y.data().get();
+  auto d_values = values.data().get();
+  auto spmv = [=] __device__(edge_t edge) -> float {
+    return float(d_values[edge]) * d_x[G.get_destination_vertex(edge)];
+  };
+  auto plus = [] __device__(float a, float b) { return a + b; };
+  auto store = [=] __device__(vertex_t row, float sum) { d_y[row] = sum; };
+
+  state.add_element_count(m, "Edges");
+  state.add_global_memory_reads<value_t>(m, "Values");
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    operators::neighborreduce::execute(plan, spmv, plus, 0.0f, store,
+                                       context);
+  });
+}
+
+NVBENCH_BENCH_TYPES(advance_bench, NVBENCH_TYPE_AXES(load_balance_list))
+    .set_name("advance")
+    .set_type_axes_names({"LoadBalance"})
+    .add_string_axis("Graph", {"rmat", "uniform", "grid"})
+    .add_int64_axis("Scale", {16, 18})
+    .add_int64_axis("EdgeFactor", {16})
+    .add_float64_axis("Density", {0.01, 0.1, 0.5, 1.0});
+
+NVBENCH_BENCH(bucketing_bench)
+    .set_name("advance_bucketing")
+    .add_string_axis("Graph", {"rmat", "uniform", "grid"})
+    .add_int64_axis("Scale", {16, 18})
+    .add_int64_axis("EdgeFactor", {16})
+    .add_float64_axis("Density", {0.01, 0.1, 0.5, 1.0});
+
+NVBENCH_BENCH_TYPES(filter_bench, NVBENCH_TYPE_AXES(filter_list))
+    .set_name("filter")
+    .set_type_axes_names({"Algorithm"})
+    .add_string_axis("Graph", {"rmat", "uniform", "grid"})
+    .add_int64_axis("Scale", {16, 18})
+    .add_int64_axis("EdgeFactor", {16})
+    .add_float64_axis("Density", {0.01, 0.1, 1.0});
+
+NVBENCH_BENCH_TYPES(uniquify_bench, NVBENCH_TYPE_AXES(uniquify_list))
+    .set_name("uniquify")
+    .set_type_axes_names({"Algorithm"})
+    .add_string_axis("Graph", {"rmat", "uniform", "grid"})
+    .add_int64_axis("Scale", {16, 18})
+    .add_int64_axis("EdgeFactor", {16})
+    .add_float64_axis("Density", {0.01, 0.1, 1.0});
+
+NVBENCH_BENCH(neighborreduce_bench)
+    .set_name("neighborreduce")
+    .add_string_axis("Graph", {"rmat", "uniform", "grid"})
+    .add_int64_axis("Scale", {16, 18})
+    .add_int64_axis("EdgeFactor", {16});
+
+NVBENCH_BENCH_TYPES(row_kernels_bench,
+                    NVBENCH_TYPE_AXES(row_kernel_list, value_list))
+    .set_name("neighborreduce_rows")
+    .set_type_axes_names({"Kernel", "Values"})
+    .add_string_axis("Graph", {"rmat", "uniform", "grid"})
+    .add_int64_axis("Scale", {16, 18})
+    .add_int64_axis("EdgeFactor", {16});
@@ -23,6 +23,9 @@ COORDINATES_FILE="${DATASET_DIR}/geolocation/sample.labels"
 A_MATRIX="${DATASET_DIR}/spgemm/a.mtx"
 B_MATRIX="${DATASET_DIR}/spgemm/b.mtx"
 
+# Stored operator baseline (refresh by copying ${JSON_DIR}/operators.json)
+BASELINE_DIR="../benchmarks/baselines"
+
 make bc_bench
 make bfs_bench
 make color_bench
@@ -36,6 +39,7 @@ make spgemm_bench
 make spmv_bench
 make sssp_bench
 make tc_bench
+make operators_bench
 
 ${BIN_DIR}/bc_bench -m ${MATRIX_FILE}  --json ${JSON_DIR}/bc.json
 ${BIN_DIR}/bfs_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/bfs.json
@@ -50,3 +54,12 @@ ${BIN_DIR}/spgemm_bench -a ${A_MATRIX} -b ${B_MATRIX} --json ${JSON_DIR}/spgemm.
 ${BIN_DIR}/spmv_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/spmv.json
 ${BIN_DIR}/sssp_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/sssp.json
 ${BIN_DIR}/tc_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/tc.json
+
+# Operator microbenchmarks (synthetic graphs), checked against the baseline
+${BIN_DIR}/operators_bench --json ${JSON_DIR}/operators.json
+if [ -f "${BASELINE_DIR}/operators.json" ]; then
+  python3 ../benchmarks/compare_benchmarks.py \
+    "${BASELINE_DIR}/operators.json" "${JSON_DIR}/operators.json"
+else
+  echo "No operator baseline in ${BASELINE_DIR}, skipping comparison."
+fi
@@ -0,0 +1,192 @@
+/**
+ * @file pyessentials.cu
+ * @brief Python bindings of the graph analytics engine (@see
+ * gunrock::service::engine_t), outputs are written in place to device arrays
+ * exported through the CUDA array interface or DLPack.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/service/engine.hxx>
+
+#include <pybind11/pybind11.h>
+#include <dlpack/dlpack.h>
+
+#include <cstdint>
+#include <string>
+
+namespace py = pybind11;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+using engine_t = gunrock::service::engine_t<vertex_t, edge_t, weight_t>;
+
+/**
+ * @brief Expected type of a device array, as a CUDA array interface `typestr`
+ * and a DLPack type code.
+ */
+template <typename type_t>
+struct array_type;
+
+template <>
+struct array_type<int> {
+  static constexpr char const* typestr = "<i4";
+  static constexpr std::uint8_t code = kDLInt;
+};
+
+template <>
+struct array_type<float> {
+  static constexpr char const* typestr = "<f4";
+  static constexpr std::uint8_t code = kDLFloat;
+};
+
+/**
+ * @brief Device pointer of a writable, contiguous, one-dimensional array of
+ * `size` elements of `type_t` (no copy), from its `__cuda_array_interface__`
+ * (CuPy, Numba, PyTorch) or its `__dlpack__` (any DLPack producer) on
+ * `device`. The array must be ready; work producing it on another stream is
+ * not waited for.
+ */
+template <typename type_t>
+type_t* device_pointer(py::object const& array,
+                       std::size_t size,
+                       int device,
+                       char const* name) {
+  std::string what = std::string(name) + ": ";
+
+  if (py::hasattr(array, "__cuda_array_interface__")) {
+    auto interface = array.attr("__cuda_array_interface__").cast<py::dict>();
+    auto data = interface["data"].cast<py::tuple>();
+    auto shape = interface["shape"].cast<py::tuple>();
+    if (data[1].cast<bool>())
+      throw py::value_error(what + "the array is read-only.");
+    if (interface["typestr"].cast<std::string>() !=
+        array_type<type_t>::typestr)
+      throw py::type_error(what + "expected typestr " +
+                           array_type<type_t>::typestr + ".");
+    if (shape.size() != 1 || shape[0].cast<std::size_t>() != size)
+      throw py::value_error(what + "expected " + std::to_string(size) +
+                            " elements.");
+    if (interface.contains("strides") && !interface["strides"].is_none() &&
+        interface["strides"].cast<py::tuple>()[0].cast<std::size_t>() !=
+            sizeof(type_t))
+      throw py::value_error(what + "the array is not contiguous.");
+    return reinterpret_cast<type_t*>(data[0].cast<std::uintptr_t>());
+  }
+
+  if (py::hasattr(array, "__dlpack__")) {
+    // The capsule (hence the tensor) stays alive with `capsule`, it is not
+    // consumed, its destructor releases it.
+    py::capsule capsule = array.attr("__dlpack__")();
+    if (std::string(capsule.name()) != "dltensor")
+      throw py::value_error(what + "invalid DLPack capsule.");
+    auto managed = capsule.get_pointer<DLManagedTensor>();
+    DLTensor const& tensor = managed->dl_tensor;
+    if (tensor.device.device_type != kDLCUDA ||
+        tensor.device.device_id != device)
+      throw py::value_error(what + "the array is not on the graph's device.");
+    if (tensor.dtype.code != array_type<type_t>::code ||
+        tensor.dtype.bits != 8 * sizeof(type_t) || tensor.dtype.lanes != 1)
+      throw py::type_error(what + "expected typestr " +
+                           array_type<type_t>::typestr + ".");
+    if (tensor.ndim != 1 || std::size_t(tensor.shape[0]) != size)
+      throw py::value_error(what + "expected " + std::to_string(size) +
+                            " elements.");
+    if (tensor.strides && tensor.strides[0] != 1)
+      throw py::value_error(what + "the array is not contiguous.");
+    return reinterpret_cast<type_t*>(static_cast<char*>(tensor.data) +
+                                     tensor.byte_offset);
+  }
+
+  throw py::type_error(what + "expected a CUDA array (__cuda_array_interface__ "
+                       "or __dlpack__).");
+}
+
+/**
+ * @brief Engine and the device it was created on.
+ */
+struct graph_t {
+  engine_t engine;
+  int device;
+
+  graph_t(std::string const& filename, int _device)
+      : engine(filename, _device), device(_device) {}
+
+  std::size_t size() const { return engine.get_number_of_vertices(); }
+
+  template <typename type_t>
+  type_t* output(py::object const& array, char const* name) {
+    return device_pointer<type_t>(array, size(), device, name);
+  }
+
+  template <typename type_t>
+  type_t* optional_output(py::object const& array, char const* name) {
+    return array.is_none() ? nullptr : output<type_t>(array, name);
+  }
+};
+
+PYBIND11_MODULE(pyessentials, m) {
+  m.doc() =
+      "Graph analytics on a graph kept in device memory, the results are "
+      "written to device arrays (CuPy, PyTorch, Numba, ...) in place.";
+
+  py::class_<graph_t>(m, "Graph")
+      .def(py::init<std::string const&, int>(), py::arg("filename"),
+           py::arg("device") = 0,
+           "Load a matrix-market (.mtx) or binary CSR (.csr) graph onto the "
+           "device.")
+      .def_property_readonly(
+          "number_of_vertices",
+          [](graph_t& g) { return g.engine.get_number_of_vertices(); })
+      .def_property_readonly(
+          "number_of_edges",
+          [](graph_t& g) { return g.engine.get_number_of_edges(); })
+      .def(
+          "bfs",
+          [](graph_t& g, vertex_t source, py::object distances,
+             py::object predecessors) {
+            auto d = g.output<vertex_t>(distances, "distances");
+            auto p = g.optional_output<vertex_t>(predecessors, "predecessors");
+            py::gil_scoped_release release;
+            return g.engine.bfs(source, d, p);
+          },
+          py::arg("source"), py::arg("distances"),
+          py::arg("predecessors") = py::none(),
+          "Breadth-first search, returns the elapsed time (ms).")
+      .def(
+          "sssp",
+          [](graph_t& g, vertex_t source, py::object distances,
+             py::object predecessors, weight_t delta) {
+            auto d = g.output<weight_t>(distances, "distances");
+            auto p = g.optional_output<vertex_t>(predecessors, "predecessors");
+            py::gil_scoped_release release;
+            return g.engine.sssp(source, d, p, delta);
+          },
+          py::arg("source"), py::arg("distances"),
+          py::arg("predecessors") = py::none(), py::arg("delta") = 0,
+          "Single-source shortest path (delta-stepping if delta > 0), "
+          "returns the elapsed time (ms).")
+      .def(
+          "pr",
+          [](graph_t& g, py::object p, weight_t alpha, weight_t tol) {
+            auto d = g.output<weight_t>(p, "p");
+            py::gil_scoped_release release;
+            return g.engine.pr(d, alpha, tol);
+          },
+          py::arg("p"), py::arg("alpha") = 0.85f, py::arg("tol") = 1e-6f,
+          "PageRank, returns the elapsed time (ms).")
+      .def(
+          "ppr",
+          [](graph_t& g, vertex_t seed, py::object p, weight_t alpha,
+             weight_t epsilon) {
+            auto d = g.output<weight_t>(p, "p");
+            py::gil_scoped_release release;
+            return g.engine.ppr(seed, d, alpha, epsilon);
+          },
+          py::arg("seed"), py::arg("p"), py::arg("alpha") = 0.15f,
+          py::arg("epsilon") = 1e-6f,
+          "Personalized PageRank, returns the elapsed time (ms).");
+}
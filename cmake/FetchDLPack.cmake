@@ -0,0 +1,21 @@
+include(FetchContent)
+set(FETCHCONTENT_QUIET ON)
+
+message(STATUS "Cloning External Project: DLPack")
+get_filename_component(FC_BASE "${PROJECT_SOURCE_DIR}/externals"
+                REALPATH BASE_DIR "${CMAKE_BINARY_DIR}")
+set(FETCHCONTENT_BASE_DIR ${FC_BASE})
+
+FetchContent_Declare(
+    dlpack
+    GIT_REPOSITORY https://github.com/dmlc/dlpack.git
+    GIT_TAG        v0.8
+)
+
+FetchContent_GetProperties(dlpack)
+if(NOT dlpack_POPULATED)
+  FetchContent_Populate(
+    dlpack
+  )
+endif()
+set(DLPACK_INCLUDE_DIR "${dlpack_SOURCE_DIR}/include")
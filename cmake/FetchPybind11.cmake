@@ -0,0 +1,23 @@
+include(FetchContent)
+set(FETCHCONTENT_QUIET ON)
+
+message(STATUS "Cloning External Project: pybind11")
+get_filename_component(FC_BASE "${PROJECT_SOURCE_DIR}/externals"
+                REALPATH BASE_DIR "${CMAKE_BINARY_DIR}")
+set(FETCHCONTENT_BASE_DIR ${FC_BASE})
+
+FetchContent_Declare(
+    pybind11
+    GIT_REPOSITORY https://github.com/pybind/pybind11.git
+    GIT_TAG        v2.11.1
+)
+
+FetchContent_GetProperties(pybind11)
+if(NOT pybind11_POPULATED)
+  FetchContent_Populate(
+    pybind11
+  )
+endif()
+
+# Add subdirectory ::pybind11 (pybind11_add_module)
+add_subdirectory(${pybind11_SOURCE_DIR} ${pybind11_BINARY_DIR})
@@ -42,6 +42,23 @@ void test_bc(int num_arguments, char** argument_array) {
   size_t n_edges = G.get_number_of_edges();
   thrust::device_vector<weight_t> bc_values(n_vertices);
 
+  // --
+  // Approximate (sampled sources) run
+
+  if (params.samples > 0 || params.epsilon > 0) {
+    gunrock::bc::approximate::sampling_t sampling;
+    sampling.number_of_samples = params.samples;
+    if (params.epsilon > 0)
+      sampling.epsilon = params.epsilon;
+
+    float elapsed = gunrock::bc::approximate::run(G, bc_values.data().get(),
+                                                  sampling);
+
+    print::head(bc_values, 40, "GPU approximate bc values");
+    std::cout << "GPU Elapsed Time : " << elapsed << " (ms)" << std::endl;
+    return;
+  }
+
   // Parse sources
   std::vector<int> source_vect;
   gunrock::io::cli::parse_source_string(params.source_string, &source_vect,
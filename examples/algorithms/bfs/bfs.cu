@@ -1,4 +1,5 @@
 #include <gunrock/algorithms/bfs.hxx>
+#include <gunrock/graph/reorder.hxx>
 #include <gunrock/util/performance.hxx>
 #include <gunrock/io/parameters.hxx>
 #include <gunrock/framework/benchmark.hxx>
@@ -18,6 +19,8 @@ void test_bfs(int num_arguments, char** argument_array) {
 
   using csr_t =
       format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+  using managed_csr_t =
+      format::csr_t<memory_space_t::managed, vertex_t, edge_t, weight_t>;
 
   // --
   // IO
@@ -29,23 +32,52 @@ void test_bfs(int num_arguments, char** argument_array) {
   auto [properties, coo] = mm.load(params.filename);
 
   csr_t csr;
-
-  if (params.binary) {
+  managed_csr_t managed_csr;
+
+  if (params.managed) {
+    // The graph stays in (host-backed) managed memory, its edges are paged
+    // onto the GPU following the frontier, @see streaming::prefetcher_t.
+    error::throw_if_exception(params.reorder != "",
+                              "--reorder is not supported with --managed.");
+    if (params.binary)
+      managed_csr.read_binary(params.filename);
+    else
+      managed_csr.from_coo(coo);
+  } else if (params.binary) {
     csr.read_binary(params.filename);
   } else {
     csr.from_coo(coo);
   }
 
+  // --
+  // Reorder (the results are mapped back to the original ids)
+
+  csr_t reordered;
+  graph::reorder::permutation_t<vertex_t> permutation;
+  if (params.reorder != "") {
+    auto order = (params.reorder == "rcm") ? graph::reorder::rcm
+                 : (params.reorder == "community")
+                     ? graph::reorder::community
+                     : graph::reorder::degree;
+    permutation = graph::reorder::get_permutation(csr, order);
+    reordered = graph::reorder::permute(csr, permutation);
+  }
+
   // --
   // Build graph
 
-  auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto G = graph::build<memory_space_t::device>(
+      properties, (params.reorder != "") ? reordered : csr);
+  auto G_managed =
+      graph::build<memory_space_t::managed>(properties, managed_csr);
 
   // --
   // Params and memory allocation
 
-  size_t n_vertices = G.get_number_of_vertices();
-  size_t n_edges = G.get_number_of_edges();
+  size_t n_vertices = params.managed ? G_managed.get_number_of_vertices()
+                                     : G.get_number_of_vertices();
+  size_t n_edges = params.managed ? G_managed.get_number_of_edges()
+                                  : G.get_number_of_edges();
   thrust::device_vector<vertex_t> distances(n_vertices);
   thrust::device_vector<vertex_t> predecessors(n_vertices);
 
@@ -67,8 +99,15 @@ void test_bfs(int num_arguments, char** argument_array) {
   for (int i = 0; i < n_runs; i++) {
     benchmark::INIT_BENCH();
 
-    run_times.push_back(gunrock::bfs::run(
-        G, source_vect[i], distances.data().get(), predecessors.data().get()));
+    vertex_t source = (params.reorder != "")
+                          ? permutation.to_new(source_vect[i])
+                          : source_vect[i];
+    run_times.push_back(
+        params.managed
+            ? gunrock::bfs::run(G_managed, source, distances.data().get(),
+                                predecessors.data().get())
+            : gunrock::bfs::run(G, source, distances.data().get(),
+                                predecessors.data().get()));
 
     benchmark::host_benchmark_t metrics = benchmark::EXTRACT();
     benchmark_metrics[i] = metrics;
@@ -84,6 +123,12 @@ void test_bfs(int num_arguments, char** argument_array) {
         source_vect, tag_vect, num_arguments, argument_array);
   }
 
+  if (params.reorder != "") {
+    thrust::device_vector<vertex_t> reordered_distances = distances;
+    permutation.to_original(reordered_distances.data().get(),
+                            distances.data().get());
+  }
+
   // Print info for last run
   std::cout << "Source : " << source_vect.back() << "\n";
   print::head(distances, 40, "GPU distances");
@@ -98,8 +143,14 @@ void test_bfs(int num_arguments, char** argument_array) {
     thrust::host_vector<vertex_t> h_predecessors(n_vertices);
 
     // Validate with last source in source vector
-    float cpu_elapsed = bfs_cpu::run<csr_t, vertex_t, edge_t>(
-        csr, source_vect.back(), h_distances.data(), h_predecessors.data());
+    float cpu_elapsed =
+        params.managed
+            ? bfs_cpu::run<managed_csr_t, vertex_t, edge_t>(
+                  managed_csr, source_vect.back(), h_distances.data(),
+                  h_predecessors.data())
+            : bfs_cpu::run<csr_t, vertex_t, edge_t>(
+                  csr, source_vect.back(), h_distances.data(),
+                  h_predecessors.data());
 
     int n_errors =
         util::compare(distances.data().get(), h_distances.data(), n_vertices);
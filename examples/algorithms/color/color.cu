@@ -7,8 +7,9 @@ using namespace gunrock;
 using namespace memory;
 
 void test_color(int num_arguments, char** argument_array) {
-  if (num_arguments != 2) {
-    std::cerr << "usage: ./bin/<program-name> filename.mtx" << std::endl;
+  if (num_arguments != 2 && num_arguments != 3) {
+    std::cerr << "usage: ./bin/<program-name> filename.mtx [jpl|speculative]"
+              << std::endl;
     exit(1);
   }
 
@@ -47,7 +48,11 @@ void test_color(int num_arguments, char** argument_array) {
   // --
   // GPU Run
 
-  float gpu_elapsed = gunrock::color::run(G, colors.data().get());
+  auto mode = gunrock::color::mode_t::jpl;
+  if (num_arguments == 3 && std::string(argument_array[2]) == "speculative")
+    mode = gunrock::color::mode_t::speculative;
+
+  float gpu_elapsed = gunrock::color::run(G, colors.data().get(), mode);
 
   // --
   // CPU Run
@@ -6,8 +6,9 @@ using namespace experimental;
 using namespace memory;
 
 void test_async_bfs(int num_arguments, char** argument_array) {
-  if (num_arguments != 2) {
-    std::cerr << "usage: ./bin/<program-name> filename.mtx" << std::endl;
+  if (num_arguments != 2 && num_arguments != 3) {
+    std::cerr << "usage: ./bin/<program-name> filename.mtx [async|bsp]"
+              << std::endl;
     exit(1);
   }
 
@@ -25,6 +26,10 @@ void test_async_bfs(int num_arguments, char** argument_array) {
 
   std::string filename = argument_array[1];
 
+  async::config_t config;
+  if (num_arguments == 3 && std::string(argument_array[2]) == "bsp")
+    config.mode = async::mode_t::bulk_synchronous;
+
   io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
   auto [properties, coo] = mm.load(filename);
 
@@ -49,7 +54,8 @@ void test_async_bfs(int num_arguments, char** argument_array) {
 
   thrust::device_vector<vertex_t> depth(n_vertices);
 
-  float gpu_elapsed = async::bfs::run(G, single_source, depth.data().get());
+  float gpu_elapsed =
+      async::bfs::run(G, single_source, depth.data().get(), config);
   cudaDeviceSynchronize();
 
   // --
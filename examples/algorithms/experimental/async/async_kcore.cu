@@ -0,0 +1,82 @@
+#include <gunrock/algorithms/experimental/async/kcore.hxx>
+#include "../../kcore/kcore_cpu.hxx"
+
+using namespace gunrock;
+using namespace experimental;
+using namespace memory;
+
+void test_async_kcore(int num_arguments, char** argument_array) {
+  if (num_arguments != 2 && num_arguments != 3) {
+    std::cerr << "usage: ./bin/<program-name> filename.mtx [async|bsp]"
+              << std::endl;
+    exit(1);
+  }
+
+  // --
+  // Define types
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using csr_t =
+      format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+
+  // --
+  // IO
+
+  std::string filename = argument_array[1];
+
+  async::config_t config;
+  if (num_arguments == 3 && std::string(argument_array[2]) == "bsp")
+    config.mode = async::mode_t::bulk_synchronous;
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  csr_t csr;
+
+  csr.from_coo(coo);
+
+  // --
+  // Build graph
+
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  // --
+  // Params and memory allocation
+
+  vertex_t n_vertices = G.get_number_of_vertices();
+
+  // --
+  // GPU Run
+
+  thrust::device_vector<int> k_cores(n_vertices);
+
+  float gpu_elapsed = async::kcore::run(G, k_cores.data().get(), config);
+  cudaDeviceSynchronize();
+
+  // --
+  // CPU Run
+
+  thrust::host_vector<int> h_k_cores(n_vertices);
+
+  float cpu_elapsed =
+      kcore_cpu::run<csr_t, vertex_t, edge_t, weight_t>(csr, h_k_cores.data());
+
+  int n_errors =
+      util::compare(k_cores.data().get(), h_k_cores.data(), n_vertices);
+
+  // --
+  // Log + Validate
+  print::head(k_cores, 40, "GPU k-core values");
+  print::head(h_k_cores, 40, "CPU k-core values");
+
+  std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
+  std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
+  std::cout << "Number of errors : " << n_errors << std::endl;
+}
+
+int main(int argc, char** argv) {
+  test_async_kcore(argc, argv);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+#include <gunrock/algorithms/experimental/async/sssp.hxx>
+#include "../../sssp/sssp_cpu.hxx"
+
+using namespace gunrock;
+using namespace experimental;
+using namespace memory;
+
+void test_async_sssp(int num_arguments, char** argument_array) {
+  if (num_arguments != 2 && num_arguments != 3) {
+    std::cerr << "usage: ./bin/<program-name> filename.mtx [async|bsp]"
+              << std::endl;
+    exit(1);
+  }
+
+  // --
+  // Define types
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using csr_t =
+      format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+
+  // --
+  // IO
+
+  std::string filename = argument_array[1];
+
+  async::config_t config;
+  if (num_arguments == 3 && std::string(argument_array[2]) == "bsp")
+    config.mode = async::mode_t::bulk_synchronous;
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  csr_t csr;
+
+  csr.from_coo(coo);
+
+  // --
+  // Build graph
+
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  // --
+  // Params and memory allocation
+
+  vertex_t n_vertices = G.get_number_of_vertices();
+  vertex_t single_source = 0;
+  std::cout << "Single Source = " << single_source << std::endl;
+
+  // --
+  // GPU Run
+
+  thrust::device_vector<weight_t> distances(n_vertices);
+
+  float gpu_elapsed =
+      async::sssp::run(G, single_source, distances.data().get(), config);
+  cudaDeviceSynchronize();
+
+  // --
+  // CPU Run
+
+  thrust::host_vector<weight_t> h_distances(n_vertices);
+  thrust::host_vector<vertex_t> h_predecessors(n_vertices);
+
+  float cpu_elapsed = sssp_cpu::run<csr_t, vertex_t, edge_t, weight_t>(
+      csr, single_source, h_distances.data(), h_predecessors.data());
+
+  int n_errors =
+      util::compare(distances.data().get(), h_distances.data(), n_vertices);
+
+  // --
+  // Log + Validate
+  print::head(distances, 40, "GPU distances");
+  print::head(h_distances, 40, "CPU distances");
+
+  std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
+  std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
+  std::cout << "Number of errors : " << n_errors << std::endl;
+}
+
+int main(int argc, char** argv) {
+  test_async_sssp(argc, argv);
+  return EXIT_SUCCESS;
+}
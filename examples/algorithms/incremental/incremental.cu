@@ -0,0 +1,165 @@
+#include <gunrock/algorithms/sssp.hxx>
+#include <gunrock/algorithms/incremental/sssp.hxx>
+#include <gunrock/algorithms/incremental/pr.hxx>
+#include <gunrock/io/parameters.hxx>
+
+#include <random>
+
+#include "../sssp/sssp_cpu.hxx"  // Reference implementation
+
+using namespace gunrock;
+using namespace memory;
+
+void test_incremental(int num_arguments, char** argument_array) {
+  // --
+  // Define types
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  using csr_t =
+      format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+  using dynamic_csr_t = format::
+      dynamic_csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+  using edge_batch_t = format::edge_batch_t<vertex_t, weight_t>;
+
+  // --
+  // IO
+
+  gunrock::io::cli::parameters_t params(num_arguments, argument_array,
+                                        "Single Source Shortest Path");
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(params.filename);
+
+  csr_t csr;
+
+  if (params.binary) {
+    csr.read_binary(params.filename);
+  } else {
+    csr.from_coo(coo);
+  }
+
+  // --
+  // Build graph
+
+  dynamic_csr_t dynamic_csr;
+  dynamic_csr.from_csr(csr);
+  auto G = graph::build<memory_space_t::device>(properties, dynamic_csr);
+
+  // --
+  // Params and memory allocation
+
+  size_t n_vertices = G.get_number_of_vertices();
+  size_t batch_size = std::max<size_t>(1, csr.number_of_nonzeros / 1000);
+
+  std::vector<int> source_vect;
+  gunrock::io::cli::parse_source_string(params.source_string, &source_vect,
+                                        n_vertices, 1);
+  vertex_t single_source = source_vect.back();
+
+  thrust::device_vector<weight_t> distances(n_vertices);
+  thrust::device_vector<vertex_t> predecessors(n_vertices);
+  thrust::device_vector<weight_t> p(n_vertices);
+
+  // --
+  // Initial (static) run
+
+  gunrock::sssp::run(G, single_source, distances.data().get(),
+                     predecessors.data().get());
+
+  incremental::pr::state_t<weight_t> state(0.85, 1e-6);
+  incremental::pr::run(G, state, p.data().get());
+
+  // --
+  // Update rounds: delete and insert `batch_size` random edges (in both
+  // directions for symmetric graphs), then repair the results.
+
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<vertex_t> random_vertex(0, n_vertices - 1);
+  std::uniform_real_distribution<weight_t> random_weight(1, 64);
+
+  float sssp_elapsed = 0;
+  float pr_elapsed = 0;
+  for (int round = 0; round < params.num_runs; ++round) {
+    thrust::host_vector<edge_t> h_offsets = dynamic_csr.row_offsets;
+    thrust::host_vector<edge_t> h_sizes = dynamic_csr.row_sizes;
+    thrust::host_vector<vertex_t> h_indices = dynamic_csr.column_indices;
+
+    thrust::host_vector<vertex_t> tails, heads;
+    thrust::host_vector<weight_t> lengths;
+    auto add = [&](vertex_t u, vertex_t v, weight_t w) {
+      tails.push_back(u);
+      heads.push_back(v);
+      lengths.push_back(w);
+      if (properties.symmetric) {
+        tails.push_back(v);
+        heads.push_back(u);
+        lengths.push_back(w);
+      }
+    };
+
+    for (size_t i = 0; i < batch_size; ++i) {
+      vertex_t u = random_vertex(engine);
+      if (h_sizes[u] > 0)
+        add(u, h_indices[h_offsets[u] + (engine() % h_sizes[u])], 0);
+    }
+    edge_batch_t to_delete(tails.size());
+    to_delete.sources = tails;
+    to_delete.destinations = heads;
+
+    tails.clear();
+    heads.clear();
+    lengths.clear();
+    for (size_t i = 0; i < batch_size; ++i)
+      add(random_vertex(engine), random_vertex(engine), random_weight(engine));
+    edge_batch_t to_insert(tails.size());
+    to_insert.sources = tails;
+    to_insert.destinations = heads;
+    to_insert.values = lengths;
+
+    auto deleted = dynamic_csr.delete_edges(to_delete);
+    auto inserted = dynamic_csr.insert_edges(to_insert);
+    G = graph::build<memory_space_t::device>(properties, dynamic_csr);
+
+    sssp_elapsed += incremental::sssp::run(
+        G, single_source, inserted, deleted, distances.data().get());
+    pr_elapsed +=
+        incremental::pr::run(G, inserted, deleted, state, p.data().get());
+
+    std::cout << "Round " << round << " : -" << deleted.size() << " +"
+              << inserted.size() << " edges" << std::endl;
+  }
+
+  print::head(distances, 40, "GPU distances");
+  print::head(p, 40, "GPU ranks");
+  std::cout << "Incremental SSSP Elapsed Time : " << sssp_elapsed << " (ms)"
+            << std::endl;
+  std::cout << "Incremental PR Elapsed Time : " << pr_elapsed << " (ms)"
+            << std::endl;
+
+  // --
+  // CPU Run
+
+  if (params.validate) {
+    auto updated = dynamic_csr.to_csr();
+    thrust::host_vector<weight_t> h_distances(n_vertices);
+    thrust::host_vector<vertex_t> h_predecessors(n_vertices);
+
+    float cpu_elapsed = sssp_cpu::run<csr_t, vertex_t, edge_t, weight_t>(
+        updated, single_source, h_distances.data(), h_predecessors.data());
+
+    int n_errors =
+        util::compare(distances.data().get(), h_distances.data(), n_vertices);
+
+    print::head(h_distances, 40, "CPU Distances");
+
+    std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
+    std::cout << "Number of errors : " << n_errors << std::endl;
+  }
+}
+
+int main(int argc, char** argv) {
+  test_incremental(argc, argv);
+}
@@ -0,0 +1,93 @@
+#include <gunrock/algorithms/msbfs.hxx>
+#include <gunrock/io/parameters.hxx>
+
+#include "../bfs/bfs_cpu.hxx"  // Reference implementation
+
+using namespace gunrock;
+using namespace memory;
+
+void test_msbfs(int num_arguments, char** argument_array) {
+  // --
+  // Define types
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  using csr_t =
+      format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+
+  // --
+  // IO
+
+  gunrock::io::cli::parameters_t params(num_arguments, argument_array,
+                                        "Multi-Source Breadth First Search");
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(params.filename);
+
+  csr_t csr;
+
+  if (params.binary) {
+    csr.read_binary(params.filename);
+  } else {
+    csr.from_coo(coo);
+  }
+
+  // --
+  // Build graph
+
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  // --
+  // Params and memory allocation
+
+  size_t n_vertices = G.get_number_of_vertices();
+
+  // Parse sources, all of them are searched at once.
+  std::vector<int> source_vect;
+  gunrock::io::cli::parse_source_string(params.source_string, &source_vect,
+                                        n_vertices, params.num_runs);
+
+  size_t n_sources = source_vect.size();
+  thrust::device_vector<vertex_t> distances(n_sources * n_vertices);
+
+  // --
+  // Run problem
+
+  float gpu_elapsed =
+      gunrock::msbfs::run(G, source_vect, distances.data().get());
+
+  // Print info for last source
+  std::cout << "Sources : " << n_sources << "\n";
+  std::cout << "Source : " << source_vect.back() << "\n";
+  thrust::device_vector<vertex_t> last_distances(
+      distances.end() - n_vertices, distances.end());
+  print::head(last_distances, 40, "GPU distances");
+  std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
+
+  // --
+  // CPU Run
+
+  if (params.validate) {
+    thrust::host_vector<vertex_t> h_distances(n_vertices);
+    thrust::host_vector<vertex_t> h_predecessors(n_vertices);
+
+    float cpu_elapsed = 0;
+    int n_errors = 0;
+    for (size_t s = 0; s < n_sources; ++s) {
+      cpu_elapsed += bfs_cpu::run<csr_t, vertex_t, edge_t>(
+          csr, source_vect[s], h_distances.data(), h_predecessors.data());
+      n_errors += util::compare(distances.data().get() + s * n_vertices,
+                                h_distances.data(), n_vertices);
+    }
+    print::head(h_distances, 40, "CPU Distances");
+
+    std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
+    std::cout << "Number of errors : " << n_errors << std::endl;
+  }
+}
+
+int main(int argc, char** argv) {
+  test_msbfs(argc, argv);
+}
@@ -1,4 +1,5 @@
 #include <gunrock/algorithms/pr.hxx>
+#include <gunrock/graph/reorder.hxx>
 #include <gunrock/util/performance.hxx>
 #include <gunrock/io/parameters.hxx>
 
@@ -15,6 +16,10 @@ void test_pr(int num_arguments, char** argument_array) {
 
   using csr_t =
       format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+  using csc_t =
+      format::csc_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+  using managed_csr_t =
+      format::csr_t<memory_space_t::managed, vertex_t, edge_t, weight_t>;
 
   // --
   // IO
@@ -26,17 +31,49 @@ void test_pr(int num_arguments, char** argument_array) {
   auto [properties, coo] = mm.load(params.filename);
 
   csr_t csr;
-
-  if (params.binary) {
+  managed_csr_t managed_csr;
+
+  if (params.managed) {
+    // The graph stays in (host-backed) managed memory, the edges that are not
+    // resident are read over the interconnect, @see streaming::prefetcher_t.
+    error::throw_if_exception(
+        (params.reorder != "") || (params.mode == "pull"),
+        "--reorder and --mode pull are not supported with --managed.");
+    if (params.binary)
+      managed_csr.read_binary(params.filename);
+    else
+      managed_csr.from_coo(coo);
+  } else if (params.binary) {
     csr.read_binary(params.filename);
   } else {
     csr.from_coo(coo);
   }
 
+  // --
+  // Reorder (the ranks are mapped back to the original ids)
+
+  graph::reorder::permutation_t<vertex_t> permutation;
+  if (params.reorder != "") {
+    auto order = (params.reorder == "rcm") ? graph::reorder::rcm
+                 : (params.reorder == "community")
+                     ? graph::reorder::community
+                     : graph::reorder::degree;
+    permutation = graph::reorder::get_permutation(csr, order);
+    csr = graph::reorder::permute(csr, permutation);
+  }
+
   // --
   // Build graph
 
   auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto G_managed =
+      graph::build<memory_space_t::managed>(properties, managed_csr);
+
+  // The pull scheme gathers over the incoming edges (CSC).
+  csc_t csc;
+  if (params.mode == "pull")
+    csc.from_csr(csr);
+  auto G_pull = graph::build<memory_space_t::device>(properties, csc, csr);
 
   // --
   // Params and memory allocation
@@ -46,8 +83,10 @@ void test_pr(int num_arguments, char** argument_array) {
   weight_t alpha = 0.85;
   weight_t tol = 1e-6;
 
-  size_t n_vertices = G.get_number_of_vertices();
-  size_t n_edges = G.get_number_of_edges();
+  size_t n_vertices = params.managed ? G_managed.get_number_of_vertices()
+                                     : G.get_number_of_vertices();
+  size_t n_edges = params.managed ? G_managed.get_number_of_edges()
+                                  : G.get_number_of_edges();
   thrust::device_vector<weight_t> p(n_vertices);
 
   // Parse tags
@@ -64,7 +103,19 @@ void test_pr(int num_arguments, char** argument_array) {
   for (int i = 0; i < params.num_runs; i++) {
     benchmark::INIT_BENCH();
 
-    run_times.push_back(gunrock::pr::run(G, alpha, tol, p.data().get()));
+    if (params.managed && params.mode == "push")
+      run_times.push_back(
+          gunrock::pr::run_push(G_managed, alpha, tol, p.data().get()));
+    else if (params.managed)
+      run_times.push_back(
+          gunrock::pr::run(G_managed, alpha, tol, p.data().get()));
+    else if (params.mode == "push")
+      run_times.push_back(gunrock::pr::run_push(G, alpha, tol, p.data().get()));
+    else if (params.mode == "pull")
+      run_times.push_back(
+          gunrock::pr::run_pull(G_pull, alpha, tol, p.data().get()));
+    else
+      run_times.push_back(gunrock::pr::run(G, alpha, tol, p.data().get()));
 
     benchmark::host_benchmark_t metrics = benchmark::EXTRACT();
     benchmark_metrics[i] = metrics;
@@ -72,6 +123,11 @@ void test_pr(int num_arguments, char** argument_array) {
     benchmark::DESTROY_BENCH();
   }
 
+  if (params.reorder != "") {
+    thrust::device_vector<weight_t> reordered_p = p;
+    permutation.to_original(reordered_p.data().get(), p.data().get());
+  }
+
   // Placeholder since PR does not use sources
   std::vector<int> src_placeholder;
 
@@ -6,8 +6,9 @@ using namespace gunrock;
 using namespace memory;
 
 void test_spmv(int num_arguments, char** argument_array) {
-  if (num_arguments != 2) {
-    std::cerr << "usage: ./bin/<program-name> filename.mtx" << std::endl;
+  if (num_arguments != 2 && num_arguments != 3) {
+    std::cerr << "usage: ./bin/<program-name> filename.mtx [fp32|fp16|bf16]"
+              << std::endl;
     exit(1);
   }
 
@@ -29,6 +30,8 @@ void test_spmv(int num_arguments, char** argument_array) {
 
   // Filename to be read
   std::string filename = argument_array[1];
+  // Without a precision, the (atomic, push-based) advance SpMV is run.
+  std::string precision = (num_arguments == 3) ? argument_array[2] : "";
 
   // Load the matrix-market dataset into csr format.
   // See `format` to see other supported formats.
@@ -55,7 +58,17 @@ void test_spmv(int num_arguments, char** argument_array) {
 
   // --
   // GPU Run
-  float gpu_elapsed = gunrock::spmv::run(G, x.data().get(), y.data().get());
+  // Row-wise SpMV with the nonzero values stored in fp16 or bf16 (converted
+  // from the fp32 weights) and accumulated in fp32.
+  float gpu_elapsed =
+      (precision == "fp16")
+          ? gunrock::spmv::run_pull<__half>(G, x.data().get(), y.data().get())
+      : (precision == "bf16")
+          ? gunrock::spmv::run_pull<__nv_bfloat16>(G, x.data().get(),
+                                                   y.data().get())
+      : (precision == "fp32")
+          ? gunrock::spmv::run_pull(G, x.data().get(), y.data().get())
+          : gunrock::spmv::run(G, x.data().get(), y.data().get());
 
   // --
   // CPU Run
@@ -69,7 +82,11 @@ void test_spmv(int num_arguments, char** argument_array) {
       y.data().get(), y_h.data(), n_vertices,
       [=](const weight_t a, const weight_t b) {
         // TODO: needs better accuracy.
-        return std::abs(a - b) > 1e-2;
+        // Reduced-precision values round to about 3 significant digits.
+        weight_t tolerance =
+            (precision == "fp16" || precision == "bf16") ? 1e-2 * std::abs(b)
+                                                         : 0;
+        return std::abs(a - b) > std::max<weight_t>(1e-2, tolerance);
       },
       true);
 
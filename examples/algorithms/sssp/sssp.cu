@@ -80,8 +80,10 @@ void test_sssp(int num_arguments, char** argument_array) {
   for (int i = 0; i < n_runs; i++) {
     benchmark::INIT_BENCH();
 
+    gunrock::sssp::param_t<vertex_t, weight_t> param(source_vect[i],
+                                                     params.delta);
     run_times.push_back(gunrock::sssp::run(
-        G, source_vect[i], distances.data().get(), predecessors.data().get()));
+        G, param, distances.data().get(), predecessors.data().get()));
 
     benchmark::host_benchmark_t metrics = benchmark::EXTRACT();
     benchmark_metrics[i] = metrics;
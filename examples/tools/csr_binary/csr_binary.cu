@@ -4,8 +4,9 @@ using namespace gunrock;
 using namespace memory;
 
 void mtx2bin(int num_arguments, char** argument_array) {
-  if (num_arguments != 2) {
-    std::cerr << "usage: " << argument_array[0] << " <inpath>" << std::endl;
+  if (num_arguments != 2 && num_arguments != 3) {
+    std::cerr << "usage: " << argument_array[0] << " <inpath> [outpath]"
+              << std::endl;
     exit(1);
   }
 
@@ -20,13 +21,12 @@ void mtx2bin(int num_arguments, char** argument_array) {
   // IO
 
   std::string inpath = argument_array[1];
-  std::string outpath = inpath + ".csr";
+  std::string outpath =
+      (num_arguments == 3) ? argument_array[2] : inpath + ".csr";
 
+  // Parsed and converted in parallel, on the host.
   io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(inpath);
-
-  format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr;
-  csr.from_coo(coo);
+  auto [properties, csr] = mm.load_csr(inpath);
 
   std::cout << "csr.number_of_rows     = " << csr.number_of_rows << std::endl;
   std::cout << "csr.number_of_columns  = " << csr.number_of_columns
@@ -36,8 +36,14 @@ void mtx2bin(int num_arguments, char** argument_array) {
   std::cout << "writing to             = " << outpath << std::endl;
 
   csr.write_binary(outpath);
+
+  // Read the container back (mapped, zero-copy) and check its checksums.
+  format::mapped_csr_t<vertex_t, edge_t, weight_t> mapped(outpath);
+  mapped.verify();
+  std::cout << "binary CSR version     = " << mapped.header.version
+            << std::endl;
 }
 
 int main(int argc, char** argv) {
   mtx2bin(argc, argv);
-}
\ No newline at end of file
+}
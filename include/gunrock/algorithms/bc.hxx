@@ -9,6 +9,12 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
 #include <gunrock/algorithms/algorithms.hxx>
 
 namespace gunrock {
@@ -43,9 +49,10 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<vertex_t> labels;
-  thrust::device_vector<weight_t> deltas;
-  thrust::device_vector<weight_t> sigmas;
+  gcuda::stream_t stream = this->get_single_context()->stream();
+  pooled_vector_t<vertex_t> labels{make_pooled_vector<vertex_t>(stream)};
+  pooled_vector_t<weight_t> deltas{make_pooled_vector<weight_t>(stream)};
+  pooled_vector_t<weight_t> sigmas{make_pooled_vector<weight_t>(stream)};
 
   void init() override {
     auto g = this->get_graph();
@@ -78,7 +85,8 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 };
 
-template <typename problem_t>
+template <typename problem_t,
+          operators::load_balance_t lb = operators::load_balance_t::merge_path>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context,
@@ -88,7 +96,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
-  using frontier_t = typename enactor_t<problem_t>::frontier_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
 
   bool forward = true;
   bool backward = true;
@@ -98,6 +106,14 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   void prepare_frontier(frontier_t* f,
                         gcuda::multi_context_t& context) override {
     auto P = this->get_problem();
+
+    // Restart both passes, such that the enactor can be enacted again.
+    forward = true;
+    backward = true;
+    depth = 0;
+    search_depth = 1;
+
+    this->frontiers[0].set_number_of_elements(0);
     this->frontiers[0].push_back(P->param.single_source);
   }
 
@@ -133,16 +149,26 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
         return old_label == -1;
       };
 
+      // Direction-optimized (push-pull) search requires a CSC view. Pulling a
+      // vertex must visit all of its parents to accumulate sigmas, so do not
+      // exit early.
+      constexpr auto direction =
+          operators::advance::pull::has_csc_view_v<decltype(G)>
+              ? operators::advance_direction_t::optimized
+              : operators::advance_direction_t::forward;
+      operators::advance::direction_optimized_params_t push_pull;
+      push_pull.early_exit = false;
+
       while (true) {
         auto in_frontier = &(this->frontiers[this->depth]);
         auto out_frontier = &(this->frontiers[this->depth + 1]);
 
-        operators::advance::execute<operators::load_balance_t::merge_path,
-                                    operators::advance_direction_t::forward,
+        operators::advance::execute<lb,
+                                    direction,
                                     operators::advance_io_type_t::vertices,
                                     operators::advance_io_type_t::vertices>(
             G, forward_op, in_frontier, out_frontier, E->scanned_work_domain,
-            context);
+            context, push_pull);
 
         this->depth++;
         this->search_depth++;
@@ -175,7 +201,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
         auto in_frontier = &(this->frontiers[this->depth]);
         auto out_frontier = &(this->frontiers[this->depth + 1]);
 
-        operators::advance::execute<operators::load_balance_t::merge_path,
+        operators::advance::execute<lb,
                                     operators::advance_direction_t::forward,
                                     operators::advance_io_type_t::vertices,
                                     operators::advance_io_type_t::none>(
@@ -219,7 +245,8 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   }
 };  // struct enactor_t
 
-template <typename graph_t>
+template <operators::load_balance_t lb = operators::load_balance_t::merge_path,
+          typename graph_t>
 float run(graph_t& G,
           typename graph_t::vertex_type single_source,
           typename graph_t::weight_type* bc_values,
@@ -240,7 +267,7 @@ float run(graph_t& G,
 
   // <boiler-plate>
   using problem_type = problem_t<graph_t, param_type, result_type>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   problem_type problem(G, param, result, context);
   problem.init();
@@ -256,8 +283,60 @@ float run(graph_t& G,
   // </boiler-plate>
 }
 
-template <typename graph_t>
-float run(graph_t& G, typename graph_t::weight_type* bc_values) {
+/**
+ * @brief Batch worker (@see operators::batch::pool_t) that accumulates the
+ * dependencies of one source per job into the shared `bc_values`, reusing its
+ * problem and enactor (and their frontiers) across jobs.
+ */
+template <operators::load_balance_t lb, typename graph_t>
+struct batch_worker_t {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = param_t<vertex_t>;
+  using result_type = result_t<weight_t>;
+  using problem_type = problem_t<graph_t, param_type, result_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
+
+  param_type param;
+  result_type result;
+  problem_type problem;
+  enactor_type enactor;
+
+  batch_worker_t(std::shared_ptr<gcuda::multi_context_t> context,
+                 graph_t& G,
+                 weight_t* bc_values)
+      : param(0),
+        result(bc_values),
+        problem(G, param, result, context),
+        enactor(&problem, context, properties()) {
+    problem.init();
+  }
+
+  float operator()(std::size_t job) {
+    problem.param.single_source = (vertex_t)job;
+    problem.reset();
+    return enactor.enact();
+  }
+
+  static enactor_properties_t properties() {
+    // Disable internal-frontiers management:
+    enactor_properties_t props;
+    props.number_of_frontier_buffers = 1000;  // XXX: hack!
+    props.self_manage_frontiers = true;
+    return props;
+  }
+};
+
+/**
+ * @brief Betweenness centrality from all the vertices, one source per job on
+ * a pool of `number_of_streams` workers.
+ */
+template <operators::load_balance_t lb = operators::load_balance_t::merge_path,
+          typename graph_t>
+float run(graph_t& G,
+          typename graph_t::weight_type* bc_values,
+          std::size_t number_of_streams = 4) {
   using vertex_t = typename graph_t::vertex_type;
   using weight_t = typename graph_t::weight_type;
 
@@ -265,16 +344,416 @@ float run(graph_t& G, typename graph_t::weight_type* bc_values) {
   auto d_bc_values = thrust::device_pointer_cast(bc_values);
   thrust::fill_n(thrust::device, d_bc_values, n_vertices, (weight_t)0);
 
-  auto f = [&](std::size_t job_idx) -> float {
-    return bc::run(G, (vertex_t)job_idx, bc_values);
-  };
-
   std::size_t n_jobs = n_vertices;
-  thrust::host_vector<float> total_elapsed(1);
-  operators::batch::execute(f, n_jobs, total_elapsed.data());
+  auto stats = operators::batch::execute<batch_worker_t<lb, graph_t>>(
+      n_jobs, number_of_streams, G, bc_values);
+
+  return stats.total_elapsed;
+}
+
+/**
+ * @brief Approximate betweenness centrality from a sample of sources, which
+ * are processed in batches sharing one (level-synchronous) traversal.
+ *
+ * @par Overview
+ * The labels, sigmas and deltas of a batch of `k` sources are laid out per
+ * vertex (`v * k + s`), such that an edge is read once per batch and its
+ * `k` searches update adjacent entries; the dependencies the `k` sources add
+ * to a vertex through an edge are summed before a single atomic update of
+ * its centrality. A frontier holds the vertices at the current depth of at
+ * least one search.
+ */
+namespace approximate {
+
+/**
+ * @brief How many sources to sample, and how.
+ */
+struct sampling_t {
+  /*!
+   * Number of sources, 0 to size the sample from `epsilon` and `delta`
+   * (@see sample_size()).
+   */
+  std::size_t number_of_samples = 0;
+  double epsilon = 0.05;
+  double delta = 0.1;
+
+  /*!
+   * Sources per traversal (the labels, sigmas and deltas take
+   * `batch_size * 12` bytes per vertex, for 4-byte labels and weights).
+   */
+  std::size_t batch_size = 32;
+  unsigned int seed = 0;
+};
+
+/**
+ * @brief Number of samples after which the (normalized) centralities are
+ * within `epsilon` with probability `1 - delta`, given the vertex diameter
+ * (vertices of the longest shortest path), by the VC-dimension bound of
+ * Riondato and Kornaropoulos ("Fast approximation of betweenness centrality
+ * through sampling", WSDM'14).
+ */
+inline std::size_t sample_size(double epsilon,
+                               double delta,
+                               std::size_t vertex_diameter) {
+  constexpr double c = 0.5;
+  double vc_dimension =
+      (vertex_diameter > 3)
+          ? std::floor(std::log2(double(vertex_diameter - 2))) + 1
+          : 1;
+  double bound = vc_dimension + std::log(1 / delta);
+  return std::size_t(std::ceil(c / (epsilon * epsilon) * bound));
+}
+
+template <typename vertex_t>
+struct param_t {
+  vertex_t const* sources;  // Host array, the batch.
+  std::size_t number_of_sources;
+  std::size_t batch_size;  // Stride of the per vertex layouts.
+  param_t(vertex_t const* _sources,
+          std::size_t _number_of_sources,
+          std::size_t _batch_size)
+      : sources(_sources),
+        number_of_sources(_number_of_sources),
+        batch_size(_batch_size) {}
+};
+
+template <typename graph_t, typename param_type, typename result_type>
+struct problem_t : gunrock::problem_t<graph_t> {
+  param_type param;
+  result_type result;
+
+  problem_t(graph_t& G,
+            param_type& _param,
+            result_type& _result,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::problem_t<graph_t>(G, _context),
+        param(_param),
+        result(_result) {}
+
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  /*!
+   * Stream the buffers below are used on (and allocated and freed on).
+   */
+  gcuda::stream_t stream = this->get_single_context()->stream();
+
+  /*!
+   * Per vertex, `batch_size` labels (depths), sigmas and deltas.
+   */
+  pooled_vector_t<vertex_t> labels{make_pooled_vector<vertex_t>(stream)};
+  pooled_vector_t<weight_t> sigmas{make_pooled_vector<weight_t>(stream)};
+  pooled_vector_t<weight_t> deltas{make_pooled_vector<weight_t>(stream)};
+
+  /*!
+   * Deepest frontier a vertex was added to (at most once per depth).
+   */
+  pooled_vector_t<vertex_t> levels{make_pooled_vector<vertex_t>(stream)};
+
+  /*!
+   * Distinct sources of the batch (initial frontier).
+   */
+  std::vector<vertex_t> frontier_sources;
+
+  void init() override {
+    auto n_vertices = this->get_graph().get_number_of_vertices();
+    labels.resize(n_vertices * param.batch_size);
+    sigmas.resize(n_vertices * param.batch_size);
+    deltas.resize(n_vertices * param.batch_size);
+    levels.resize(n_vertices);
+  }
+
+  void reset() override {
+    error::throw_if_exception(param.number_of_sources > param.batch_size,
+                              "Too many sources for the batch.");
+
+    auto policy = this->context->get_context(0)->execution_policy();
+
+    thrust::fill(policy, labels.begin(), labels.end(), -1);
+    thrust::fill(policy, sigmas.begin(), sigmas.end(), 0);
+    thrust::fill(policy, deltas.begin(), deltas.end(), 0);
+    thrust::fill(policy, levels.begin(), levels.end(), -1);
+
+    frontier_sources.assign(param.sources,
+                            param.sources + param.number_of_sources);
+    std::sort(frontier_sources.begin(), frontier_sources.end());
+    frontier_sources.erase(
+        std::unique(frontier_sources.begin(), frontier_sources.end()),
+        frontier_sources.end());
+
+    auto d_sources = make_pooled_vector<vertex_t>(
+        stream, param.sources, param.sources + param.number_of_sources);
+    auto sources = d_sources.data().get();
+    auto d_labels = labels.data().get();
+    auto d_sigmas = sigmas.data().get();
+    auto d_levels = levels.data().get();
+    auto k = param.batch_size;
+    thrust::for_each_n(policy, thrust::counting_iterator<std::size_t>(0),
+                       param.number_of_sources,
+                       [=] __device__(std::size_t const& s) {
+                         vertex_t source = sources[s];
+                         d_labels[source * k + s] = 0;
+                         d_sigmas[source * k + s] = 1;
+                         d_levels[source] = 0;
+                       });
+  }
+};
+
+template <typename problem_t,
+          operators::load_balance_t lb = operators::load_balance_t::merge_path>
+struct enactor_t : gunrock::enactor_t<problem_t> {
+  enactor_t(problem_t* _problem,
+            std::shared_ptr<gcuda::multi_context_t> _context,
+            enactor_properties_t _properties)
+      : gunrock::enactor_t<problem_t>(_problem, _context, _properties) {}
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
+
+  bool forward = true;
+  bool backward = true;
+  std::size_t depth = 0;
+  std::size_t search_depth = 1;
+
+  /*!
+   * Largest depth reached by a search of the last batch.
+   */
+  std::size_t max_depth = 0;
+
+  void prepare_frontier(frontier_t* f,
+                        gcuda::multi_context_t& context) override {
+    auto P = this->get_problem();
+
+    forward = true;
+    backward = true;
+    depth = 0;
+    search_depth = 1;
+    max_depth = 0;
+
+    this->frontiers[0].set_number_of_elements(0);
+    for (auto const& source : P->frontier_sources)
+      this->frontiers[0].push_back(source);
+  }
+
+  void loop(gcuda::multi_context_t& context) override {
+    auto E = this->get_enactor();
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+
+    auto sigmas = P->sigmas.data().get();
+    auto labels = P->labels.data().get();
+    auto deltas = P->deltas.data().get();
+    auto levels = P->levels.data().get();
+    auto bc_values = P->result.bc_values;
+
+    std::size_t k = P->param.batch_size;
+    std::size_t n_sources = P->param.number_of_sources;
+
+    if (forward) {
+      while (true) {
+        vertex_t current = this->depth;
+        auto forward_op = [=] __host__ __device__(
+                              vertex_t const& src, vertex_t const& dst,
+                              edge_t const& edge,
+                              weight_t const& weight) -> bool {
+          bool discovered = false;
+          for (std::size_t s = 0; s < n_sources; ++s) {
+            if (labels[src * k + s] != current)
+              continue;
+            auto old_label =
+                math::atomic::cas(labels + dst * k + s, -1, current + 1);
+            if ((old_label != -1) && (old_label != current + 1))
+              continue;
+            math::atomic::add(sigmas + dst * k + s, sigmas[src * k + s]);
+            discovered |= (old_label == -1);
+          }
+          // The first search to reach `dst` at this depth adds it.
+          return discovered &&
+                 (math::atomic::max(levels + dst, current + 1) < current + 1);
+        };
+
+        auto in_frontier = &(this->frontiers[this->depth]);
+        auto out_frontier = &(this->frontiers[this->depth + 1]);
+
+        operators::advance::execute<lb,
+                                    operators::advance_direction_t::forward,
+                                    operators::advance_io_type_t::vertices,
+                                    operators::advance_io_type_t::vertices>(
+            G, forward_op, in_frontier, out_frontier, E->scanned_work_domain,
+            context);
+
+        this->depth++;
+        this->search_depth++;
+        if (is_forward_converged(context))
+          break;
+      }
+
+    } else {
+      while (true) {
+        vertex_t current = this->depth;
+        auto backward_op = [=] __host__ __device__(
+                               vertex_t const& src, vertex_t const& dst,
+                               edge_t const& edge,
+                               weight_t const& weight) -> bool {
+          // Depth > 0, `src` is not the source of the searches it is at
+          // `current` in.
+          weight_t dependency = 0;
+          for (std::size_t s = 0; s < n_sources; ++s) {
+            if (labels[src * k + s] != current ||
+                labels[dst * k + s] != current + 1)
+              continue;
+            auto update = sigmas[src * k + s] / sigmas[dst * k + s] *
+                          (1 + deltas[dst * k + s]);
+            math::atomic::add(deltas + src * k + s, update);
+            dependency += update;
+          }
+          if (dependency != 0)
+            math::atomic::add(bc_values + src, 0.5f * dependency);
+          return false;
+        };
+
+        auto in_frontier = &(this->frontiers[this->depth]);
+        auto out_frontier = &(this->frontiers[this->depth + 1]);
+
+        operators::advance::execute<lb,
+                                    operators::advance_direction_t::forward,
+                                    operators::advance_io_type_t::vertices,
+                                    operators::advance_io_type_t::none>(
+            G, backward_op, in_frontier, out_frontier, E->scanned_work_domain,
+            context);
+
+        this->depth--;
+        this->search_depth++;
+        if (is_backward_converged(context))
+          break;
+      }
+    }
+  }
+
+  bool is_forward_converged(gcuda::multi_context_t& context) {
+    if (this->frontiers[this->depth].is_empty()) {
+      forward = false;
+      max_depth = this->depth - 1;
+      return true;
+    }
+    return false;
+  }
+
+  bool is_backward_converged(gcuda::multi_context_t& context) {
+    if (depth == 0) {
+      backward = false;
+      return true;
+    }
+    return false;
+  }
+
+  virtual bool is_converged(gcuda::multi_context_t& context) {
+    bool converged = (!forward && !backward) ? true : false;
+    if (converged) {
+      this->get_enactor()->iteration = this->search_depth;
+    }
+    return converged;
+  }
+};  // struct enactor_t
+
+/**
+ * @brief Approximate betweenness centrality of every vertex, from sources
+ * sampled uniformly (without replacement), scaled by `number_of_vertices /
+ * number_of_samples` (to the scale of the exact, all-sources, run).
+ *
+ * When `sampling.number_of_samples` is 0, the sample is sized adaptively:
+ * the first batch bounds the vertex diameter (twice the deepest search plus
+ * one), which sizes the sample with `sample_size()`. The sample covers every
+ * vertex (exact centralities) when it is not smaller than the graph.
+ *
+ * @param G Graph object.
+ * @param bc_values Pointer to the centralities (device), of size number of
+ * vertices.
+ * @param sampling Sample size (or error bound), batch size and seed.
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <operators::load_balance_t lb = operators::load_balance_t::merge_path,
+          typename graph_t>
+float run(graph_t& G,
+          typename graph_t::weight_type* bc_values,
+          sampling_t sampling = sampling_t(),
+          std::shared_ptr<gcuda::multi_context_t> context =
+              std::shared_ptr<gcuda::multi_context_t>(
+                  new gcuda::multi_context_t(0))  // Context
+) {
+  // <user-defined>
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = param_t<vertex_t>;
+  using result_type = bc::result_t<weight_t>;
+
+  std::size_t n_vertices = G.get_number_of_vertices();
+  std::size_t batch_size = std::max<std::size_t>(1, sampling.batch_size);
+
+  std::vector<vertex_t> sources(n_vertices);
+  std::iota(sources.begin(), sources.end(), vertex_t(0));
+  std::mt19937 engine(sampling.seed);
+  std::shuffle(sources.begin(), sources.end(), engine);
 
-  return total_elapsed[0];
+  std::size_t n_samples = sampling.number_of_samples;
+  bool adaptive = (n_samples == 0);
+  if (adaptive)
+    n_samples = batch_size;
+  n_samples = std::min(n_samples, n_vertices);
+
+  param_type param(sources.data(), std::min(batch_size, n_samples),
+                   batch_size);
+  result_type result(bc_values);
+  // </user-defined>
+
+  // <boiler-plate>
+  using problem_type = problem_t<graph_t, param_type, result_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
+
+  auto d_bc_values = thrust::device_pointer_cast(bc_values);
+  thrust::fill_n(thrust::device, d_bc_values, n_vertices, (weight_t)0);
+
+  problem_type problem(G, param, result, context);
+  problem.init();
+
+  // Disable internal-frontiers management:
+  enactor_properties_t props;
+  props.number_of_frontier_buffers = 1000;  // XXX: hack!
+  props.self_manage_frontiers = true;
+
+  enactor_type enactor(&problem, context, props);
+  // </boiler-plate>
+
+  float elapsed = 0;
+  for (std::size_t first = 0; first < n_samples; first += batch_size) {
+    problem.param.sources = sources.data() + first;
+    problem.param.number_of_sources = std::min(batch_size, n_samples - first);
+
+    problem.reset();
+    elapsed += enactor.enact();
+
+    if (adaptive && first == 0) {
+      std::size_t vertex_diameter = 2 * enactor.max_depth + 1;
+      n_samples = std::min(
+          n_vertices,
+          std::max(n_samples, sample_size(sampling.epsilon, sampling.delta,
+                                          vertex_diameter)));
+    }
+  }
+
+  weight_t scale = weight_t(n_vertices) / weight_t(n_samples);
+  thrust::transform(thrust::device, d_bc_values, d_bc_values + n_vertices,
+                    d_bc_values,
+                    [=] __device__(weight_t const& x) { return x * scale; });
+  return elapsed;
 }
 
+}  // namespace approximate
+
 }  // namespace bc
 }  // namespace gunrock
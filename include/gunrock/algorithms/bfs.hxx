@@ -59,16 +59,19 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 };
 
-template <typename problem_t>
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::adaptive>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
-            std::shared_ptr<gcuda::multi_context_t> _context)
-      : gunrock::enactor_t<problem_t>(_problem, _context) {}
+            std::shared_ptr<gcuda::multi_context_t> _context,
+            enactor_properties_t _properties = enactor_properties_t())
+      : gunrock::enactor_t<problem_t>(_problem, _context, _properties) {}
 
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
-  using frontier_t = typename enactor_t<problem_t>::frontier_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
 
   void prepare_frontier(frontier_t* f,
                         gcuda::multi_context_t& context) override {
@@ -121,9 +124,23 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
       return true;
     };
 
+    // When pulling, only the unvisited vertices look for a parent.
+    auto unvisited = [distances] __host__ __device__(
+                         vertex_t const& vertex) -> bool {
+      return distances[vertex] == std::numeric_limits<vertex_t>::max();
+    };
+
+    // Direction-optimized (push-pull) traversal requires a CSC view, if the
+    // graph doesn't have one, only push.
+    constexpr auto direction =
+        operators::advance::pull::has_csc_view_v<decltype(G)>
+            ? operators::advance_direction_t::optimized
+            : operators::advance_direction_t::forward;
+
     // Execute advance operator on the provided lambda
-    operators::advance::execute<operators::load_balance_t::block_mapped>(
-        G, E, search, context);
+    operators::advance::execute<lb, direction>(
+        G, E, search, context, true,
+        operators::advance::direction_optimized_params_t(), unvisited);
 
     // Execute filter operator to remove the invalids.
     // @todo: Add CLI option to enable or disable this.
@@ -133,12 +150,115 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
 };  // struct enactor_t
 
+/**
+ * @brief Multi-GPU Breadth-First Search, every device expands the frontier
+ * vertices it owns (@see gunrock::vertex_partition_t) and the discovered
+ * vertices are exchanged between the iterations, where their owner sets their
+ * distance in its partition of the distances. Push-only.
+ */
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::adaptive>
+struct multi_gpu_enactor_t : gunrock::multi_gpu_enactor_t<problem_t> {
+  using base_t = gunrock::multi_gpu_enactor_t<problem_t>;
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using frontier_t = typename base_t::frontier_t;
+
+  /*!
+   * Distances of the vertices owned by each device.
+   */
+  typename base_t::template partitioned_vector_t<vertex_t> distances;
+
+  multi_gpu_enactor_t(problem_t* _problem,
+                      std::shared_ptr<gcuda::multi_context_t> _context)
+      : base_t(_problem, _context),
+        distances(this->template make_partitioned_vector<vertex_t>(
+            std::numeric_limits<vertex_t>::max())) {}
+
+  void prepare_frontier(int device,
+                        frontier_t* f,
+                        gcuda::multi_context_t& context) override {
+    auto P = this->get_problem();
+    auto source = P->param.single_source;
+    auto policy = context.get_context(0)->execution_policy();
+
+    auto& owned = distances[device];
+    auto begin = this->partition.begin(device);
+    thrust::fill(policy, owned.begin(), owned.end(),
+                 std::numeric_limits<vertex_t>::max());
+    if (this->partition.owner(source) == device) {
+      thrust::fill_n(policy, owned.begin() + (source - begin), 1, 0);
+      f->push_back(source);
+    }
+  }
+
+  void loop(int device, gcuda::multi_context_t& context) override {
+    auto E = this->get_slice(device);
+    auto G = this->get_problem()->get_graph();
+
+    auto part = this->partition;
+    auto begin = part.begin(device);
+    auto owned = distances[device].data().get();
+
+    // Drops the neighbors this device already discovered, the others are
+    // settled by their owner, @see receive().
+    auto search = [=] __host__ __device__(
+                      vertex_t const& source,    // ... source
+                      vertex_t const& neighbor,  // neighbor
+                      edge_t const& edge,        // edge
+                      weight_t const& weight     // weight (tuple).
+                      ) -> bool {
+      return (part.owner(neighbor) != device) ||
+             (owned[neighbor - begin] == std::numeric_limits<vertex_t>::max());
+    };
+
+    operators::advance::execute<lb>(G, E, search, context);
+  }
+
+  void receive(int device, gcuda::multi_context_t& context) override {
+    auto E = this->get_slice(device);
+    auto G = this->get_problem()->get_graph();
+
+    auto begin = this->partition.begin(device);
+    auto owned = distances[device].data().get();
+    auto depth = (vertex_t)(this->iteration + 1);
+
+    // Only the first copy of a vertex discovered at this depth is kept.
+    auto discover = [=] __host__ __device__(vertex_t const& v) -> bool {
+      return math::atomic::min(&owned[v - begin], depth) > depth;
+    };
+    auto keep = [] __host__ __device__(vertex_t const& v) -> bool {
+      return true;
+    };
+
+    operators::filter::execute<operators::filter_algorithm_t::bypass>(
+        G, E, discover, context);
+    operators::filter::execute<operators::filter_algorithm_t::predicated>(
+        G, E, keep, context);
+  }
+
+  void finalize(int device, gcuda::multi_context_t& context) override {
+    this->gather(distances, device, this->get_problem()->result.distances);
+  }
+};  // struct multi_gpu_enactor_t
+
 /**
  * @brief Run Breadth-First Search algorithm on a given graph, G, starting from
  * the source node, single_source. The resulting distances are stored in the
  * distances pointer. All data must be allocated by the user, on the device
  * (GPU) and passed in to this function.
  *
+ * @note If G also contains a CSC view (for example, built using
+ * `graph::build(properties, csc, csr)`), the search is direction-optimized,
+ * and switches between push and pull per iteration.
+ * @note If the context holds more than one device, the search runs on all of
+ * them (push-only, @see multi_gpu_enactor_t). G must then be accessible from
+ * every device, for example, built from a format::striped_csr_t.
+ *
+ * @tparam lb Load-balancing technique of the (push) advance, @see
+ * operators::load_balance_t.
  * @tparam graph_t Graph type.
  * @param G Graph object.
  * @param single_source A vertex in the graph (integral type).
@@ -148,7 +268,9 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
  * @param context Device context.
  * @return float Time taken to run the algorithm.
  */
-template <typename graph_t>
+template <operators::load_balance_t lb =
+              operators::load_balance_t::adaptive,
+          typename graph_t>
 float run(graph_t& G,
           typename graph_t::vertex_type& single_source,  // Parameter
           typename graph_t::vertex_type* distances,      // Output
@@ -165,13 +287,25 @@ float run(graph_t& G,
   result_type result(distances, predecessors);
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   problem_type problem(G, param, result, context);
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, context);
+  if (context->size() > 1) {
+    multi_gpu_enactor_t<problem_type, lb> enactor(&problem, context);
+    return enactor.enact();
+  }
+
+  // A direction-optimized search keeps the frontiers dense enough to be pulled
+  // as bitmaps, which the pull advance reads instead of building its own map.
+  enactor_properties_t props;
+  if constexpr (operators::advance::pull::has_csc_view_v<graph_t>)
+    props.dense_frontier_ratio =
+        1.0f / operators::advance::direction_optimized_params_t().beta;
+
+  enactor_type enactor(&problem, context, props);
   return enactor.enact();
 }
 
@@ -16,8 +16,23 @@
 namespace gunrock {
 namespace color {
 
+/**
+ * @brief Coloring scheme, the frontier is the set of uncolored vertices in
+ * both.
+ */
+enum class mode_t {
+  /// Jones-Plassmann-Luby: per round, the local maxima and minima of random
+  /// priorities (among uncolored neighbors) take the round's two colors.
+  jpl,
+  /// Speculative (Gebremedhin-Manne): every uncolored vertex takes the
+  /// smallest color free among its neighbors in parallel, then the lower
+  /// priority endpoint of every conflicting edge is uncolored again.
+  speculative
+};
+
 struct param_t {
-  // No parameters for this algorithm
+  mode_t mode;
+  param_t(mode_t _mode = mode_t::jpl) : mode(_mode) {}
 };
 
 template <typename vertex_t>
@@ -116,8 +131,9 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
       auto rand_v = randoms[vertex];
 
       // Main loop that goes over all the neighbors and finds the maximum or
-      // minimum random number vertex.
-      for (edge_t e = start_edge; e < start_edge + num_neighbors; ++e) {
+      // minimum random number vertex (until it is neither).
+      for (edge_t e = start_edge;
+           e < start_edge + num_neighbors && (colormax || colormin); ++e) {
         vertex_t u = G.get_destination_vertex(e);
 
         if (gunrock::util::limits::is_valid(colors[u]) &&
@@ -145,16 +161,97 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
       }
     };
 
+    if (P->param.mode == mode_t::speculative) {
+      speculate(context);
+      return;
+    }
+
     // Execute filter operator on the provided lambda.
     operators::filter::execute<operators::filter_algorithm_t::predicated>(
         G, E, color_me_in, context);
   }
 
+  /**
+   * @brief One round of speculative coloring: first-fit colors for the
+   * frontier, then the vertices that lost a conflict are the next frontier.
+   */
+  void speculate(gcuda::multi_context_t& context) {
+    auto E = this->get_enactor();
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+
+    auto colors = P->result.colors;
+    auto randoms = P->randoms.data().get();
+
+    // Smallest color no neighbor holds, looking for it in windows of 64
+    // colors (a bitmask of the ones taken). Neighbors colored concurrently
+    // may be missed, these conflicts are repaired below.
+    auto first_fit = [G, colors] __device__(vertex_t const& vertex) {
+      edge_t start_edge = G.get_starting_edge(vertex);
+      edge_t num_neighbors = G.get_number_of_neighbors(vertex);
+      for (vertex_t base = 0;; base += 64) {
+        unsigned long long taken = 0;
+        for (edge_t e = start_edge; e < start_edge + num_neighbors; ++e) {
+          vertex_t u = G.get_destination_vertex(e);
+          vertex_t c = thread::load(&colors[u]);
+          if (u != vertex && gunrock::util::limits::is_valid(c) &&
+              c >= base && c < base + 64)
+            taken |= 1ull << (c - base);
+        }
+        if (~taken) {
+          colors[vertex] = base + __ffsll(~taken) - 1;
+          return;
+        }
+      }
+    };
+
+    operators::parallel_for::execute<operators::parallel_for_each_t::element>(
+        *(E->get_input_frontier()), first_fit, context);
+
+    // A vertex sharing its color with a higher priority neighbor is
+    // uncolored (kept). Uncoloring in place is safe: a vertex only yields to
+    // a neighbor that is colored when it is read, and a vertex that stays
+    // colored was read as colored by all of its lower priority neighbors.
+    auto resolve = [G, colors, randoms] __host__ __device__(
+                       vertex_t const& vertex) -> bool {
+      edge_t start_edge = G.get_starting_edge(vertex);
+      edge_t num_neighbors = G.get_number_of_neighbors(vertex);
+      vertex_t color = colors[vertex];
+      auto rand_v = randoms[vertex];
+      for (edge_t e = start_edge; e < start_edge + num_neighbors; ++e) {
+        vertex_t u = G.get_destination_vertex(e);
+        if (u == vertex || thread::load(&colors[u]) != color)
+          continue;
+        auto rand_u = randoms[u];
+        if (rand_v < rand_u || (rand_v == rand_u && vertex < u)) {
+          thread::store(&colors[vertex],
+                        gunrock::numeric_limits<vertex_t>::invalid());
+          return true;  // keep (not colored).
+        }
+      }
+      return false;  // remove (colored).
+    };
+
+    operators::filter::execute<operators::filter_algorithm_t::predicated>(
+        G, E, resolve, context);
+  }
+
 };  // struct enactor_t
 
+/**
+ * @brief Color the vertices of G, such that no two neighbors share a color.
+ *
+ * @param G Graph object (undirected).
+ * @param colors Pointer to the colors array (device) of size number of
+ * vertices.
+ * @param mode Coloring scheme, @see mode_t.
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
 template <typename graph_t>
 float run(graph_t& G,
           typename graph_t::vertex_type* colors,  // Output
+          mode_t mode = mode_t::jpl,              // Parameter
           std::shared_ptr<gcuda::multi_context_t> context =
               std::shared_ptr<gcuda::multi_context_t>(
                   new gcuda::multi_context_t(0))  // Context
@@ -164,7 +261,7 @@ float run(graph_t& G,
   using param_type = param_t;
   using result_type = result_t<vertex_t>;
 
-  param_type param;
+  param_type param(mode);
   result_type result(colors);
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
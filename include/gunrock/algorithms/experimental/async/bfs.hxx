@@ -62,13 +62,6 @@ struct problem_t : gunrock::problem_t<graph_t> {
 // --
 // Enactor
 
-// !! This is annoying ... ideally we'd be able to initialize the frontier
-//    w/ a lambda or thrust call.  But not sure how to get that to work.
-template <typename queue_t, typename val_t>
-__global__ void _push_one(queue_t q, val_t val) {
-  q.push(val);
-}
-
 template <typename problem_t>
 struct enactor_t : async::enactor_t<problem_t> {
   using async::enactor_t<problem_t>::enactor_t;
@@ -81,9 +74,6 @@ struct enactor_t : async::enactor_t<problem_t> {
   // !! Breaks w/ standard essentials (mildly...)
   void prepare_frontier(queue_t& q, gcuda::multi_context_t& context) {
     auto P = this->get_problem();
-
-    // !! Queues creates it's own streams.  But I think we should at least
-    //    synchronizing the to the `context` stream?
     _push_one<<<1, 1>>>(q, P->param.single_source);
   }
 
@@ -115,7 +105,8 @@ struct enactor_t : async::enactor_t<problem_t> {
 template <typename graph_t>
 float run(graph_t& G,
           typename graph_t::vertex_type& single_source,  // Parameter
-          typename graph_t::edge_type* depth             // Output
+          typename graph_t::edge_type* depth,            // Output
+          config_t config = config_t()                   // Execution policy
 ) {
   // <user-defined>
   using vertex_t = typename graph_t::vertex_type;
@@ -139,7 +130,7 @@ float run(graph_t& G,
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, multi_context);
+  enactor_type enactor(&problem, multi_context, config);
   return enactor.enact();
   // </boiler-plate>
 }
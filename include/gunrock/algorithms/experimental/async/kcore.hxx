@@ -0,0 +1,145 @@
+/**
+ * @file kcore.hxx
+ * @brief Asynchronous (queue-based) k-core decomposition by h-index
+ * refinement (Montresor et al., "Distributed k-Core Decomposition"): the core
+ * estimate of a vertex starts at its degree and drops to the h-index of its
+ * neighbors' estimates; when it drops, the neighbors are re-queued.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/framework/experimental/async/enactor.hxx>
+
+namespace gunrock {
+namespace experimental {
+namespace async {
+namespace kcore {
+
+template <typename vertex_t>
+struct result_t {
+  int* k_cores;
+  result_t(int* _k_cores) : k_cores(_k_cores) {}
+};
+
+template <typename graph_t, typename result_type>
+struct problem_t : gunrock::problem_t<graph_t> {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  result_type result;
+
+  problem_t(graph_t& G,
+            result_type& _result,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::problem_t<graph_t>(G, _context), result(_result) {}
+
+  void init() override {}
+
+  void reset() override {
+    auto G = this->get_graph();
+    auto n_vertices = G.get_number_of_vertices();
+    auto policy = this->get_single_context()->execution_policy();
+
+    // Core numbers are bounded by the degree.
+    auto get_degree = [=] __device__(vertex_t const& v) -> int {
+      return G.get_number_of_neighbors(v);
+    };
+    thrust::transform(policy, thrust::counting_iterator<vertex_t>(0),
+                      thrust::counting_iterator<vertex_t>(n_vertices),
+                      this->result.k_cores, get_degree);
+  }
+};
+
+template <typename problem_t>
+struct enactor_t : async::enactor_t<problem_t> {
+  using async::enactor_t<problem_t>::enactor_t;
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using queue_t = typename async::enactor_t<problem_t>::queue_t;
+
+  void prepare_frontier(queue_t& q, gcuda::multi_context_t& context) {
+    auto n_vertices = this->get_problem()->get_graph().get_number_of_vertices();
+    _push_all<<<(n_vertices + 255) / 256, 256>>>(q, n_vertices);
+  }
+
+  void loop(gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+    auto q = this->q;
+
+    int* k_cores = P->result.k_cores;
+
+    q.launch_thread([G, k_cores] __device__(vertex_t v, queue_t q) -> void {
+      auto cores = (volatile int*)k_cores;
+      int current = cores[v];
+      if (current == 0)
+        return;
+
+      edge_t start = G.get_starting_edge(v);
+      edge_t degree = G.get_number_of_neighbors(v);
+
+      // Largest h <= current with at least h neighbors whose estimate is at
+      // least h (binary search, the count is non-increasing in h).
+      int low = 0, high = current;
+      while (low < high) {
+        int h = (low + high + 1) / 2;
+        int count = 0;
+        for (edge_t e = start; e < start + degree && count < h; ++e)
+          count += (cores[G.get_destination_vertex(e)] >= h);
+        if (count >= h)
+          low = h;
+        else
+          high = h - 1;
+      }
+
+      if (low < current) {
+        math::atomic::min(k_cores + v, low);
+        for (edge_t e = start; e < start + degree; ++e) {
+          vertex_t neighbor = G.get_destination_vertex(e);
+          if (cores[neighbor] > low)
+            q.push(neighbor);
+        }
+      }
+    });
+  }
+};
+
+template <typename graph_t>
+float run(graph_t& G,
+          int* k_cores,  // Output
+          config_t config = config_t()) {
+  // <user-defined>
+  using vertex_t = typename graph_t::vertex_type;
+  using result_type = result_t<vertex_t>;
+
+  result_type result(k_cores);
+  // </user-defined>
+
+  // <boiler-plate>
+  auto multi_context =
+      std::shared_ptr<gcuda::multi_context_t>(new gcuda::multi_context_t(0));
+
+  using problem_type = problem_t<graph_t, result_type>;
+  using enactor_type = enactor_t<problem_type>;
+
+  problem_type problem(G, result, multi_context);
+  problem.init();
+  problem.reset();
+
+  enactor_type enactor(&problem, multi_context, config);
+  return enactor.enact();
+  // </boiler-plate>
+}
+
+}  // namespace kcore
+}  // namespace async
+}  // namespace experimental
+}  // namespace gunrock
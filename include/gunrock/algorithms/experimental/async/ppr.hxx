@@ -0,0 +1,161 @@
+/**
+ * @file ppr.hxx
+ * @brief Asynchronous (queue-based) personalized PageRank, by residual
+ * pushing (Andersen, Chung and Lang): a vertex is queued when its residual
+ * crosses `epsilon * degree`, and pushes its whole residual when picked up.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/framework/experimental/async/enactor.hxx>
+
+namespace gunrock {
+namespace experimental {
+namespace async {
+namespace ppr {
+
+template <typename vertex_t, typename weight_t>
+struct param_t {
+  vertex_t seed;
+  weight_t alpha;
+  weight_t epsilon;
+  param_t(vertex_t _seed, weight_t _alpha, weight_t _epsilon)
+      : seed(_seed), alpha(_alpha), epsilon(_epsilon) {}
+};
+
+template <typename weight_t>
+struct result_t {
+  weight_t* p;
+  result_t(weight_t* _p) : p(_p) {}
+};
+
+template <typename graph_t, typename param_type, typename result_type>
+struct problem_t : gunrock::problem_t<graph_t> {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  param_type param;
+  result_type result;
+
+  problem_t(graph_t& G,
+            param_type& _param,
+            result_type& _result,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::problem_t<graph_t>(G, _context),
+        param(_param),
+        result(_result) {}
+
+  thrust::device_vector<weight_t> r;
+
+  void init() override {
+    r.resize(this->get_graph().get_number_of_vertices());
+  }
+
+  void reset() override {
+    auto n_vertices = this->get_graph().get_number_of_vertices();
+    auto policy = this->get_single_context()->execution_policy();
+
+    auto d_p = thrust::device_pointer_cast(this->result.p);
+    thrust::fill(policy, d_p, d_p + n_vertices, 0);
+    thrust::fill(policy, r.begin(), r.end(), 0);
+    thrust::fill(policy, r.begin() + param.seed, r.begin() + param.seed + 1, 1);
+  }
+};
+
+template <typename problem_t>
+struct enactor_t : async::enactor_t<problem_t> {
+  using async::enactor_t<problem_t>::enactor_t;
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using queue_t = typename async::enactor_t<problem_t>::queue_t;
+
+  void prepare_frontier(queue_t& q, gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    _push_one<<<1, 1>>>(q, P->param.seed);
+  }
+
+  void loop(gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+    auto q = this->q;
+
+    weight_t* p = P->result.p;
+    weight_t* r = P->r.data().get();
+    weight_t alpha = P->param.alpha;
+    weight_t epsilon = P->param.epsilon;
+
+    // Same (lazy random walk) constants as the synchronous ppr::enactor_t.
+    weight_t _2a1a = (2 * alpha) / (1 + alpha);
+    weight_t _1a1a = (1 - alpha) / (1 + alpha);
+
+    q.launch_thread([=] __device__(vertex_t v, queue_t q) -> void {
+      weight_t residual = math::atomic::exch(r + v, weight_t(0));
+      if (residual == 0)
+        return;  // Already pushed by an earlier copy of `v`.
+
+      math::atomic::add(p + v, _2a1a * residual);
+
+      edge_t degree = G.get_number_of_neighbors(v);
+      if (degree == 0)
+        return;
+
+      weight_t update = _1a1a * residual / (weight_t)degree;
+      edge_t start = G.get_starting_edge(v);
+      for (edge_t e = start; e < start + degree; ++e) {
+        vertex_t neighbor = G.get_destination_vertex(e);
+        weight_t old = math::atomic::add(r + neighbor, update);
+        weight_t threshold =
+            (weight_t)G.get_number_of_neighbors(neighbor) * epsilon;
+        if ((old < threshold) && (old + update >= threshold))
+          q.push(neighbor);
+      }
+    });
+  }
+};
+
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type& seed,
+          typename graph_t::weight_type* p,
+          typename graph_t::weight_type& alpha,
+          typename graph_t::weight_type& epsilon,
+          config_t config = config_t()) {
+  // <user-defined>
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = param_t<vertex_t, weight_t>;
+  using result_type = result_t<weight_t>;
+
+  param_type param(seed, alpha, epsilon);
+  result_type result(p);
+  // </user-defined>
+
+  // <boiler-plate>
+  auto multi_context =
+      std::shared_ptr<gcuda::multi_context_t>(new gcuda::multi_context_t(0));
+
+  using problem_type = problem_t<graph_t, param_type, result_type>;
+  using enactor_type = enactor_t<problem_type>;
+
+  problem_type problem(G, param, result, multi_context);
+  problem.init();
+  problem.reset();
+
+  enactor_type enactor(&problem, multi_context, config);
+  return enactor.enact();
+  // </boiler-plate>
+}
+
+}  // namespace ppr
+}  // namespace async
+}  // namespace experimental
+}  // namespace gunrock
@@ -0,0 +1,137 @@
+/**
+ * @file sssp.hxx
+ * @brief Asynchronous (queue-based) single-source shortest path: a vertex is
+ * re-queued whenever its distance improves, and relaxed as soon as a warp
+ * picks it up (no per-iteration barrier).
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/framework/experimental/async/enactor.hxx>
+
+namespace gunrock {
+namespace experimental {
+namespace async {
+namespace sssp {
+
+template <typename vertex_t>
+struct param_t {
+  vertex_t single_source;
+  param_t(vertex_t _single_source) : single_source(_single_source) {}
+};
+
+template <typename weight_t>
+struct result_t {
+  weight_t* distances;
+  result_t(weight_t* _distances) : distances(_distances) {}
+};
+
+template <typename graph_t, typename param_type, typename result_type>
+struct problem_t : gunrock::problem_t<graph_t> {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  param_type param;
+  result_type result;
+
+  problem_t(graph_t& G,
+            param_type& _param,
+            result_type& _result,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::problem_t<graph_t>(G, _context),
+        param(_param),
+        result(_result) {}
+
+  void init() override {}
+
+  void reset() override {
+    auto n_vertices = this->get_graph().get_number_of_vertices();
+    auto policy = this->get_single_context()->execution_policy();
+
+    auto d_distances = thrust::device_pointer_cast(this->result.distances);
+    thrust::fill_n(policy, d_distances, n_vertices,
+                   std::numeric_limits<weight_t>::max());
+    thrust::fill_n(policy, d_distances + param.single_source, 1, 0);
+  }
+};
+
+template <typename problem_t>
+struct enactor_t : async::enactor_t<problem_t> {
+  using async::enactor_t<problem_t>::enactor_t;
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using queue_t = typename async::enactor_t<problem_t>::queue_t;
+
+  void prepare_frontier(queue_t& q, gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    _push_one<<<1, 1>>>(q, P->param.single_source);
+  }
+
+  void loop(gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+    auto q = this->q;
+
+    weight_t* distances = P->result.distances;
+
+    q.launch_thread([G, distances] __device__(vertex_t v, queue_t q) -> void {
+      weight_t d = ((volatile weight_t*)distances)[v];
+
+      edge_t start = G.get_starting_edge(v);
+      edge_t degree = G.get_number_of_neighbors(v);
+      for (edge_t e = start; e < start + degree; ++e) {
+        vertex_t neighbor = G.get_destination_vertex(e);
+        weight_t distance = d + G.get_edge_weight(e);
+        weight_t old = math::atomic::min(distances + neighbor, distance);
+        if (distance < old)
+          q.push(neighbor);
+      }
+    });
+  }
+};
+
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type& single_source,  // Parameter
+          typename graph_t::weight_type* distances,      // Output
+          config_t config = config_t()                   // Execution policy
+) {
+  // <user-defined>
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = param_t<vertex_t>;
+  using result_type = result_t<weight_t>;
+
+  param_type param(single_source);
+  result_type result(distances);
+  // </user-defined>
+
+  // <boiler-plate>
+  auto multi_context =
+      std::shared_ptr<gcuda::multi_context_t>(new gcuda::multi_context_t(0));
+
+  using problem_type = problem_t<graph_t, param_type, result_type>;
+  using enactor_type = enactor_t<problem_type>;
+
+  problem_type problem(G, param, result, multi_context);
+  problem.init();
+  problem.reset();
+
+  enactor_type enactor(&problem, multi_context, config);
+  return enactor.enact();
+  // </boiler-plate>
+}
+
+}  // namespace sssp
+}  // namespace async
+}  // namespace experimental
+}  // namespace gunrock
@@ -106,7 +106,9 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 };  // end of problem_c
 
-template <typename problem_t>
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context)
@@ -141,7 +143,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
     };  // end of update
 
     // Execute advance operator on the provided lambda
-    operators::advance::execute<operators::load_balance_t::block_mapped,
+    operators::advance::execute<lb,
                                 operators::advance_direction_t::forward,
                                 operators::advance_io_type_t::graph,
                                 operators::advance_io_type_t::vertices>(
@@ -200,7 +202,9 @@ void dump_result(ForwardIterator auth_dest,
 }
 
 // qqq get rid of template for better control
-template <typename graph_t, typename result_t>
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename graph_t, typename result_t>
 float run(graph_t& G,
           unsigned int max_iterations,
           result_t& result,
@@ -212,7 +216,7 @@ float run(graph_t& G,
   using weight_t = typename graph_t::weight_type;
 
   using problem_type = problem_t<graph_t, param_t>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   param_t param(max_iterations);
 
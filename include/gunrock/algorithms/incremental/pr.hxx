@@ -0,0 +1,432 @@
+/**
+ * @file pr.hxx
+ * @brief Incremental PageRank, a residual-push PageRank whose state (ranks and
+ * residuals) is kept across runs, such that after a batch of edge insertions
+ * and deletions (@see format::dynamic_csr_t) only the residuals around the
+ * updated vertices are repaired and pushed.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <gunrock/algorithms/algorithms.hxx>
+
+#include <thrust/binary_search.h>
+#include <thrust/merge.h>
+
+namespace gunrock {
+namespace incremental {
+namespace pr {
+
+/**
+ * @brief Ranks, residuals and outgoing weights of the last run, @see run().
+ *
+ * @par Overview
+ * The ranks `x` (unnormalized) and the residuals `r` satisfy, for every vertex
+ * v, `r[v] = (1 - alpha) / |V| + alpha * sum_{u -> v} x[u] * w(u, v) / W(u) -
+ * x[v]`, with `W(u)` the sum of the outgoing weights of u. A push moves the
+ * residual of a vertex into its rank and spreads `alpha` times it to its
+ * neighbors, a run is over once every `|r[v]| <= tol / |V|`. Normalizing x
+ * yields the PageRank whose dangling vertices spread their rank uniformly (as
+ * in gunrock::pr::run), within `tol / (1 - alpha)` in L1.
+ */
+template <typename weight_t>
+struct state_t {
+  weight_t alpha;
+  weight_t tol;
+
+  thrust::device_vector<weight_t> x;
+  thrust::device_vector<weight_t> r;
+  thrust::device_vector<weight_t> out_weights;  // W(u) of the last run.
+
+  state_t(weight_t _alpha = 0.85, weight_t _tol = 1e-6)
+      : alpha(_alpha), tol(_tol) {}
+
+  bool is_empty() const { return x.empty(); }
+};
+
+template <typename vertex_t, typename weight_t>
+struct param_t {
+  using edge_batch_type = format::edge_batch_t<vertex_t, weight_t>;
+
+  edge_batch_type const* inserted;
+  edge_batch_type const* deleted;
+  state_t<weight_t>* state;
+
+  param_t(edge_batch_type const* _inserted,
+          edge_batch_type const* _deleted,
+          state_t<weight_t>* _state)
+      : inserted(_inserted), deleted(_deleted), state(_state) {}
+};
+
+template <typename weight_t>
+struct result_t {
+  weight_t* p;
+  result_t(weight_t* _p) : p(_p) {}
+};
+
+template <typename graph_t, typename param_type, typename result_type>
+struct problem_t : gunrock::problem_t<graph_t> {
+  param_type param;
+  result_type result;
+
+  problem_t(graph_t& G,
+            param_type& _param,
+            result_type& _result,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::problem_t<graph_t>(G, _context),
+        param(_param),
+        result(_result) {}
+
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  /*!
+   * Residual moved into the rank of a vertex this iteration.
+   */
+  thrust::device_vector<weight_t> pushed;
+
+  /*!
+   * The vertex is in the next frontier (a residual may cross the threshold
+   * more than once, e.g. after deletions), cleared when it is absorbed.
+   */
+  thrust::device_vector<int> queued;
+
+  /*!
+   * The state was (re)initialized, every vertex starts active.
+   */
+  bool from_scratch = false;
+
+  void init() override {
+    auto g = this->get_graph();
+    auto n_vertices = g.get_number_of_vertices();
+    pushed.resize(n_vertices);
+    queued.resize(n_vertices);
+
+    auto& state = *(param.state);
+    from_scratch = state.is_empty() || (state.x.size() != n_vertices);
+    if (!from_scratch)
+      return;
+
+    auto policy = this->context->get_context(0)->execution_policy();
+    state.x.resize(n_vertices);
+    state.r.resize(n_vertices);
+    state.out_weights.resize(n_vertices);
+    thrust::fill(policy, state.x.begin(), state.x.end(), (weight_t)0);
+    thrust::fill(policy, state.r.begin(), state.r.end(),
+                 (1 - state.alpha) / n_vertices);
+
+    auto get_weight = [=] __device__(vertex_t const& v) -> weight_t {
+      weight_t sum = 0;
+      edge_t start = g.get_starting_edge(v);
+      edge_t end = start + g.get_number_of_neighbors(v);
+      for (edge_t e = start; e < end; ++e)
+        sum += g.get_edge_weight(e);
+      return sum;
+    };
+    thrust::transform(policy, thrust::counting_iterator<vertex_t>(0),
+                      thrust::counting_iterator<vertex_t>(n_vertices),
+                      state.out_weights.begin(), get_weight);
+  }
+
+  void reset() override {
+    auto policy = this->context->get_context(0)->execution_policy();
+    thrust::fill(policy, pushed.begin(), pushed.end(), (weight_t)0);
+    thrust::fill(policy, queued.begin(), queued.end(), 0);
+  }
+};
+
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped>
+struct enactor_t : gunrock::enactor_t<problem_t> {
+  enactor_t(problem_t* _problem,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::enactor_t<problem_t>(_problem, _context) {}
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
+
+  /*!
+   * Number of vertices whose residual crossed the threshold (device).
+   */
+  thrust::device_vector<unsigned long long> active_count;
+
+  /**
+   * @brief From scratch, every vertex is active. Otherwise, the contributions
+   * of every vertex whose outgoing edges changed are moved from its previous
+   * neighbors to its current ones, and the neighbors whose residual crosses
+   * the threshold are active.
+   */
+  void prepare_frontier(frontier_t* f,
+                        gcuda::multi_context_t& context) override {
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+    auto policy = context.get_context(0)->execution_policy();
+    auto n_vertices = G.get_number_of_vertices();
+
+    if (P->from_scratch) {
+      f->sequence((vertex_t)0, n_vertices,
+                  context.get_context(0)->stream());
+      return;
+    }
+
+    auto& state = *(P->param.state);
+    auto& inserted = *(P->param.inserted);
+    auto& deleted = *(P->param.deleted);
+    std::size_t n_inserted = inserted.size();
+    std::size_t n_deleted = deleted.size();
+
+    // Vertices whose outgoing edges changed (batches are sorted).
+    thrust::device_vector<vertex_t> touched(n_inserted + n_deleted);
+    auto last = thrust::merge(policy, inserted.sources.begin(),
+                              inserted.sources.end(), deleted.sources.begin(),
+                              deleted.sources.end(), touched.begin());
+    last = thrust::unique(policy, touched.begin(), last);
+    std::size_t n_touched = last - touched.begin();
+
+    // At most every current and deleted edge of the touched vertices
+    // activates its head.
+    auto touched_vertices = touched.data().get();
+    std::size_t n_candidates =
+        n_deleted +
+        thrust::transform_reduce(
+            policy, touched_vertices, touched_vertices + n_touched,
+            [=] __device__(vertex_t const& u) -> std::size_t {
+              return G.get_number_of_neighbors(u);
+            },
+            (std::size_t)0, thrust::plus<std::size_t>());
+
+    if (f->get_capacity() < n_candidates)
+      f->reserve(n_candidates);
+    auto candidates = f->data();
+
+    active_count.resize(1);
+    thrust::fill(policy, active_count.begin(), active_count.end(), 0);
+    auto count = active_count.data().get();
+
+    auto alpha = state.alpha;
+    auto threshold = state.tol / n_vertices;
+    auto x = state.x.data().get();
+    auto r = state.r.data().get();
+    auto out_weights = state.out_weights.data().get();
+    auto queued = P->queued.data().get();
+
+    auto inserted_tails = inserted.sources.data().get();
+    auto inserted_heads = inserted.destinations.data().get();
+    auto deleted_tails = deleted.sources.data().get();
+    auto deleted_heads = deleted.destinations.data().get();
+    auto deleted_weights = deleted.values.data().get();
+
+    auto repair = [=] __device__(vertex_t const& u) {
+      auto spread = [&](vertex_t const& v, weight_t const& delta) {
+        if (delta == 0)
+          return;
+        auto old_r = math::atomic::add(&r[v], delta);
+        auto new_r = old_r + delta;
+        if (abs(old_r) <= threshold && abs(new_r) > threshold &&
+            math::atomic::cas(&queued[v], 0, 1) == 0)
+          candidates[math::atomic::add(count, 1ull)] = v;
+      };
+
+      // Edges of u in the sorted batches.
+      auto i_first = thrust::lower_bound(thrust::seq, inserted_tails,
+                                         inserted_tails + n_inserted, u);
+      auto i_last = thrust::upper_bound(thrust::seq, i_first,
+                                        inserted_tails + n_inserted, u);
+      auto d_first = thrust::lower_bound(thrust::seq, deleted_tails,
+                                         deleted_tails + n_deleted, u);
+      auto d_last = thrust::upper_bound(thrust::seq, d_first,
+                                        deleted_tails + n_deleted, u);
+
+      auto i_heads = inserted_heads + (i_first - inserted_tails);
+      auto n_u_inserted = i_last - i_first;
+
+      weight_t old_sum = out_weights[u];
+      weight_t new_sum = 0;
+      edge_t start = G.get_starting_edge(u);
+      edge_t end = start + G.get_number_of_neighbors(u);
+      for (edge_t e = start; e < end; ++e)
+        new_sum += G.get_edge_weight(e);
+
+      weight_t old_share = (old_sum != 0) ? alpha * x[u] / old_sum : 0;
+      weight_t new_share = (new_sum != 0) ? alpha * x[u] / new_sum : 0;
+
+      for (edge_t e = start; e < end; ++e) {
+        auto v = G.get_destination_vertex(e);
+        auto w = G.get_edge_weight(e);
+        bool is_new = thrust::binary_search(thrust::seq, i_heads,
+                                            i_heads + n_u_inserted, v);
+        spread(v, w * (new_share - (is_new ? 0 : old_share)));
+      }
+
+      for (auto d = d_first - deleted_tails; d < d_last - deleted_tails; ++d)
+        spread(deleted_heads[d], -deleted_weights[d] * old_share);
+
+      out_weights[u] = new_sum;
+    };
+
+    thrust::for_each(policy, touched_vertices, touched_vertices + n_touched,
+                     repair);
+
+    thrust::host_vector<unsigned long long> h_count = active_count;
+    f->set_number_of_elements(h_count[0]);
+  }
+
+  void loop(gcuda::multi_context_t& context) override {
+    // Data slice
+    auto E = this->get_enactor();
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+
+    auto& state = *(P->param.state);
+    auto alpha = state.alpha;
+    auto threshold = state.tol / G.get_number_of_vertices();
+    auto x = state.x.data().get();
+    auto r = state.r.data().get();
+    auto out_weights = state.out_weights.data().get();
+    auto pushed = P->pushed.data().get();
+    auto queued = P->queued.data().get();
+
+    // Move the residuals of the active vertices into their ranks, a vertex
+    // may be queued again by this iteration's push.
+    auto absorb = [=] __device__(vertex_t const& v) {
+      queued[v] = 0;
+      auto residual = math::atomic::exch(&r[v], (weight_t)0);
+      if (residual == 0)
+        return;
+      math::atomic::add(&x[v], residual);
+      math::atomic::add(&pushed[v], residual);
+    };
+    operators::parallel_for::execute<operators::parallel_for_each_t::element>(
+        *(E->get_input_frontier()), absorb, context);
+
+    auto push = [=] __host__ __device__(
+                    vertex_t const& source,    // ... source
+                    vertex_t const& neighbor,  // neighbor
+                    edge_t const& edge,        // edge
+                    weight_t const& weight     // weight (tuple).
+                    ) -> bool {
+      auto residual = pushed[source];
+      if (residual == 0 || out_weights[source] == 0)
+        return false;
+      auto delta = alpha * residual * weight / out_weights[source];
+      auto old_r = math::atomic::add(&r[neighbor], delta);
+      auto new_r = old_r + delta;
+      return (abs(old_r) <= threshold) && (abs(new_r) > threshold) &&
+             (math::atomic::cas(&queued[neighbor], 0, 1) == 0);
+    };
+    operators::advance::execute<lb>(G, E, push, context);
+
+    // The previous frontier is still in the (now) output buffer.
+    auto retire = [pushed] __device__(vertex_t const& v) {
+      pushed[v] = 0;
+    };
+    operators::parallel_for::execute<operators::parallel_for_each_t::element>(
+        *(E->get_output_frontier()), retire, context);
+  }
+
+  /**
+   * @brief Normalize the ranks into the output.
+   */
+  void finalize(gcuda::multi_context_t& context) override {
+    auto P = this->get_problem();
+    auto& state = *(P->param.state);
+    auto policy = context.get_context(0)->execution_policy();
+
+    weight_t sum = thrust::reduce(policy, state.x.begin(), state.x.end(),
+                                  (weight_t)0);
+    auto d_p = thrust::device_pointer_cast(P->result.p);
+    thrust::transform(policy, state.x.begin(), state.x.end(), d_p,
+                      [sum] __device__(weight_t const& x) -> weight_t {
+                        return (sum != 0) ? x / sum : 0;
+                      });
+  }
+};  // struct enactor_t
+
+/**
+ * @brief Run incremental PageRank from scratch on G, (re)initializing the
+ * state to be updated by the next runs.
+ *
+ * @param G Graph (usually over a format::dynamic_csr_t).
+ * @param state Incremental state, @see state_t (holds alpha and tol).
+ * @param p Output PageRank (device, |V|).
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename graph_t>
+float run(graph_t& G,
+          state_t<typename graph_t::weight_type>& state,
+          typename graph_t::weight_type* p,  // Output
+          std::shared_ptr<gcuda::multi_context_t> context =
+              std::shared_ptr<gcuda::multi_context_t>(
+                  new gcuda::multi_context_t(0))  // Context
+) {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  state.x.clear();
+  format::edge_batch_t<vertex_t, weight_t> none;
+  return run<lb>(G, none, none, state, p, context);
+}
+
+/**
+ * @brief Update the PageRank of G after the given batches, starting from the
+ * state of the last run. Only the residuals of the neighbors (previous and
+ * current) of the vertices whose outgoing edges changed are repaired, and only
+ * the vertices whose residual then exceeds the threshold are pushed. Runs from
+ * scratch if the state is empty.
+ *
+ * @param G Updated graph.
+ * @param inserted Edges inserted (as returned by `insert_edges()`).
+ * @param deleted Edges deleted, with their weights (as returned by
+ * `delete_edges()`).
+ * @param state Incremental state of the last run (updated).
+ * @param p Output PageRank (device, |V|).
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename graph_t>
+float run(graph_t& G,
+          format::edge_batch_t<typename graph_t::vertex_type,
+                               typename graph_t::weight_type> const& inserted,
+          format::edge_batch_t<typename graph_t::vertex_type,
+                               typename graph_t::weight_type> const& deleted,
+          state_t<typename graph_t::weight_type>& state,
+          typename graph_t::weight_type* p,  // Output
+          std::shared_ptr<gcuda::multi_context_t> context =
+              std::shared_ptr<gcuda::multi_context_t>(
+                  new gcuda::multi_context_t(0))  // Context
+) {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = param_t<vertex_t, weight_t>;
+  using result_type = result_t<weight_t>;
+
+  param_type param(&inserted, &deleted, &state);
+  result_type result(p);
+
+  using problem_type = problem_t<graph_t, param_type, result_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
+
+  problem_type problem(G, param, result, context);
+  problem.init();
+  problem.reset();
+
+  enactor_type enactor(&problem, context);
+  return enactor.enact();
+}
+
+}  // namespace pr
+}  // namespace incremental
+}  // namespace gunrock
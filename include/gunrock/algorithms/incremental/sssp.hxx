@@ -0,0 +1,433 @@
+/**
+ * @file sssp.hxx
+ * @brief Incremental Single-Source Shortest Path, repairs the distances of a
+ * previous run after a batch of edge insertions and deletions (@see
+ * format::dynamic_csr_t) instead of recomputing them.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <gunrock/algorithms/algorithms.hxx>
+
+namespace gunrock {
+namespace incremental {
+namespace sssp {
+
+template <typename vertex_t, typename weight_t>
+struct param_t {
+  using edge_batch_type = format::edge_batch_t<vertex_t, weight_t>;
+
+  vertex_t single_source;
+  edge_batch_type const* inserted;
+  edge_batch_type const* deleted;
+  bool symmetric;
+
+  /**
+   * @brief Incremental SSSP parameters.
+   *
+   * @param _single_source Source vertex of the previous distances.
+   * @param _inserted Edges inserted since (as returned by `insert_edges()`).
+   * @param _deleted Edges deleted since, with their weights (as returned by
+   * `delete_edges()`).
+   * @param _symmetric The graph is symmetric, such that the in-neighbors of a
+   * vertex are its out-neighbors and deletions are repaired locally.
+   */
+  param_t(vertex_t _single_source,
+          edge_batch_type const* _inserted,
+          edge_batch_type const* _deleted,
+          bool _symmetric)
+      : single_source(_single_source),
+        inserted(_inserted),
+        deleted(_deleted),
+        symmetric(_symmetric) {}
+};
+
+template <typename distance_t>
+struct result_t {
+  distance_t* distances;  // Previous distances (input), repaired (output).
+  result_t(distance_t* _distances) : distances(_distances) {}
+};
+
+/**
+ * @tparam distance_type Distances type.
+ * @tparam hops If true, every edge has length 1 (breadth-first search).
+ */
+template <typename graph_t,
+          typename param_type,
+          typename result_type,
+          typename distance_type,
+          bool hops = false>
+struct problem_t : gunrock::problem_t<graph_t> {
+  param_type param;
+  result_type result;
+
+  problem_t(graph_t& G,
+            param_type& _param,
+            result_type& _result,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::problem_t<graph_t>(G, _context),
+        param(_param),
+        result(_result) {}
+
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+  using distance_t = distance_type;
+
+  static constexpr bool unit_lengths = hops;
+
+  /*!
+   * Vertices whose distance may have increased by a deletion (flag and list).
+   */
+  thrust::device_vector<int> invalid;
+  thrust::device_vector<vertex_t> cone;
+
+  thrust::device_vector<vertex_t> visited;
+
+  void init() override {
+    auto g = this->get_graph();
+    auto n_vertices = g.get_number_of_vertices();
+    invalid.resize(n_vertices);
+    visited.resize(n_vertices);
+  }
+
+  void reset() override {
+    auto policy = this->context->get_context(0)->execution_policy();
+    thrust::fill(policy, invalid.begin(), invalid.end(), 0);
+    thrust::fill(policy, visited.begin(), visited.end(), -1);
+    cone.clear();
+  }
+};
+
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::adaptive>
+struct enactor_t : gunrock::enactor_t<problem_t> {
+  enactor_t(problem_t* _problem,
+            std::shared_ptr<gcuda::multi_context_t> _context,
+            enactor_properties_t _properties = enactor_properties_t())
+      : gunrock::enactor_t<problem_t>(_problem, _context, _properties) {}
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using distance_t = typename problem_t::distance_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
+
+  static constexpr bool hops = problem_t::unit_lengths;
+
+  /**
+   * @brief Invalidate the vertices whose shortest paths may use a deleted
+   * edge, and give them their best distance through the valid vertices. Then
+   * seed the frontier with them, and with the heads of the inserted edges
+   * that shorten a distance.
+   */
+  void prepare_frontier(frontier_t* f,
+                        gcuda::multi_context_t& context) override {
+    auto E = this->get_enactor();
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+    auto policy = context.get_context(0)->execution_policy();
+
+    auto source = P->param.single_source;
+    auto distances = P->result.distances;
+    auto invalid = P->invalid.data().get();
+    auto infinity = std::numeric_limits<distance_t>::max();
+
+    std::size_t n_deleted = P->param.deleted ? P->param.deleted->size() : 0;
+    std::size_t n_inserted =
+        P->param.inserted ? P->param.inserted->size() : 0;
+
+    if (n_deleted > 0) {
+      auto& deleted = *(P->param.deleted);
+      auto tails = deleted.sources.data().get();
+      auto heads = deleted.destinations.data().get();
+      auto lengths = deleted.values.data().get();
+
+      // Heads of the deleted edges that were on a shortest path.
+      frontier_t* in = f;
+      frontier_t* out = E->get_output_frontier();
+      resize(in, n_deleted);
+      auto seeds = in->data();
+      thrust::transform(
+          policy, thrust::make_counting_iterator<std::size_t>(0),
+          thrust::make_counting_iterator<std::size_t>(n_deleted), seeds,
+          [=] __device__(std::size_t const& i) -> vertex_t {
+            vertex_t u = tails[i];
+            vertex_t w = heads[i];
+            distance_t length = hops ? distance_t(1) : distance_t(lengths[i]);
+            bool tight = (w != source) && (distances[u] != infinity) &&
+                         (distances[w] == distances[u] + length);
+            if (tight && math::atomic::cas(&invalid[w], 0, 1) == 0)
+              return w;
+            return gunrock::numeric_limits<vertex_t>::invalid();
+          });
+
+      // Spread the invalidation along the (remaining) tight edges. This
+      // over-approximates the vertices whose distance increased.
+      auto spread = [=] __host__ __device__(
+                        vertex_t const& v,       // ... source
+                        vertex_t const& x,       // neighbor
+                        edge_t const& edge,      // edge
+                        weight_t const& weight   // weight (tuple).
+                        ) -> bool {
+        distance_t length = hops ? distance_t(1) : distance_t(weight);
+        if (x == source || distances[x] != distances[v] + length)
+          return false;
+        return math::atomic::cas(&invalid[x], 0, 1) == 0;
+      };
+
+      while (!in->is_empty()) {
+        append_valid(P->cone, in, context);
+        operators::advance::execute<lb, operators::advance_direction_t::forward,
+                                    operators::advance_io_type_t::vertices,
+                                    operators::advance_io_type_t::vertices>(
+            G, spread, in, out, E->scanned_work_domain, context);
+        std::swap(in, out);
+      }
+
+      std::size_t n_cone = P->cone.size();
+      auto cone = P->cone.data().get();
+      thrust::for_each(policy, cone, cone + n_cone,
+                       [=] __device__(vertex_t const& x) {
+                         distances[x] = infinity;
+                       });
+
+      // Best distance of every invalid vertex through the valid ones.
+      if (P->param.symmetric) {
+        auto pull = [=] __device__(vertex_t const& x) {
+          auto best = infinity;
+          auto first = G.get_starting_edge(x);
+          auto last = first + G.get_number_of_neighbors(x);
+          for (auto e = first; e < last; ++e) {
+            auto y = G.get_destination_vertex(e);
+            if (invalid[y] || distances[y] == infinity)
+              continue;
+            distance_t length =
+                hops ? distance_t(1) : distance_t(G.get_edge_weight(e));
+            best = min(best, distances[y] + length);
+          }
+          distances[x] = best;
+        };
+        thrust::for_each(policy, cone, cone + n_cone, pull);
+      } else {
+        auto push = [=] __device__(vertex_t const& y) {
+          if (invalid[y] || distances[y] == infinity)
+            return;
+          auto first = G.get_starting_edge(y);
+          auto last = first + G.get_number_of_neighbors(y);
+          for (auto e = first; e < last; ++e) {
+            auto x = G.get_destination_vertex(e);
+            if (!invalid[x])
+              continue;
+            distance_t length =
+                hops ? distance_t(1) : distance_t(G.get_edge_weight(e));
+            math::atomic::min(&distances[x], distances[y] + length);
+          }
+        };
+        operators::parallel_for::execute<
+            operators::parallel_for_each_t::vertex>(G, push, context);
+      }
+
+      thrust::for_each(policy, cone, cone + n_cone,
+                       [=] __device__(vertex_t const& x) { invalid[x] = 0; });
+    }
+
+    // Seed with the repaired vertices (that are reachable again) ...
+    std::size_t n_cone = P->cone.size();
+    resize(f, n_cone + n_inserted);
+    auto seeds = f->data();
+    auto cone = P->cone.data().get();
+    thrust::transform(policy, cone, cone + n_cone, seeds,
+                      [=] __device__(vertex_t const& x) -> vertex_t {
+                        if (distances[x] != infinity)
+                          return x;
+                        return gunrock::numeric_limits<vertex_t>::invalid();
+                      });
+
+    // ... and the heads of the inserted edges that shorten a distance.
+    if (n_inserted > 0) {
+      auto& inserted = *(P->param.inserted);
+      auto tails = inserted.sources.data().get();
+      auto heads = inserted.destinations.data().get();
+      auto lengths = inserted.values.data().get();
+      thrust::transform(
+          policy, thrust::make_counting_iterator<std::size_t>(0),
+          thrust::make_counting_iterator<std::size_t>(n_inserted),
+          seeds + n_cone, [=] __device__(std::size_t const& i) -> vertex_t {
+            vertex_t u = tails[i];
+            vertex_t w = heads[i];
+            distance_t length = hops ? distance_t(1) : distance_t(lengths[i]);
+            if (distances[u] != infinity) {
+              auto candidate = distances[u] + length;
+              if (candidate < math::atomic::min(&distances[w], candidate))
+                return w;
+            }
+            return gunrock::numeric_limits<vertex_t>::invalid();
+          });
+    }
+  }
+
+  void loop(gcuda::multi_context_t& context) override {
+    // Data slice
+    auto E = this->get_enactor();
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+
+    auto distances = P->result.distances;
+    auto visited = P->visited.data().get();
+    auto iteration = this->iteration;
+
+    auto shortest_path = [distances] __host__ __device__(
+                             vertex_t const& source,    // ... source
+                             vertex_t const& neighbor,  // neighbor
+                             edge_t const& edge,        // edge
+                             weight_t const& weight     // weight (tuple).
+                             ) -> bool {
+      distance_t length = hops ? distance_t(1) : distance_t(weight);
+      distance_t distance_to_neighbor =
+          thread::load(&distances[source]) + length;
+      distance_t recover_distance =
+          math::atomic::min(&(distances[neighbor]), distance_to_neighbor);
+      return (distance_to_neighbor < recover_distance);
+    };
+
+    auto remove_completed_paths = [visited, iteration] __host__ __device__(
+                                      vertex_t const& vertex) -> bool {
+      return math::atomic::exch(&visited[vertex], (vertex_t)iteration) !=
+             (vertex_t)iteration;
+    };
+
+    operators::advance::execute<lb>(G, E, shortest_path, context);
+    operators::filter::execute<operators::filter_algorithm_t::bypass>(
+        G, E, remove_completed_paths, context);
+  }
+
+  void resize(frontier_t* f, std::size_t size) {
+    if (f->get_capacity() < size)
+      f->reserve(size);
+    f->set_number_of_elements(size);
+  }
+
+  /**
+   * @brief Append the valid vertices of a frontier to a list.
+   */
+  void append_valid(thrust::device_vector<vertex_t>& list,
+                    frontier_t* f,
+                    gcuda::multi_context_t& context) {
+    auto policy = context.get_context(0)->execution_policy();
+    std::size_t size = list.size();
+    list.resize(size + f->get_number_of_elements());
+    auto last = thrust::copy_if(
+        policy, f->begin(), f->end(), list.begin() + size,
+        [] __device__(vertex_t const& v) {
+          return gunrock::util::limits::is_valid(v);
+        });
+    list.resize(last - list.begin());
+  }
+};  // struct enactor_t
+
+/**
+ * @brief Repair the shortest-path distances from `single_source` of a previous
+ * run (or of a static SSSP, @see gunrock::sssp::run) after the graph G was
+ * updated by the given batches. Only the vertices around the updates are
+ * visited: the heads of inserted edges that shorten a path are relaxed, and
+ * the vertices whose shortest paths used a deleted edge are invalidated and
+ * recomputed from their valid neighbors (all the valid vertices are scanned
+ * once instead if G is not symmetric).
+ *
+ * @tparam lb Load-balancing technique of the advance.
+ * @tparam graph_t Graph type (usually over a format::dynamic_csr_t).
+ * @param G Updated graph.
+ * @param single_source Source vertex of the distances.
+ * @param inserted Edges inserted (as returned by `insert_edges()`).
+ * @param deleted Edges deleted, with their weights (as returned by
+ * `delete_edges()`).
+ * @param distances Distances of the graph before the updates (input), and
+ * after (output).
+ * @param context Device context.
+ * @return float Time taken to repair the distances.
+ */
+template <operators::load_balance_t lb = operators::load_balance_t::adaptive,
+          typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type const& single_source,
+          format::edge_batch_t<typename graph_t::vertex_type,
+                               typename graph_t::weight_type> const& inserted,
+          format::edge_batch_t<typename graph_t::vertex_type,
+                               typename graph_t::weight_type> const& deleted,
+          typename graph_t::weight_type* distances,
+          std::shared_ptr<gcuda::multi_context_t> context =
+              std::shared_ptr<gcuda::multi_context_t>(
+                  new gcuda::multi_context_t(0))  // Context
+) {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = param_t<vertex_t, weight_t>;
+  using result_type = result_t<weight_t>;
+
+  param_type param(single_source, &inserted, &deleted, G.is_symmetric());
+  result_type result(distances);
+
+  using problem_type =
+      problem_t<graph_t, param_type, result_type, weight_t, false>;
+  using enactor_type = enactor_t<problem_type, lb>;
+
+  problem_type problem(G, param, result, context);
+  problem.init();
+  problem.reset();
+
+  enactor_type enactor(&problem, context);
+  return enactor.enact();
+}
+
+}  // namespace sssp
+
+namespace bfs {
+
+/**
+ * @brief Repair the breadth-first search depths from `single_source` of a
+ * previous run (@see gunrock::bfs::run) after the graph G was updated by the
+ * given batches, @see incremental::sssp::run.
+ */
+template <operators::load_balance_t lb = operators::load_balance_t::adaptive,
+          typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type const& single_source,
+          format::edge_batch_t<typename graph_t::vertex_type,
+                               typename graph_t::weight_type> const& inserted,
+          format::edge_batch_t<typename graph_t::vertex_type,
+                               typename graph_t::weight_type> const& deleted,
+          typename graph_t::vertex_type* distances,
+          std::shared_ptr<gcuda::multi_context_t> context =
+              std::shared_ptr<gcuda::multi_context_t>(
+                  new gcuda::multi_context_t(0))  // Context
+) {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = sssp::param_t<vertex_t, weight_t>;
+  using result_type = sssp::result_t<vertex_t>;
+
+  param_type param(single_source, &inserted, &deleted, G.is_symmetric());
+  result_type result(distances);
+
+  using problem_type =
+      sssp::problem_t<graph_t, param_type, result_type, vertex_t, true>;
+  using enactor_type = sssp::enactor_t<problem_type, lb>;
+
+  problem_type problem(G, param, result, context);
+  problem.init();
+  problem.reset();
+
+  enactor_type enactor(&problem, context);
+  return enactor.enact();
+}
+
+}  // namespace bfs
+}  // namespace incremental
+}  // namespace gunrock
@@ -1,7 +1,7 @@
 /**
  * @file kcore.hxx
  * @author Afton Geil (angeil@ucdavis.edu)
- * @brief Vertex k-core decomposition algorithm.
+ * @brief Vertex k-core decomposition algorithm (bucketed peeling).
  * @date 2021-05-03
  *
  * @copyright Copyright (c) 2021
@@ -11,7 +11,6 @@
 #pragma once
 
 #include <gunrock/algorithms/algorithms.hxx>
-#include <thrust/logical.h>
 
 namespace gunrock {
 namespace kcore {
@@ -35,37 +34,32 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
+  /*!
+   * Degree of a vertex in the remaining (not yet peeled) graph, the priority
+   * of its bucket.
+   */
   thrust::device_vector<int> degrees;
   thrust::device_vector<bool> deleted;
-  thrust::device_vector<bool> to_be_deleted;
 
-  void init() {
-    // Get the graph
+  void init() override {
     auto g = this->get_graph();
-
-    // Get number of vertices from the graph
     auto n_vertices = g.get_number_of_vertices();
-
-    // Set the size of `degrees`, `deleted`, and `to_be_deleted`
     degrees.resize(n_vertices);
     deleted.resize(n_vertices);
-    to_be_deleted.resize(n_vertices);
   }
 
-  void reset() {
+  void reset() override {
     auto g = this->get_graph();
 
     auto k_cores = this->result.k_cores;
     auto n_vertices = g.get_number_of_vertices();
 
-    // set `k_cores`, `deleted`, and `to_be_deleted` to 0 for all vertices
     auto policy = this->context->get_context(0)->execution_policy();
     thrust::fill(policy, k_cores + 0, k_cores + n_vertices, 0);
-    thrust::fill(policy, to_be_deleted.begin(), to_be_deleted.end(), 0);
+    thrust::fill(policy, deleted.begin(), deleted.end(), false);
 
-    // set initial `degrees` values to be vertices' actual degree
-    // will reduce these as vertices are removed from k-cores with increasing k
-    // value
+    // Initial `degrees` are the vertices' actual degree, they decrease as the
+    // neighbors are peeled.
     auto get_degree = [=] __device__(const int& i) -> int {
       return g.get_number_of_neighbors(i);
     };
@@ -73,128 +67,110 @@ struct problem_t : gunrock::problem_t<graph_t> {
     thrust::transform(policy, thrust::counting_iterator<vertex_t>(0),
                       thrust::counting_iterator<vertex_t>(n_vertices),
                       degrees.begin(), get_degree);
-
-    // mark zero degree vertices as deleted
-    auto degrees_data = degrees.data().get();
-    auto mark_zero_degrees = [=] __device__(const int& i) -> bool {
-      return (degrees_data[i] == 0) ? true : false;
-    };
-
-    thrust::transform(policy, thrust::counting_iterator<vertex_t>(0),
-                      thrust::counting_iterator<vertex_t>(n_vertices),
-                      deleted.begin(), mark_zero_degrees);
   }
 };
 
+/**
+ * @brief Bucketed peeling (in the spirit of Batagelj and Zaversnik), with the
+ * vertices bucketed by their remaining degree in a
+ * `frontier::near_far_frontier_t` (buckets of width 1).
+ *
+ * @par Overview
+ * The near pile holds the vertices of degree at most `k`, where `k + 1` is
+ * the threshold, and the far pile the others. An iteration peels the near
+ * pile (its vertices are in the `k`-core but not the `(k + 1)`-core) and
+ * decrements the degrees of their remaining neighbors; a neighbor whose
+ * degree drops to `k` is the next near pile. Once it is empty, the threshold
+ * jumps to the smallest remaining degree plus one. Every edge is visited
+ * once (from its first peeled endpoint), and levels without vertices cost
+ * nothing.
+ *
+ * @note The advance is the bucketing one, which block-maps the near pile
+ * (@see operators::advance::bucketing::execute).
+ */
 template <typename problem_t>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context)
-      : gunrock::enactor_t<problem_t>(_problem, _context) {}
+      : gunrock::enactor_t<problem_t>(_problem, _context),
+        buckets(1, _context->get_context(0)->stream()) {}
 
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
-  using frontier_t = typename enactor_t<problem_t>::frontier_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
+
+  /*!
+   * Degree buckets, the near pile is the input frontier.
+   */
+  frontier::near_far_frontier_t<vertex_t, edge_t, int> buckets;
 
   void prepare_frontier(frontier_t* f,
                         gcuda::multi_context_t& context) override {
-    // get pointer to the problem
     auto P = this->get_problem();
     auto n_vertices = P->get_graph().get_number_of_vertices();
+    auto degrees = P->degrees.data().get();
 
-    // Fill the frontier with a sequence of vertices from 0 -> n_vertices.
+    // All the vertices, the ones of degree 0 (0-core) are the near pile.
     f->sequence((vertex_t)0, n_vertices, context.get_context(0)->stream());
+    buckets.reset(1);
+    buckets.split(
+        *f, [degrees] __device__(vertex_t const& v) { return degrees[v]; },
+        *context.get_context(0));
   }
 
-  // One iteration of the application
+  // Peel the near pile.
   void loop(gcuda::multi_context_t& context) override {
     auto E = this->get_enactor();
     auto P = this->get_problem();
     auto G = P->get_graph();
 
-    // Get parameters and data structures
     auto k_cores = P->result.k_cores;
     auto degrees = P->degrees.data().get();
     auto deleted = P->deleted.data().get();
-    auto to_be_deleted = P->to_be_deleted.data().get();
-    auto n_vertices = G.get_number_of_vertices();
-    auto f = this->get_input_frontier();
 
-    // Get current iteration of application
-    auto k = this->iteration + 1;
-
-    // Mark vertices with degree <= k for deletion and output their neighbors
-    auto advance_op = [=] __host__ __device__(
-                          vertex_t const& source,    // source of edge
-                          vertex_t const& neighbor,  // destination of edge
-                          edge_t const& edge,        // id of edge
-                          weight_t const& weight     // weight of edge
-                          ) -> bool {
-      if ((deleted[source] == true) || (degrees[source] > k)) {
-        return false;
-      } else {
-        k_cores[source] = k;
-        to_be_deleted[source] = true;
-        if (deleted[neighbor] == true) {
-          return false;
-        }
-        return true;
-      }
-    };
+    int k = buckets.get_threshold() - 1;
 
-    // Reduce degrees of deleted vertices' neighbors
-    // Check updated degree against k
-    auto filter_op = [=] __host__ __device__(vertex_t const& vertex) -> bool {
-      if (deleted[vertex] == true) {
+    // Peeled before the advance, such that the neighbors in the same pile are
+    // not decremented.
+    auto peel = [=] __device__(vertex_t const& v) {
+      deleted[v] = true;
+      k_cores[v] = k;
+    };
+    operators::parallel_for::execute<operators::parallel_for_each_t::element>(
+        *(E->get_input_frontier()), peel, context);
+
+    // The neighbor whose degree drops to `k` joins the next near pile.
+    auto peel_op = [=] __host__ __device__(
+                       vertex_t const& source,    // source of edge
+                       vertex_t const& neighbor,  // destination of edge
+                       edge_t const& edge,        // id of edge
+                       weight_t const& weight     // weight of edge
+                       ) -> bool {
+      if (deleted[neighbor])
         return false;
-      }
+      return math::atomic::add(&degrees[neighbor], -1) == (k + 1);
+    };
 
-      int old_degrees = math::atomic::add(&degrees[vertex], -1);
-      return (old_degrees != (k + 1)) ? false : true;
+    auto priority = [degrees] __device__(vertex_t const& v) -> int {
+      return degrees[v];
     };
 
-    while (!f->is_empty()) {
-      // Execute advance operator
-      operators::advance::execute<operators::load_balance_t::block_mapped>(
-          G, E, advance_op, context);
-
-      // Mark to-be-deleted vertices as deleted
-      auto mark_deleted = [=] __device__(const vertex_t& v) {
-        deleted[v] = (deleted[v] | to_be_deleted[v]);
-      };
-
-      operators::parallel_for::execute<operators::parallel_for_each_t::vertex>(
-          G,             // graph
-          mark_deleted,  // lambda function
-          context        // context
-      );
-
-      // Execute filter operator
-      operators::filter::execute<operators::filter_algorithm_t::predicated>(
-          G, E, filter_op, context);
-    }
-  }
+    operators::advance::bucketing::execute(G, E, peel_op, priority, buckets,
+                                           context);
 
-  virtual bool is_converged(gcuda::multi_context_t& context) {
-    auto P = this->get_problem();
-    auto G = P->get_graph();
-    auto n_vertices = G.get_number_of_vertices();
+    // Once level `k` is peeled, jump to the smallest remaining degree.
     auto f = this->get_input_frontier();
-    auto policy = context.get_context(0)->execution_policy();
-
-    //  Check if all vertices have been removed from graph
-    bool graph_empty = thrust::all_of(
-        policy, P->deleted.begin(), P->deleted.end(), thrust::identity<bool>());
-
-    if (graph_empty) {
-      printf("degeneracy = %u\n", this->iteration);
-    }
-
-    // Fill the frontier with a sequence of vertices from 0 -> n_vertices.
-    f->sequence((vertex_t)0, n_vertices, context.get_context(0)->stream());
+    if (f->is_empty())
+      buckets.refill(*f, priority, *context.get_context(0));
+  }
 
-    return graph_empty;
+  /**
+   * @brief Converged once the near pile is empty, the far pile is then empty
+   * too (@see loop()) and the graph is peeled.
+   */
+  virtual bool is_converged(gcuda::multi_context_t& context) override {
+    return this->get_input_frontier()->is_empty();
   }
 };
 
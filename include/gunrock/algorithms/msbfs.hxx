@@ -0,0 +1,274 @@
+/**
+ * @file msbfs.hxx
+ * @brief Multi-Source Breadth-First Search, up to 32 or 64 searches share one
+ * traversal using bit-parallel visited masks (in the spirit of Then et al.,
+ * "The More the Merrier: Efficient Multi-Source Graph Traversal", VLDB'14).
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <gunrock/algorithms/algorithms.hxx>
+
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/scatter.h>
+
+namespace gunrock {
+namespace msbfs {
+
+/**
+ * @brief Index of the lowest set bit of a mask.
+ */
+__device__ __forceinline__ int lowest_bit(unsigned int mask) {
+  return __ffs(mask) - 1;
+}
+
+__device__ __forceinline__ int lowest_bit(unsigned long long mask) {
+  return __ffsll(mask) - 1;
+}
+
+template <typename vertex_t>
+struct param_t {
+  vertex_t const* sources;  // Host array.
+  std::size_t number_of_sources;
+  param_t(vertex_t const* _sources, std::size_t _number_of_sources)
+      : sources(_sources), number_of_sources(_number_of_sources) {}
+};
+
+template <typename vertex_t>
+struct result_t {
+  vertex_t* distances;  // number_of_sources x number_of_vertices.
+  result_t(vertex_t* _distances) : distances(_distances) {}
+};
+
+template <typename graph_t,
+          typename param_type,
+          typename result_type,
+          typename mask_type>
+struct problem_t : gunrock::problem_t<graph_t> {
+  param_type param;
+  result_type result;
+
+  problem_t(graph_t& G,
+            param_type& _param,
+            result_type& _result,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::problem_t<graph_t>(G, _context),
+        param(_param),
+        result(_result) {}
+
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+  using mask_t = mask_type;
+
+  static constexpr std::size_t batch_size = sizeof(mask_t) * 8;
+
+  /*!
+   * Bit `s` of a vertex is set if search `s` has reached it (`seen`), reached
+   * it in the last iteration (`visit`) or reaches it in this iteration
+   * (`visit_next`).
+   */
+  thrust::device_vector<mask_t> seen;
+  thrust::device_vector<mask_t> visit;
+  thrust::device_vector<mask_t> visit_next;
+
+  /*!
+   * Distinct sources of the batch (initial frontier).
+   */
+  std::vector<vertex_t> frontier_sources;
+
+  void init() override {
+    auto n_vertices = this->get_graph().get_number_of_vertices();
+    seen.resize(n_vertices);
+    visit.resize(n_vertices);
+    visit_next.resize(n_vertices);
+  }
+
+  void reset() override {
+    error::throw_if_exception(param.number_of_sources > batch_size,
+                              "Too many sources for the visited masks.");
+
+    auto n_vertices = this->get_graph().get_number_of_vertices();
+    auto policy = this->context->get_context(0)->execution_policy();
+
+    thrust::fill(policy, seen.begin(), seen.end(), mask_t(0));
+    thrust::fill(policy, visit.begin(), visit.end(), mask_t(0));
+    thrust::fill(policy, visit_next.begin(), visit_next.end(), mask_t(0));
+
+    auto d_distances = thrust::device_pointer_cast(result.distances);
+    thrust::fill(policy, d_distances,
+                 d_distances + param.number_of_sources * n_vertices,
+                 std::numeric_limits<vertex_t>::max());
+
+    // Merge the masks of repeated sources.
+    std::map<vertex_t, mask_t> masks;
+    thrust::host_vector<std::size_t> h_zeros(param.number_of_sources);
+    for (std::size_t s = 0; s < param.number_of_sources; ++s) {
+      masks[param.sources[s]] |= mask_t(1) << s;
+      h_zeros[s] = s * n_vertices + param.sources[s];
+    }
+
+    // Zero the sources' own distances on the stream of the fill above (not
+    // through device references, which are not ordered after it).
+    thrust::device_vector<std::size_t> d_zeros = h_zeros;
+    thrust::scatter(policy, thrust::make_constant_iterator(vertex_t(0)),
+                    thrust::make_constant_iterator(vertex_t(0)) +
+                        param.number_of_sources,
+                    d_zeros.begin(), d_distances);
+
+    frontier_sources.clear();
+    thrust::host_vector<mask_t> h_masks;
+    for (auto const& [source, mask] : masks) {
+      frontier_sources.push_back(source);
+      h_masks.push_back(mask);
+    }
+
+    thrust::device_vector<vertex_t> d_sources(frontier_sources.begin(),
+                                              frontier_sources.end());
+    thrust::device_vector<mask_t> d_masks = h_masks;
+    thrust::scatter(policy, d_masks.begin(), d_masks.end(), d_sources.begin(),
+                    seen.begin());
+    thrust::scatter(policy, d_masks.begin(), d_masks.end(), d_sources.begin(),
+                    visit.begin());
+  }
+};
+
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::adaptive>
+struct enactor_t : gunrock::enactor_t<problem_t> {
+  enactor_t(problem_t* _problem,
+            std::shared_ptr<gcuda::multi_context_t> _context)
+      : gunrock::enactor_t<problem_t>(_problem, _context) {}
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using mask_t = typename problem_t::mask_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
+
+  void prepare_frontier(frontier_t* f,
+                        gcuda::multi_context_t& context) override {
+    auto P = this->get_problem();
+    f->set_number_of_elements(0);
+    for (auto const& source : P->frontier_sources)
+      f->push_back(source);
+  }
+
+  void loop(gcuda::multi_context_t& context) override {
+    // Data slice
+    auto E = this->get_enactor();
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+
+    std::size_t n_vertices = G.get_number_of_vertices();
+    auto distances = P->result.distances;
+    auto seen = P->seen.data().get();
+    auto visit = P->visit.data().get();
+    auto visit_next = P->visit_next.data().get();
+    auto iteration = this->iteration;
+
+    // Forward the searches of the source that have not reached the neighbor
+    // yet. The first search to reach the neighbor adds it to the output.
+    auto expand = [seen, visit, visit_next] __host__ __device__(
+                      vertex_t const& source,    // ... source
+                      vertex_t const& neighbor,  // neighbor
+                      edge_t const& edge,        // edge
+                      weight_t const& weight     // weight (tuple).
+                      ) -> bool {
+      mask_t bits = visit[source] & ~seen[neighbor];
+      if (!bits || ((visit_next[neighbor] & bits) == bits))
+        return false;
+      return math::atomic::bit_or(&visit_next[neighbor], bits) == 0;
+    };
+
+    operators::advance::execute<lb>(G, E, expand, context);
+
+    // The previous frontier is still in the (now) output buffer.
+    auto retire = [visit] __device__(vertex_t const& v) { visit[v] = 0; };
+    operators::parallel_for::execute<operators::parallel_for_each_t::element>(
+        *(E->get_output_frontier()), retire, context);
+
+    auto settle = [=] __device__(vertex_t const& v) {
+      mask_t bits = visit_next[v] & ~seen[v];
+      visit_next[v] = 0;
+      seen[v] |= bits;
+      visit[v] = bits;
+      for (; bits; bits &= bits - 1)
+        distances[lowest_bit(bits) * n_vertices + v] = iteration + 1;
+    };
+    operators::parallel_for::execute<operators::parallel_for_each_t::element>(
+        *(E->get_input_frontier()), settle, context);
+  }
+
+};  // struct enactor_t
+
+/**
+ * @brief Run Multi-Source Breadth-First Search algorithm on a given graph, G,
+ * from every source in sources. The sources are processed in batches of
+ * `sizeof(mask_t) * 8` that share a single traversal, and the problem and the
+ * enactor (frontiers) are reused across the batches.
+ *
+ * @tparam lb Load-balancing technique of the advance, @see
+ * operators::load_balance_t.
+ * @tparam mask_t Visited masks type, `unsigned int` (batches of 32) or
+ * `unsigned long long` (batches of 64).
+ * @tparam graph_t Graph type.
+ * @param G Graph object.
+ * @param sources Source vertices (repetitions allowed).
+ * @param distances Pointer to the distances array (device) of size number of
+ * sources times number of vertices, the distances from `sources[s]` start at
+ * `distances + s * number_of_vertices`.
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <operators::load_balance_t lb =
+              operators::load_balance_t::adaptive,
+          typename mask_t = unsigned long long,
+          typename graph_t>
+float run(graph_t& G,
+          std::vector<typename graph_t::vertex_type> const& sources,  // Param
+          typename graph_t::vertex_type* distances,                   // Output
+          std::shared_ptr<gcuda::multi_context_t> context =
+              std::shared_ptr<gcuda::multi_context_t>(
+                  new gcuda::multi_context_t(0))  // Context
+) {
+  using vertex_t = typename graph_t::vertex_type;
+  using param_type = param_t<vertex_t>;
+  using result_type = result_t<vertex_t>;
+
+  using problem_type = problem_t<graph_t, param_type, result_type, mask_t>;
+  using enactor_type = enactor_t<problem_type, lb>;
+
+  constexpr std::size_t batch_size = problem_type::batch_size;
+  std::size_t n_vertices = G.get_number_of_vertices();
+
+  param_type param(sources.data(), std::min(batch_size, sources.size()));
+  result_type result(distances);
+
+  problem_type problem(G, param, result, context);
+  problem.init();
+
+  enactor_type enactor(&problem, context);
+
+  float elapsed = 0;
+  for (std::size_t first = 0; first < sources.size(); first += batch_size) {
+    problem.param.sources = sources.data() + first;
+    problem.param.number_of_sources =
+        std::min(batch_size, sources.size() - first);
+    problem.result.distances = distances + first * n_vertices;
+
+    problem.reset();
+    elapsed += enactor.enact();
+  }
+  return elapsed;
+}
+
+}  // namespace msbfs
+}  // namespace gunrock
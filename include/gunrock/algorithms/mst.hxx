@@ -46,13 +46,14 @@ struct problem_t : gunrock::problem_t<graph_t> {
 
   graph_t g = this->get_graph();
   int n_vertices = g.get_number_of_vertices();
-
-  thrust::device_vector<vertex_t> roots;
-  thrust::device_vector<vertex_t> new_roots;
-  thrust::device_vector<weight_t> min_weights;
-  thrust::device_vector<edge_t> min_neighbors;
-  thrust::device_vector<int> super_vertices;
-  thrust::device_vector<bool> not_decremented;
+  gcuda::stream_t stream = this->get_single_context()->stream();
+
+  pooled_vector_t<vertex_t> roots{make_pooled_vector<vertex_t>(stream)};
+  pooled_vector_t<vertex_t> new_roots{make_pooled_vector<vertex_t>(stream)};
+  pooled_vector_t<weight_t> min_weights{make_pooled_vector<weight_t>(stream)};
+  pooled_vector_t<edge_t> min_neighbors{make_pooled_vector<edge_t>(stream)};
+  pooled_vector_t<int> super_vertices{make_pooled_vector<int>(stream)};
+  pooled_vector_t<bool> not_decremented{make_pooled_vector<bool>(stream)};
 
   void init() {
     roots.resize(n_vertices);
@@ -84,7 +84,9 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 };
 
-template <typename problem_t>
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context)
@@ -93,7 +95,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
-  using frontier_t = typename enactor_t<problem_t>::frontier_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
 
   void prepare_frontier(frontier_t* f,
                         gcuda::multi_context_t& context) override {
@@ -137,8 +139,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
     };
 
     // Execute advance operator on the provided lambda
-    operators::advance::execute<operators::load_balance_t::block_mapped>(
-        G, E, advance_op, context);
+    operators::advance::execute<lb>(G, E, advance_op, context);
 
     auto policy = this->context->get_context(0)->execution_policy();
     thrust::copy_n(policy, r_prime, n_vertices, r);
@@ -146,7 +147,9 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
 };  // struct enactor_t
 
-template <typename graph_t>
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename graph_t>
 float run(graph_t& G,
           typename graph_t::vertex_type& seed,
           typename graph_t::weight_type* p,
@@ -167,7 +170,7 @@ float run(graph_t& G,
   // </user-defined>
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   problem_type problem(G, param, result, context);
   problem.init();
@@ -178,27 +181,62 @@ float run(graph_t& G,
   // </boiler-plate>
 }
 
-template <typename graph_t>
-float run_batch(graph_t& G,
-                typename graph_t::vertex_type& n_seeds,
-                typename graph_t::weight_type* p,
-                typename graph_t::weight_type& alpha,
-                typename graph_t::weight_type& epsilon) {
-  // <user-defined>
+/**
+ * @brief Batch worker (@see operators::batch::pool_t) that runs personalized
+ * PageRank for one seed per job, writing `p + job * |V|`, and reuses its
+ * problem and enactor across jobs.
+ */
+template <operators::load_balance_t lb, typename graph_t>
+struct batch_worker_t {
   using vertex_t = typename graph_t::vertex_type;
   using weight_t = typename graph_t::weight_type;
 
-  auto n_vertices = G.get_number_of_vertices();
-  auto f = [&](std::size_t job) -> float {
-    vertex_t active_seed = job;
-    weight_t* _p = p + (n_vertices * active_seed);
-    return ppr::run(G, active_seed, _p, alpha, epsilon);
-  };
+  using param_type = param_t<vertex_t, weight_t>;
+  using result_type = result_t<weight_t>;
+  using problem_type = problem_t<graph_t, param_type, result_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
-  thrust::host_vector<float> total_elapsed(1);
-  operators::batch::execute(f, n_seeds, total_elapsed.data());
+  param_type param;
+  result_type result;
+  problem_type problem;
+  enactor_type enactor;
+  weight_t* p;
+
+  batch_worker_t(std::shared_ptr<gcuda::multi_context_t> context,
+                 graph_t& G,
+                 weight_t* _p,
+                 weight_t& alpha,
+                 weight_t& epsilon)
+      : param(0, alpha, epsilon),
+        result(_p),
+        problem(G, param, result, context),
+        enactor(&problem, context),
+        p(_p) {
+    problem.init();
+  }
+
+  float operator()(std::size_t job) {
+    auto n_vertices = problem.get_graph().get_number_of_vertices();
+    problem.param.seed = (vertex_t)job;
+    problem.result.p = p + (n_vertices * job);
+    problem.reset();
+    return enactor.enact();
+  }
+};
+
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename graph_t>
+float run_batch(graph_t& G,
+                typename graph_t::vertex_type& n_seeds,
+                typename graph_t::weight_type* p,
+                typename graph_t::weight_type& alpha,
+                typename graph_t::weight_type& epsilon,
+                std::size_t number_of_streams = 4) {
+  auto stats = operators::batch::execute<batch_worker_t<lb, graph_t>>(
+      n_seeds, number_of_streams, G, p, alpha, epsilon);
 
-  return total_elapsed[0];
+  return stats.total_elapsed;
 }
 
 }  // namespace ppr
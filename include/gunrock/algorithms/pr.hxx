@@ -10,6 +10,7 @@
 #pragma once
 
 #include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/incremental/pr.hxx>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/inner_product.h>
 
@@ -56,12 +57,14 @@ struct problem_t : gunrock::problem_t<graph_t> {
   thrust::device_vector<weight_t>
       iweights;  // alpha * 1 / (sum of outgoing weights) -- used to determine
                  // out of mass spread from src to dst
+  thrust::device_vector<weight_t> dsum;  // mass of the dangling nodes
 
   void init() override {
     auto g = this->get_graph();
     auto n_vertices = g.get_number_of_vertices();
     plast.resize(n_vertices);
     iweights.resize(n_vertices);
+    dsum.resize(1);
   }
 
   void reset() override {
@@ -106,6 +109,21 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
+
+  /*!
+   * Convergence flags of the last iterations (if not captured).
+   */
+  gcuda::lagged_readback_t<int> convergence;
+
+  /**
+   * @brief Every vertex is updated (the frontiers are self-managed), only the
+   * flags of a previous `enact()` are dropped.
+   */
+  void prepare_frontier(frontier_t* f,
+                        gcuda::multi_context_t& context) override {
+    convergence.reset();
+  }
 
   void loop(gcuda::multi_context_t& context) override {
 
@@ -126,21 +144,64 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     // >> handle "dangling nodes" (nodes w/ zero outdegree)
     // could skip this if no nodes have sero outdegree
-    auto compute_dangling = [=] __device__(const int& i) -> weight_t {
-      return iweights[i] == 0 ? alpha * p[i] : 0;
+    // The sum stays on the device, such that the iteration never synchronizes
+    // with the host (and can be captured, see `run()`).
+    auto dsum = P->dsum.data().get();
+    thrust::fill_n(policy, P->dsum.begin(), 1, (weight_t)0);
+
+    auto compute_dangling = [=] __device__(vertex_t const& i) -> void {
+      if (iweights[i] == 0)
+        math::atomic::add(dsum, alpha * p[i]);
     };
 
-    float dsum = thrust::transform_reduce(
-        policy, thrust::counting_iterator<vertex_t>(0),
-        thrust::counting_iterator<vertex_t>(n_vertices), compute_dangling,
-        (weight_t)0.0, thrust::plus<weight_t>());
+    operators::parallel_for::execute<operators::parallel_for_each_t::vertex>(
+        G, compute_dangling, context);
+
+    auto teleport = [=] __device__(vertex_t const& i) -> void {
+      p[i] = (1 - alpha + dsum[0]) / n_vertices;
+    };
 
-    thrust::fill_n(policy, p, n_vertices, (1 - alpha + dsum) / n_vertices);
+    operators::parallel_for::execute<operators::parallel_for_each_t::vertex>(
+        G, teleport, context);
     // -- OR --
     // skip dangling nodes
     // thrust::fill_n(policy,
     //   p, n_vertices, (1 - alpha) / n_vertices);
     // <<
+    spread(context);
+
+    // Flag (on the device) whether any vertex still changes by at least the
+    // tolerance, @see is_converged().
+    auto active = this->get_active_flag();
+    auto tol = P->param.tol;
+    auto not_converged = [=] __device__(vertex_t const& i) -> void {
+      if (!(abs(p[i] - plast[i]) < tol))
+        *active = 1;
+    };
+
+    thrust::fill_n(policy, thrust::device_pointer_cast(active), 1, 0);
+    operators::parallel_for::execute<operators::parallel_for_each_t::vertex>(
+        G, not_converged, context);
+
+    // Captured iterations read the flag back themselves.
+    if (!this->properties.capture_graph)
+      convergence.record(active, this->context->get_context(0)->stream());
+  }
+
+  /**
+   * @brief Spread `alpha` times the ranks of the last iteration along the
+   * outgoing edges (scatter over all edges with atomic adds), @see
+   * pull_enactor_t for the gather.
+   */
+  virtual void spread(gcuda::multi_context_t& context) {
+    auto E = this->get_enactor();
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+
+    auto p = P->result.p;
+    auto plast = P->plast.data().get();
+    auto iweights = P->iweights.data().get();
+
     auto spread_coo_op = [=] __device__(edge_t const& e) -> void {
       auto src = G.get_source_vertex(e);
       auto dst = G.get_destination_vertex(e);
@@ -173,38 +234,92 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
     // <<
   }
 
+  /**
+   * @brief Converged once an iteration changed no value by the tolerance or
+   * more. The flag is read back one iteration late (without waiting for the
+   * iteration in flight), at the cost of one extra iteration.
+   */
   virtual bool is_converged(gcuda::multi_context_t& context) {
-    if (this->iteration == 0)
+    niter = this->iteration;
+    if (!convergence.has_value(1))
       return false;
 
+    bool converged = (convergence.get(1) == 0);
+
+    #ifdef PRINT_NITER
+    if(converged)
+      std::cout << "niterations: " << this->iteration << std::endl;
+    #endif
+
+    return converged;
+  }
+
+  void finalize(gcuda::multi_context_t& context) override {
+    niter = this->iteration;
+  }
+
+};  // struct enactor_t
+
+/**
+ * @brief PageRank gathering the ranks over the incoming edges (a row-wise
+ * reduction of the CSC, without atomics), suited to dense iterations where
+ * most vertices change. The graph must have both a CSR (default, outgoing
+ * weights) and a CSC (incoming edges) view, e.g.
+ * `graph::build<space>(properties, csc, csr)`.
+ */
+template <typename problem_t>
+struct pull_enactor_t : enactor_t<problem_t> {
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+
+  using csc_v_t = graph::graph_csc_t<memory::memory_space_t::device,
+                                     vertex_t,
+                                     edge_t,
+                                     weight_t>;
+
+  /*!
+   * Gather kernel, chosen by the in-degrees (unless given), @see
+   * operators::neighborreduce::make_plan().
+   */
+  operators::neighborreduce::plan_t<vertex_t, edge_t, weight_t> plan;
+
+  pull_enactor_t(problem_t* _problem,
+                 std::shared_ptr<gcuda::multi_context_t> _context,
+                 enactor_properties_t _properties,
+                 operators::neighborreduce::kernel_t kernel =
+                     operators::neighborreduce::kernel_t::automatic)
+      : enactor_t<problem_t>(_problem, _context, _properties) {
+    auto G = _problem->get_graph();
+    plan = operators::neighborreduce::make_plan<weight_t>(
+        G.get_column_offsets(), G.get_number_of_vertices(),
+        G.get_number_of_edges(), *_context, kernel);
+  }
+
+  void spread(gcuda::multi_context_t& context) override {
     auto P = this->get_problem();
     auto G = P->get_graph();
-    auto tol = P->param.tol;
 
-    auto n_vertices = G.get_number_of_vertices();
     auto p = P->result.p;
     auto plast = P->plast.data().get();
+    auto iweights = P->iweights.data().get();
 
-    auto abs_diff = [=] __device__(const int& i) -> weight_t {
-      return abs(p[i] - plast[i]);
+    auto gather_op = [=] __device__(edge_t const& e) -> weight_t {
+      auto src = G.template get_source_vertex<csc_v_t>(e);
+      return plast[src] * iweights[src] *
+             G.template get_edge_weight<csc_v_t>(e);
+    };
+    auto plus = [] __device__(weight_t const& a, weight_t const& b) {
+      return a + b;
+    };
+    auto accumulate = [=] __device__(vertex_t const& v, weight_t const& sum) {
+      p[v] += sum;
     };
 
-    auto policy = this->context->get_context(0)->execution_policy();
-    float err = thrust::transform_reduce(
-        policy, thrust::counting_iterator<vertex_t>(0),
-        thrust::counting_iterator<vertex_t>(n_vertices), abs_diff,
-        (weight_t)0.0, thrust::maximum<weight_t>());
-
-    #ifdef PRINT_NITER
-    if(err < tol)
-      std::cout << "niterations: " << this->iteration << std::endl;
-    #endif
-    niter = this->iteration;
-
-    return err < tol;
+    operators::neighborreduce::execute(plan, gather_op, plus, weight_t(0),
+                                       accumulate, context);
   }
-
-};  // struct enactor_t
+};  // struct pull_enactor_t
 
 template <typename graph_t>
 float run(graph_t& G,
@@ -233,14 +348,92 @@ float run(graph_t& G,
   problem.init();
   problem.reset();
 
-  // Disable internal-frontiers:
+  // Disable internal-frontiers, and replay the (stream-ordered, fixed work)
+  // iteration as a CUDA graph:
   enactor_properties_t props;
   props.self_manage_frontiers = true;
+  props.capture_graph = true;
 
   enactor_type enactor(&problem, context, props);
   return enactor.enact();
   // </boiler-plate>
 }
 
+/**
+ * @brief PageRank pushing residuals (@see incremental::pr::state_t), only the
+ * vertices whose residual exceeds `tol / |V|` are advanced in an iteration,
+ * such that the work shrinks as vertices converge. The result matches `run()`
+ * (dangling vertices spread their rank uniformly) within `tol / (1 - alpha)`
+ * in L1.
+ *
+ * @param G Graph.
+ * @param alpha Damping factor.
+ * @param tol Residual tolerance (summed over the vertices).
+ * @param p Output PageRank (device, |V|).
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <typename graph_t>
+float run_push(graph_t& G,
+               typename graph_t::weight_type alpha,
+               typename graph_t::weight_type tol,
+               typename graph_t::weight_type* p,  // Output
+               std::shared_ptr<gcuda::multi_context_t> context =
+                   std::shared_ptr<gcuda::multi_context_t>(
+                       new gcuda::multi_context_t(0))  // Context
+) {
+  incremental::pr::state_t<typename graph_t::weight_type> state(alpha, tol);
+  return incremental::pr::run(G, state, p, context);
+}
+
+/**
+ * @brief Power-iteration PageRank gathering over the incoming edges, @see
+ * pull_enactor_t. G must have a CSR and a CSC view.
+ *
+ * @param G Graph (CSR and CSC).
+ * @param alpha Damping factor.
+ * @param tol Tolerance on the change of any rank.
+ * @param p Output PageRank (device, |V|).
+ * @param kernel Gather kernel (chosen by the in-degrees if
+ * `kernel_t::automatic`), @see operators::neighborreduce::make_plan().
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <typename graph_t>
+float run_pull(graph_t& G,
+               typename graph_t::weight_type alpha,
+               typename graph_t::weight_type tol,
+               typename graph_t::weight_type* p,  // Output
+               operators::neighborreduce::kernel_t kernel =
+                   operators::neighborreduce::kernel_t::automatic,
+               std::shared_ptr<gcuda::multi_context_t> context =
+                   std::shared_ptr<gcuda::multi_context_t>(
+                       new gcuda::multi_context_t(0))  // Context
+) {
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = param_t<weight_t>;
+  using result_type = result_t<weight_t>;
+
+  param_type param(alpha, tol);
+  result_type result(p);
+
+  using problem_type = problem_t<graph_t, param_type, result_type>;
+  using enactor_type = pull_enactor_t<problem_type>;
+
+  problem_type problem(G, param, result, context);
+  problem.init();
+  problem.reset();
+
+  // As in `run()`, the iteration is fixed work and is captured (the gather's
+  // scratch lives in the plan).
+  enactor_properties_t props;
+  props.self_manage_frontiers = true;
+  props.capture_graph = true;
+
+  enactor_type enactor(&problem, context, props, kernel);
+  return enactor.enact();
+}
+
 }  // namespace pr
 }  // namespace gunrock
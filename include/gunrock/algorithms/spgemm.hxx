@@ -13,9 +13,16 @@
 
 #include <gunrock/algorithms/algorithms.hxx>
 
-// Thrust includes (scan, reduce)
+// Thrust includes (scan, reduce, sort)
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/reduce.h>
 #include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/unique.h>
+
+#include <cstdint>
 
 namespace gunrock {
 namespace spgemm {
@@ -33,6 +40,220 @@ struct result_t {
   result_t(csr_t& _C) : C(_C) {}
 };
 
+namespace kernels {
+
+constexpr int block_size = 256;
+
+/*!
+ * Static shared memory of a block.
+ */
+constexpr std::size_t shared_memory_bytes = 48 * 1024;
+
+/**
+ * @brief Insert `key` in an open-addressing (linear probing) hash table of
+ * `mask + 1` slots.
+ *
+ * @return std::size_t slot of the key, `inserted` is set if it was new.
+ */
+template <typename vertex_t>
+__device__ __forceinline__ std::size_t insert(vertex_t* keys,
+                                              std::size_t mask,
+                                              vertex_t key,
+                                              bool& inserted) {
+  vertex_t const empty = gunrock::numeric_limits<vertex_t>::invalid();
+  std::size_t slot = (std::size_t(key) * 2654435761u) & mask;
+  while (true) {
+    vertex_t old = math::atomic::cas(keys + slot, empty, key);
+    if (old == empty || old == key) {
+      inserted = (old == empty);
+      return slot;
+    }
+    slot = (slot + 1) & mask;
+  }
+}
+
+/**
+ * @brief Multiply a row of A with B: the products are hashed by column, and
+ * counted (symbolic) or accumulated (numeric). The `size` threads of a row
+ * walk the row of A in order and share the rows of B.
+ */
+template <bool numeric,
+          typename b_view_t,
+          typename a_graph_t,
+          typename b_graph_t,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+__device__ __forceinline__ void multiply_row(a_graph_t const& A,
+                                             b_graph_t const& B,
+                                             vertex_t row,
+                                             int rank,
+                                             int size,
+                                             vertex_t* keys,
+                                             weight_t* values,
+                                             std::size_t mask,
+                                             edge_t* count) {
+  edge_t a_begin = A.get_starting_edge(row);
+  edge_t a_end = a_begin + A.get_number_of_neighbors(row);
+  for (edge_t a = a_begin; a < a_end; ++a) {
+    vertex_t k = A.get_destination_vertex(a);
+    weight_t a_nz = A.get_edge_weight(a);
+    edge_t b_begin = B.template get_starting_edge<b_view_t>(k);
+    edge_t b_end = b_begin + B.template get_number_of_neighbors<b_view_t>(k);
+    for (edge_t b = b_begin + rank; b < b_end; b += size) {
+      vertex_t column = B.template get_destination_vertex<b_view_t>(b);
+      bool inserted;
+      std::size_t slot = insert(keys, mask, column, inserted);
+      if constexpr (numeric)
+        math::atomic::add(values + slot,
+                          a_nz * B.template get_edge_weight<b_view_t>(b));
+      else if (inserted)
+        math::atomic::add(count, edge_t(1));
+    }
+  }
+}
+
+/**
+ * @brief Rows of C with at most `table_size / 2` products, `threads_per_row`
+ * threads per row and a hash table per row in shared memory. The symbolic
+ * pass counts the nonzeros of each row, the numeric pass sorts the table by
+ * key (bitonic, the empty slots last) and writes its first entries, the row
+ * sorted by column.
+ */
+template <int table_size,
+          int threads_per_row,
+          bool numeric,
+          typename b_view_t,
+          typename a_graph_t,
+          typename b_graph_t,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+__global__ void __launch_bounds__(block_size)
+    shared_rows(a_graph_t A,
+                b_graph_t B,
+                vertex_t const* rows,
+                std::size_t number_of_rows,
+                edge_t* row_nonzeros,
+                edge_t const* c_offsets,
+                vertex_t* c_columns,
+                weight_t* c_values) {
+  constexpr int rows_per_block = block_size / threads_per_row;
+  constexpr int value_slots = numeric ? table_size : 1;
+  __shared__ vertex_t keys[rows_per_block][table_size];
+  __shared__ weight_t values[rows_per_block][value_slots];
+  __shared__ edge_t counts[rows_per_block];
+  static_assert(sizeof(keys) + sizeof(values) + sizeof(counts) <=
+                    shared_memory_bytes,
+                "The hash tables of a block exceed its static shared memory.");
+  static_assert((table_size & (table_size - 1)) == 0,
+                "The hash table size must be a power of two.");
+
+  vertex_t const empty = gunrock::numeric_limits<vertex_t>::invalid();
+  int group = threadIdx.x / threads_per_row;
+  int rank = threadIdx.x % threads_per_row;
+  std::size_t index = std::size_t(blockIdx.x) * rows_per_block + group;
+  bool valid = index < number_of_rows;
+  vertex_t row = valid ? rows[index] : 0;
+
+  for (int i = rank; i < table_size; i += threads_per_row) {
+    keys[group][i] = empty;
+    if constexpr (numeric)
+      values[group][i] = 0;
+  }
+  if (rank == 0)
+    counts[group] = 0;
+  __syncthreads();
+
+  if (valid)
+    multiply_row<numeric, b_view_t>(A, B, row, rank, threads_per_row,
+                                    keys[group], values[group],
+                                    table_size - 1, counts + group);
+  __syncthreads();
+
+  if constexpr (!numeric) {
+    if (valid && rank == 0)
+      row_nonzeros[row] = counts[group];
+  } else {
+    // Bitonic sort of every table of the block (the keys are distinct, the
+    // empty slots compare greater than any key), all the threads take part.
+    auto before = [empty](vertex_t const& a, vertex_t const& b) {
+      return (a != empty) && ((b == empty) || (a < b));
+    };
+    for (int k = 2; k <= table_size; k <<= 1) {
+      for (int j = k >> 1; j > 0; j >>= 1) {
+        for (int i = rank; i < table_size; i += threads_per_row) {
+          int partner = i ^ j;
+          if (partner < i)
+            continue;
+          vertex_t a = keys[group][i];
+          vertex_t b = keys[group][partner];
+          if (((i & k) == 0) ? before(b, a) : before(a, b)) {
+            keys[group][i] = b;
+            keys[group][partner] = a;
+            weight_t value = values[group][i];
+            values[group][i] = values[group][partner];
+            values[group][partner] = value;
+          }
+        }
+        __syncthreads();
+      }
+    }
+
+    if (!valid)
+      return;
+
+    edge_t offset = c_offsets[row];
+    edge_t nonzeros = c_offsets[row + 1] - offset;
+    for (int i = rank; i < nonzeros; i += threads_per_row) {
+      c_columns[offset + i] = keys[group][i];
+      c_values[offset + i] = values[group][i];
+    }
+  }
+}
+
+/**
+ * @brief Expand the products of (a batch of) rows of C, one block per row,
+ * keyed by (row in the batch, column) for expand-sort-compress.
+ */
+template <typename b_view_t,
+          typename a_graph_t,
+          typename b_graph_t,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+__global__ void __launch_bounds__(block_size)
+    expand_rows(a_graph_t A,
+                b_graph_t B,
+                vertex_t const* rows,
+                edge_t const* offsets,
+                std::uint64_t* keys,
+                weight_t* values) {
+  vertex_t row = rows[blockIdx.x];
+  std::uint64_t high = std::uint64_t(blockIdx.x) << 32;
+  edge_t position = offsets[blockIdx.x];
+
+  edge_t a_begin = A.get_starting_edge(row);
+  edge_t a_end = a_begin + A.get_number_of_neighbors(row);
+  for (edge_t a = a_begin; a < a_end; ++a) {
+    vertex_t k = A.get_destination_vertex(a);
+    weight_t a_nz = A.get_edge_weight(a);
+    edge_t b_begin = B.template get_starting_edge<b_view_t>(k);
+    edge_t b_length = B.template get_number_of_neighbors<b_view_t>(k);
+    for (edge_t b = threadIdx.x; b < b_length; b += block_size) {
+      vertex_t column =
+          B.template get_destination_vertex<b_view_t>(b_begin + b);
+      keys[position + b] = high | std::uint32_t(column);
+      if (values)
+        values[position + b] =
+            a_nz * B.template get_edge_weight<b_view_t>(b_begin + b);
+    }
+    position += b_length;
+  }
+}
+
+}  // namespace kernels
+
 template <typename graph_t, typename param_type, typename result_type>
 struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
@@ -50,24 +271,36 @@ struct problem_t : gunrock::problem_t<graph_t> {
         param(_param),
         result(_result) {}
 
+  /*!
+   * Number of products (upper bound of the nonzeros) of each row of C.
+   */
   thrust::device_vector<edge_t> estimated_nz_per_row;
-  thrust::host_vector<edge_t> nnz;
+
+  /*!
+   * Exact number of nonzeros of each row of C (and a trailing 0, such that
+   * its exclusive scan are the row offsets).
+   */
+  thrust::device_vector<edge_t> nz_per_row;
+
+  /*!
+   * Rows of C, grouped by bin (@see enactor_t::bin_of()), and the first row
+   * of every bin.
+   */
+  thrust::device_vector<vertex_t> binned_rows;
+  thrust::host_vector<std::size_t> bin_offsets;
 
   void init() override {
     auto& A = this->param.A;
-    // auto& C = this->result.C;
-
     estimated_nz_per_row.resize(A.get_number_of_vertices());
-    nnz.resize(1);
+    nz_per_row.resize(A.get_number_of_vertices() + 1);
+    binned_rows.resize(A.get_number_of_vertices());
   }
 
   void reset() override {
     auto policy = this->context->get_context(0)->execution_policy();
     thrust::fill(policy, estimated_nz_per_row.begin(),
                  estimated_nz_per_row.end(), 0);
-
-    // Reset NNZ.
-    nnz[0] = 0;
+    thrust::fill(policy, nz_per_row.begin(), nz_per_row.end(), 0);
 
     // Reset sparse-matrix C.
     auto& C = this->result.C;
@@ -77,7 +310,22 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 };
 
-template <typename problem_t>
+/**
+ * @brief Row-wise (Gustavson) SpGEMM, in two passes over the rows of C binned
+ * by their number of products (the upper bound of their nonzeros).
+ *
+ * @par Overview
+ * The symbolic pass counts the exact nonzeros of every row, such that C is
+ * allocated once to its exact size; the numeric pass then computes the rows,
+ * sorted by column. Rows of up to `max_shared_products` products hash their
+ * products by column in shared memory (four table sizes, from 8 to 256 threads
+ * per row). Longer
+ * rows are expanded, sorted and compressed (ESC) in batches of about
+ * `esc_batch_products` products, which bounds the temporary memory.
+ */
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context,
@@ -90,186 +338,272 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
   using csr_v_t = graph::
       graph_csr_t<memory::memory_space_t::device, vertex_t, edge_t, weight_t>;
-  using csc_v_t = graph::
-      graph_csc_t<memory::memory_space_t::device, vertex_t, edge_t, weight_t>;
+
+  /*!
+   * Products expanded at once by the ESC bins (at least one row).
+   */
+  static constexpr std::size_t esc_batch_products = std::size_t(1) << 22;
+
+  /*!
+   * Products of the largest shared memory bin, whose hash table (twice as many
+   * slots, one row per block) must fit the static shared memory of a block.
+   */
+  static constexpr int max_shared_products =
+      (2 * 2048 * (sizeof(vertex_t) + sizeof(weight_t)) + sizeof(edge_t) <=
+       kernels::shared_memory_bytes)
+          ? 2048
+          : 1024;
+
+  /*!
+   * Bins: empty rows, four shared memory hash table sizes, and ESC.
+   */
+  static constexpr int number_of_bins = 6;
+  static constexpr int esc_bin = number_of_bins - 1;
+
+  __host__ __device__ static int bin_of(edge_t products) {
+    return (products == 0)                      ? 0
+           : (products <= 32)                    ? 1
+           : (products <= 128)                   ? 2
+           : (products <= 512)                   ? 3
+           : (products <= max_shared_products)   ? 4
+                                                 : esc_bin;
+  }
 
   void loop(gcuda::multi_context_t& context) override {
     auto E = this->get_enactor();
     auto P = this->get_problem();
-
     auto policy = this->context->get_context(0)->execution_policy();
 
     auto& A = P->param.A;
     auto& B = P->param.B;
     auto& C = P->result.C;
 
-    auto& row_offsets = C.row_offsets;
-    auto& column_indices = C.column_indices;
-    auto& nonzero_values = C.nonzero_values;
-
-    auto& estimated_nz_per_row = P->estimated_nz_per_row;
-    auto estimated_nz_ptr = estimated_nz_per_row.data().get();
-
-    // Resize row-offsets.
-    row_offsets.resize(A.get_number_of_vertices() + 1);
-
-    thrust::fill(policy, estimated_nz_per_row.begin(),
-                 estimated_nz_per_row.end(), 0);
+    auto estimated_nz_ptr = P->estimated_nz_per_row.data().get();
+    vertex_t n_rows = A.get_number_of_vertices();
 
-    /// Step 1. Count the upperbound of number of nonzeros per row of C.
+    /// Step 1. Count the products (upper bound of the nonzeros) per row of C.
     auto upperbound_nonzeros =
         [=] __host__ __device__(vertex_t const& m,  // ... source (row index)
                                 vertex_t const& k,  // neighbor (column index)
                                 edge_t const& nz_idx,  // edge (row ↦ column)
                                 weight_t const& nz     // weight (nonzero).
                                 ) -> bool {
-      // Compute number of nonzeros of the sparse-matrix C for each row.
       math::atomic::add(&(estimated_nz_ptr[m]),
                         B.template get_number_of_neighbors<csr_v_t>(k));
       return false;
     };
 
-    operators::advance::execute<operators::load_balance_t::block_mapped,
+    operators::advance::execute<lb,
                                 operators::advance_direction_t::forward,
                                 operators::advance_io_type_t::graph,
                                 operators::advance_io_type_t::none>(
         A, E, upperbound_nonzeros, context);
 
-    /// Step X. Calculate upperbound of C's row-offsets.
-    thrust::exclusive_scan(policy, P->estimated_nz_per_row.begin(),
-                           P->estimated_nz_per_row.end() + 1,
-                           row_offsets.begin(), edge_t(0),
-                           thrust::plus<edge_t>());
-
-    /// Step X. Calculate the upperbound of total number of nonzeros in the
-    /// sparse-matrix C.
-    thrust::copy(row_offsets.begin() + A.get_number_of_vertices(),
-                 row_offsets.begin() + A.get_number_of_vertices() + 1,
-                 P->nnz.begin());
-
-    edge_t estimated_nzs = P->nnz[0];
-
-    /// Step . Allocate upperbound memory for C's values and column indices.
-    column_indices.resize(estimated_nzs, -1);
-    nonzero_values.resize(estimated_nzs, weight_t(0));
-
-    edge_t* row_off = row_offsets.data().get();
-    vertex_t* col_ind = column_indices.data().get();
-    weight_t* nz_vals = nonzero_values.data().get();
-
-    /// Step X. Calculate C's column indices and values.
-    auto naive_spgemm = [=] __host__ __device__(vertex_t const& row) -> bool {
-      // Get the number of nonzeros in row of sparse-matrix A.
-      auto a_offset = A.get_starting_edge(row);
-      auto a_nnz = A.get_number_of_neighbors(row);
-      auto c_offset = thread::load(&row_off[row]);
-      auto n = 0;
-      bool increment = false;
-
-      // Iterate over the columns of B.
-      for (edge_t b_col = 0;
-           b_col < B.template get_number_of_vertices<csc_v_t>(); ++b_col) {
-        // Get the number of nonzeros in column of sparse-matrix B.
-        auto b_offset = B.template get_starting_edge<csc_v_t>(b_col);
-        auto b_nnz = B.template get_number_of_neighbors<csc_v_t>(b_col);
-        auto b_nz_idx = b_offset;
-        auto a_nz_idx = a_offset;
-
-        // For the row in A, multiple with corresponding element in B.
-        while ((a_nz_idx < (a_offset + a_nnz)) &&
-               (b_nz_idx < (b_offset + b_nnz))) {
-          auto a_col = A.get_destination_vertex(a_nz_idx);
-          auto b_row = B.template get_source_vertex<csc_v_t>(b_nz_idx);
-
-          //  Multiply if the column of A equals row of B.
-          if (a_col == b_row) {
-            auto a_nz = A.get_edge_weight(a_nz_idx);
-            auto b_nz = B.template get_edge_weight<csc_v_t>(b_nz_idx);
-
-            // Calculate  C's nonzero index.
-            std::size_t c_nz_idx = c_offset + n;
-            assert(c_nz_idx < estimated_nzs);
-
-            // Assign column index.
-            thread::store(&col_ind[c_nz_idx], n);
-
-            // Accumulate the nonzero value.
-            nz_vals[c_nz_idx] += a_nz * b_nz;
-
-            a_nz_idx++;
-            b_nz_idx++;
-
-            increment = true;
-          } else if (a_col < b_row)
-            a_nz_idx++;
-          else
-            b_nz_idx++;
-        }
-        // A non zero element was stored in C, so we increment n.
-        if (increment) {
-          n++;
-          increment = false;
-        }
-      }
-      return false;
-    };
+    /// Step 2. Bin the rows by their number of products.
+    bin_rows(context);
 
-    operators::parallel_for::execute<operators::parallel_for_each_t::vertex>(
-        A, naive_spgemm, context);
-
-    /// Step X. Fix-up, i.e., remove overestimated nonzeros and rellocate the
-    /// storage as necessary.
-    auto real_nonzeros = [=] __host__ __device__(vertex_t const& row) -> void {
-      edge_t overestimated_nzs = 0;
-      // For all nonzeros within the row of C.
-      for (auto nz = row_off[row]; nz < row_off[row + 1]; ++nz) {
-        // Find the invalid column indices and zero-values, they represent
-        // overestimated nonzeros.
-        if (col_ind[nz] == -1)
-          overestimated_nzs += 1;
-      }
-      // Remove overestimated nonzeros.
-      estimated_nz_ptr[row] -= overestimated_nzs;
-    };
-
-    operators::parallel_for::execute<operators::parallel_for_each_t::vertex>(
-        A, real_nonzeros, context);
+    /// Step 3. Symbolic: the exact number of nonzeros per row, and C's
+    /// row offsets.
+    multiply<false>(context);
 
-    thrust::exclusive_scan(policy, P->estimated_nz_per_row.begin(),
-                           P->estimated_nz_per_row.end(), row_offsets.begin(),
+    auto& row_offsets = C.row_offsets;
+    row_offsets.resize(n_rows + 1);
+    thrust::exclusive_scan(policy, P->nz_per_row.begin(),
+                           P->nz_per_row.end(), row_offsets.begin(),
                            edge_t(0), thrust::plus<edge_t>());
+    context.get_context(0)->synchronize();
+    edge_t nonzeros = row_offsets[n_rows];
 
-    thrust::copy(row_offsets.begin() + A.get_number_of_vertices() - 1,
-                 row_offsets.begin() + A.get_number_of_vertices(),
-                 row_offsets.begin() + A.get_number_of_vertices());
+    /// Step 4. Numeric: allocate (exactly) and compute C.
+    C.column_indices.resize(nonzeros);
+    C.nonzero_values.resize(nonzeros);
+    multiply<true>(context);
 
-    /// Step X. Calculate the upperbound of total number of nonzeros in the
-    /// sparse-matrix C.
-    thrust::copy(row_offsets.begin() + A.get_number_of_vertices(),
-                 row_offsets.begin() + A.get_number_of_vertices() + 1,
-                 P->nnz.begin());
+    C.number_of_rows = n_rows;
+    C.number_of_columns = B.get_number_of_vertices();
+    C.number_of_nonzeros = nonzeros;
+  }
 
-    auto itc = thrust::copy_if(
-        policy, column_indices.begin(), column_indices.end(),
-        column_indices.begin(),
-        [] __device__(const vertex_t& x) -> bool { return x != -1; });
+  /**
+   * @brief Group the rows of C by bin, @see bin_of().
+   */
+  void bin_rows(gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    auto policy = this->context->get_context(0)->execution_policy();
+    vertex_t n_rows = P->param.A.get_number_of_vertices();
+
+    auto bins =
+        make_pooled_vector<int>(context.get_context(0)->stream(), n_rows);
+    thrust::transform(policy, P->estimated_nz_per_row.begin(),
+                      P->estimated_nz_per_row.end(), bins.begin(),
+                      [] __device__(edge_t const& products) {
+                        return bin_of(products);
+                      });
+    thrust::sequence(policy, P->binned_rows.begin(), P->binned_rows.end());
+    thrust::stable_sort_by_key(policy, bins.begin(), bins.end(),
+                               P->binned_rows.begin());
+
+    thrust::device_vector<std::size_t> offsets(number_of_bins + 1);
+    thrust::lower_bound(policy, bins.begin(), bins.end(),
+                        thrust::counting_iterator<int>(0),
+                        thrust::counting_iterator<int>(number_of_bins + 1),
+                        offsets.begin());
+    // (Copies to the host are not ordered after the context's stream.)
+    context.get_context(0)->synchronize();
+    P->bin_offsets = offsets;
+  }
 
-    auto itv = thrust::copy_if(policy, nonzero_values.begin(),
-                               nonzero_values.end(), nonzero_values.begin(),
-                               [] __device__(const weight_t& nz) -> bool {
-                                 return nz != weight_t(0);
-                               });
+  /**
+   * @brief Symbolic (count the nonzeros per row) or numeric (compute the
+   * rows) pass over the non-empty bins.
+   */
+  template <bool numeric>
+  void multiply(gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    auto& bin_offsets = P->bin_offsets;
+
+    launch_shared<32 * 2, 8, numeric>(bin_offsets[1], bin_offsets[2], context);
+    launch_shared<128 * 2, 32, numeric>(bin_offsets[2], bin_offsets[3],
+                                        context);
+    launch_shared<512 * 2, 128, numeric>(bin_offsets[3], bin_offsets[4],
+                                         context);
+    launch_shared<max_shared_products * 2, 256, numeric>(
+        bin_offsets[4], bin_offsets[5], context);
+
+    // ESC, in batches of rows with a bounded number of products.
+    std::size_t first = bin_offsets[esc_bin];
+    std::size_t last = bin_offsets[esc_bin + 1];
+    if (first == last)
+      return;
 
-    auto idx_nnz = thrust::distance(column_indices.begin(), itc);
-    auto nz_nnz = thrust::distance(nonzero_values.begin(), itv);
+    auto policy = this->context->get_context(0)->execution_policy();
+    auto estimated_nz_ptr = P->estimated_nz_per_row.data().get();
+    thrust::device_vector<edge_t> d_products(last - first);
+    thrust::transform(policy, P->binned_rows.begin() + first,
+                      P->binned_rows.begin() + last, d_products.begin(),
+                      [=] __device__(vertex_t const& row) {
+                        return estimated_nz_ptr[row];
+                      });
+    context.get_context(0)->synchronize();
+    thrust::host_vector<edge_t> products = d_products;
+
+    while (first < last) {
+      std::size_t end = first;
+      std::size_t batch = 0;
+      do {
+        batch += products[end - bin_offsets[esc_bin]];
+        ++end;
+      } while (end < last &&
+               batch + products[end - bin_offsets[esc_bin]] <=
+                   esc_batch_products);
+      esc<numeric>(first, end, context);
+      first = end;
+    }
+  }
 
-    std::cout << "idx_nnz ? nz_nnz : " << idx_nnz << " ? " << nz_nnz
-              << std::endl;
+  /**
+   * @brief Launch the shared memory hash kernel on the binned rows
+   * [first, last).
+   */
+  template <int table_size, int threads_per_row, bool numeric>
+  void launch_shared(std::size_t first,
+                     std::size_t last,
+                     gcuda::multi_context_t& context) {
+    if (first == last)
+      return;
+    auto P = this->get_problem();
+    auto& C = P->result.C;
+    auto stream = context.get_context(0)->stream();
+
+    constexpr int rows_per_block = kernels::block_size / threads_per_row;
+    std::size_t n = last - first;
+    std::size_t blocks = (n + rows_per_block - 1) / rows_per_block;
+    kernels::shared_rows<table_size, threads_per_row, numeric, csr_v_t>
+        <<<blocks, kernels::block_size, 0, stream>>>(
+            P->param.A, P->param.B, P->binned_rows.data().get() + first, n,
+            P->nz_per_row.data().get(), C.row_offsets.data().get(),
+            C.column_indices.data().get(), C.nonzero_values.data().get());
+  }
 
-    /// Step X. Make sure C is set.
-    C.number_of_rows = A.get_number_of_vertices();
-    C.number_of_columns = B.get_number_of_vertices();
-    C.number_of_nonzeros = P->nnz[0];
+  /**
+   * @brief Expand-sort-compress the binned rows [first, last): the symbolic
+   * pass counts the distinct (row, column) keys, the numeric pass reduces the
+   * values by key and scatters them to C (sorted by column).
+   */
+  template <bool numeric>
+  void esc(std::size_t first,
+           std::size_t last,
+           gcuda::multi_context_t& context) {
+    auto P = this->get_problem();
+    auto& C = P->result.C;
+    auto policy = this->context->get_context(0)->execution_policy();
+    auto stream = context.get_context(0)->stream();
+
+    std::size_t n = last - first;
+    vertex_t const* rows = P->binned_rows.data().get() + first;
+    auto estimated_nz_ptr = P->estimated_nz_per_row.data().get();
+    auto nz_ptr = P->nz_per_row.data().get();
+
+    // Offsets of the rows' products (numeric: nonzeros) in the batch.
+    auto offsets = make_pooled_vector<edge_t>(stream, n + 1, 0);
+    auto nz_offsets = make_pooled_vector<edge_t>(stream, n + 1, 0);
+    thrust::transform(policy, rows, rows + n, offsets.begin(),
+                      [=] __device__(vertex_t const& row) {
+                        return estimated_nz_ptr[row];
+                      });
+    thrust::exclusive_scan(policy, offsets.begin(), offsets.end(),
+                           offsets.begin());
+    context.get_context(0)->synchronize();
+    edge_t products = offsets[n];
+
+    auto keys = make_pooled_vector<std::uint64_t>(stream, products);
+    auto values = make_pooled_vector<weight_t>(stream, numeric ? products : 0);
+    kernels::expand_rows<csr_v_t><<<n, kernels::block_size, 0, stream>>>(
+        P->param.A, P->param.B, rows, offsets.data().get(),
+        keys.data().get(), numeric ? values.data().get() : nullptr);
+
+    // (Not `if constexpr`, extended lambdas can't be defined in one.)
+    if (!numeric) {
+      thrust::sort(policy, keys.begin(), keys.end());
+      auto end = thrust::unique(policy, keys.begin(), keys.end());
+      thrust::for_each(policy, keys.begin(), end,
+                       [=] __device__(std::uint64_t const& key) {
+                         math::atomic::add(nz_ptr + rows[key >> 32],
+                                           edge_t(1));
+                       });
+    } else {
+      thrust::sort_by_key(policy, keys.begin(), keys.end(), values.begin());
+
+      thrust::transform(policy, rows, rows + n, nz_offsets.begin(),
+                        [=] __device__(vertex_t const& row) {
+                          return nz_ptr[row];
+                        });
+      thrust::exclusive_scan(policy, nz_offsets.begin(), nz_offsets.end(),
+                             nz_offsets.begin());
+      context.get_context(0)->synchronize();
+      edge_t nonzeros = nz_offsets[n];
+
+      auto unique_keys = make_pooled_vector<std::uint64_t>(stream, nonzeros);
+      auto sums = make_pooled_vector<weight_t>(stream, nonzeros);
+      thrust::reduce_by_key(policy, keys.begin(), keys.end(), values.begin(),
+                            unique_keys.begin(), sums.begin());
+
+      auto c_offsets = C.row_offsets.data().get();
+      auto c_columns = C.column_indices.data().get();
+      auto c_values = C.nonzero_values.data().get();
+      auto batch_offsets = nz_offsets.data().get();
+      auto d_keys = unique_keys.data().get();
+      auto d_sums = sums.data().get();
+      thrust::for_each_n(
+          policy, thrust::counting_iterator<edge_t>(0), nonzeros,
+          [=] __device__(edge_t const& i) {
+            std::size_t local = d_keys[i] >> 32;
+            edge_t position =
+                c_offsets[rows[local]] + (i - batch_offsets[local]);
+            c_columns[position] = vertex_t(d_keys[i] & 0xffffffff);
+            c_values[position] = d_sums[i];
+          });
+    }
   }
 
   /**
@@ -283,7 +617,9 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   }
 };  // struct enactor_t
 
-template <typename a_graph_t, typename b_graph_t, typename csr_t>
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename a_graph_t, typename b_graph_t, typename csr_t>
 float run(a_graph_t& A,
           b_graph_t& B,
           csr_t& C,
@@ -298,7 +634,7 @@ float run(a_graph_t& A,
   result_type result(C);
 
   using problem_type = problem_t<a_graph_t, param_type, result_type>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   problem_type problem(A, param, result, context);
   problem.init();
@@ -13,6 +13,9 @@
 
 #include <gunrock/algorithms/algorithms.hxx>
 
+#include <cuda_fp16.h>
+#include <cuda_bf16.h>
+
 namespace gunrock {
 namespace spmv {
 
@@ -57,7 +60,9 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 };
 
-template <typename problem_t>
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context,
@@ -96,7 +101,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     // Perform advance on the above lambda-op
     operators::advance::execute<
-        operators::load_balance_t::block_mapped,
+        lb,
         operators::advance_direction_t::forward,  // direction (backward for
                                                   // transpose)
         operators::advance_io_type_t::graph,      // entire graph as input
@@ -131,7 +136,96 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   }
 };  // struct enactor_t
 
-template <typename graph_t>
+/**
+ * @brief Nonzero values stored as `value_t` (for example, `__half` or
+ * `__nv_bfloat16`, converted once from the graph's weights), and the type they
+ * are accumulated in: fp32 for the reduced-precision types.
+ */
+template <typename graph_t, typename param_type, typename result_type,
+          typename value_t>
+struct pull_problem_t : problem_t<graph_t, param_type, result_type> {
+  using base_t = problem_t<graph_t, param_type, result_type>;
+  using weight_t = typename base_t::weight_t;
+  using value_type = value_t;
+  using accumulate_t =
+      std::conditional_t<(sizeof(value_t) < sizeof(float)), float, weight_t>;
+
+  pull_problem_t(graph_t& G,
+                 param_type& _param,
+                 result_type& _result,
+                 std::shared_ptr<gcuda::multi_context_t> _context,
+                 operators::neighborreduce::kernel_t _kernel)
+      : base_t(G, _param, _result, _context), kernel(_kernel) {}
+
+  operators::neighborreduce::kernel_t kernel;
+  operators::neighborreduce::plan_t<typename base_t::vertex_t,
+                                    typename base_t::edge_t,
+                                    accumulate_t>
+      plan;
+  thrust::device_vector<value_t> values;
+
+  value_t const* get_values() {
+    if constexpr (std::is_same_v<value_t, weight_t>)
+      return this->get_graph().get_nonzero_values();
+    else
+      return values.data().get();
+  }
+
+  void init() override {
+    auto G = this->get_graph();
+    plan = operators::neighborreduce::make_plan<accumulate_t>(
+        G, *(this->context), kernel);
+    if constexpr (!std::is_same_v<value_t, weight_t>) {
+      auto policy = this->context->get_context(0)->execution_policy();
+      auto w = G.get_nonzero_values();
+      values.resize(G.get_number_of_edges());
+      thrust::copy(policy, w, w + G.get_number_of_edges(), values.begin());
+    }
+  }
+};
+
+/**
+ * @brief SpMV by rows (`y[row] = sum(A[row, :] * x)`, no atomics), with the
+ * neighborreduce kernel chosen for the graph's row lengths. @see
+ * operators::neighborreduce::make_plan()
+ */
+template <typename problem_t>
+struct pull_enactor_t : enactor_t<problem_t> {
+  using enactor_t<problem_t>::enactor_t;
+
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using value_t = typename problem_t::value_type;
+  using accumulate_t = typename problem_t::accumulate_t;
+
+  void loop(gcuda::multi_context_t& context) override {
+    auto P = this->get_problem();
+    auto G = P->get_graph();
+
+    auto y = P->result.y;
+    auto x = P->param.x;
+    auto values = P->get_values();
+
+    auto multiply = [=] __device__(edge_t const& e) -> accumulate_t {
+      vertex_t neighbor = G.get_destination_vertex(e);
+      return accumulate_t(values[e]) * accumulate_t(thread::load(&x[neighbor]));
+    };
+    auto plus = [] __device__(accumulate_t const& a, accumulate_t const& b) {
+      return a + b;
+    };
+    auto store = [=] __device__(vertex_t const& row, accumulate_t const& sum) {
+      y[row] = weight_t(sum);
+    };
+
+    operators::neighborreduce::execute(P->plan, multiply, plus,
+                                       accumulate_t(0), store, context);
+  }
+};  // struct pull_enactor_t
+
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename graph_t>
 float run(graph_t& G,
           typename graph_t::weight_type* x,  // Input vector
           typename graph_t::weight_type* y,  // Output vector
@@ -150,7 +244,7 @@ float run(graph_t& G,
   // </user-defined>
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   problem_type problem(G, param, result, context);
   problem.init();
@@ -165,5 +259,59 @@ float run(graph_t& G,
   // </boiler-plate>
 }
 
+/**
+ * @brief SpMV by rows, @see pull_enactor_t.
+ *
+ * @tparam value_t storage type of the nonzero values (void for the graph's
+ * weight type), for example `__half` or `__nv_bfloat16` to halve the bytes
+ * read per nonzero (accumulated in fp32).
+ * @param G graph (CSR).
+ * @param x input vector.
+ * @param y output vector.
+ * @param kernel row-wise reduction kernel (chosen by the row lengths if
+ * `kernel_t::automatic`).
+ * @param context device context.
+ * @return float time taken (ms), the values are converted and the kernel is
+ * planned outside of it.
+ */
+template <typename value_t = void, typename graph_t>
+float run_pull(graph_t& G,
+               typename graph_t::weight_type* x,  // Input vector
+               typename graph_t::weight_type* y,  // Output vector
+               operators::neighborreduce::kernel_t kernel =
+                   operators::neighborreduce::kernel_t::automatic,
+               std::shared_ptr<gcuda::multi_context_t> context =
+                   std::shared_ptr<gcuda::multi_context_t>(
+                       new gcuda::multi_context_t(0))  // Context
+) {
+  // <user-defined>
+  using weight_t = typename graph_t::weight_type;
+  using value_type =
+      std::conditional_t<std::is_void_v<value_t>, weight_t, value_t>;
+
+  using param_type = param_t<weight_t>;
+  using result_type = result_t<weight_t>;
+
+  param_type param(x);
+  result_type result(y);
+  // </user-defined>
+
+  using problem_type =
+      pull_problem_t<graph_t, param_type, result_type, value_type>;
+  using enactor_type = pull_enactor_t<problem_type>;
+
+  problem_type problem(G, param, result, context, kernel);
+  problem.init();
+  problem.reset();
+
+  // Disable internal-frontiers:
+  enactor_properties_t props;
+  props.self_manage_frontiers = true;
+
+  enactor_type enactor(&problem, context, props);
+  return enactor.enact();
+  // </boiler-plate>
+}
+
 }  // namespace spmv
 }  // namespace gunrock
\ No newline at end of file
@@ -14,10 +14,21 @@
 namespace gunrock {
 namespace sssp {
 
-template <typename vertex_t>
+template <typename vertex_t, typename weight_t>
 struct param_t {
   vertex_t single_source;
-  param_t(vertex_t _single_source) : single_source(_single_source) {}
+  weight_t delta;
+
+  /**
+   * @brief SSSP parameters.
+   *
+   * @param _single_source Source vertex.
+   * @param _delta Bucket width of delta-stepping, only tentative distances
+   * within the current bucket are relaxed per iteration. 0 (default) relaxes
+   * the entire frontier every iteration (Bellman-Ford).
+   */
+  param_t(vertex_t _single_source, weight_t _delta = 0)
+      : single_source(_single_source), delta(_delta) {}
 };
 
 template <typename vertex_t, typename weight_t>
@@ -77,21 +88,50 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 };
 
-template <typename problem_t>
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::adaptive>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
-            std::shared_ptr<gcuda::multi_context_t> _context)
-      : gunrock::enactor_t<problem_t>(_problem, _context) {}
+            std::shared_ptr<gcuda::multi_context_t> _context,
+            enactor_properties_t _properties = enactor_properties_t())
+      : gunrock::enactor_t<problem_t>(_problem, _context, _properties),
+        buckets(_problem->param.delta, _context->get_context(0)->stream()) {}
 
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
-  using frontier_t = typename enactor_t<problem_t>::frontier_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
+
+  /*!
+   * Far pile of delta-stepping (unused if `param.delta == 0`).
+   */
+  frontier::near_far_frontier_t<vertex_t, edge_t, weight_t> buckets;
 
   void prepare_frontier(frontier_t* f,
                         gcuda::multi_context_t& context) override {
     auto P = this->get_problem();
     f->push_back(P->param.single_source);
+    buckets.reset(P->param.delta);
+  }
+
+  /**
+   * @brief Load-balancing technique of a Bellman-Ford iteration, the fused
+   * advance and filter is block-mapped. Adaptive fuses them too, unless the
+   * degrees of the frontier are skewed (merge-path).
+   */
+  operators::load_balance_t fused_lb(gcuda::multi_context_t& context) {
+    if (lb != operators::load_balance_t::adaptive)
+      return lb;
+
+    auto G = this->get_problem()->get_graph();
+    auto selected =
+        operators::advance::adaptive::select<
+            operators::advance_io_type_t::vertices>(
+            G, *(this->get_input_frontier()), *context.get_context(0));
+    return (selected == operators::load_balance_t::merge_path)
+               ? selected
+               : operators::load_balance_t::block_mapped;
   }
 
   void loop(gcuda::multi_context_t& context) override {
@@ -124,38 +164,238 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto remove_completed_paths = [G, visited, iteration] __host__ __device__(
                                       vertex_t const& vertex) -> bool {
-      if (visited[vertex] == iteration)
+      // Keep only the first copy of a vertex per iteration, such that the
+      // compacted frontier never exceeds the number of vertices.
+      if (math::atomic::exch(&visited[vertex], (vertex_t)iteration) ==
+          (vertex_t)iteration)
         return false;
 
-      visited[vertex] = iteration;
       /// @todo Confirm we do not need the following for bug
       /// https://github.com/gunrock/essentials/issues/9 anymore.
       // return G.get_number_of_neighbors(vertex) > 0;
       return true;
     };
 
-    // Execute advance operator on the provided lambda
-    operators::advance::execute<operators::load_balance_t::block_mapped>(
-        G, E, shortest_path, context);
+    if (P->param.delta > 0) {
+      auto priority = [distances] __device__(vertex_t const& v) -> weight_t {
+        return thread::load(&distances[v]);
+      };
+
+      // Relax the current bucket, defer the improved vertices beyond it.
+      operators::advance::bucketing::execute(G, E, shortest_path, priority,
+                                             buckets, context);
+    } else if (fused_lb(context) == operators::load_balance_t::block_mapped) {
+      // Relax and filter in a single kernel, the intermediate frontier is
+      // never written to global memory.
+      operators::advance_filter::execute(G, E, shortest_path,
+                                         remove_completed_paths, context);
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::LOG_REQUESTED_ADVANCE(operators::advance_direction_t::forward,
+                                       lb);
+#endif
+      return;
+    } else if (lb == operators::load_balance_t::adaptive) {
+      operators::advance::execute<operators::load_balance_t::merge_path>(
+          G, E, shortest_path, context);
+    } else {
+      // Execute advance operator on the provided lambda
+      operators::advance::execute<lb>(G, E, shortest_path, context);
+    }
 
     // Execute filter operator on the provided lambda
     operators::filter::execute<operators::filter_algorithm_t::bypass>(
         G, E, remove_completed_paths, context);
 
-    /// @brief Execute uniquify operator to deduplicate the frontier
-    /// @note Not required.
-    // // bool best_effort_uniquification = true;
-    // // operators::uniquify::execute<operators::uniquify_algorithm_t::unique>(
-    // // E, context, best_effort_uniquification);
+    /// @note No uniquify operator is required, `remove_completed_paths`
+    /// already deduplicates the frontier (@see uniquify_algorithm_t::bitmap
+    /// for the same technique as a standalone operator).
+
+    // Once the current bucket is settled, continue with the next one of the
+    // far pile (if any).
+    auto f = this->get_input_frontier();
+    if ((P->param.delta > 0) && f->is_empty()) {
+      auto priority = [distances] __device__(vertex_t const& v) -> weight_t {
+        return thread::load(&distances[v]);
+      };
+      buckets.refill(*f, priority, *context.get_context(0));
+    }
+  }
+
+  /**
+   * @brief Converged once the frontier is empty, for delta-stepping the far
+   * pile is then empty too (@see loop()).
+   */
+  virtual bool is_converged(gcuda::multi_context_t& context) override {
+    return this->get_input_frontier()->is_empty();
   }
 
 };  // struct enactor_t
 
-template <typename graph_t>
+/**
+ * @brief Multi-GPU Single-Source Shortest Path (Bellman-Ford), every device
+ * relaxes the frontier vertices it owns (@see gunrock::vertex_partition_t)
+ * into its own tentative distances of all the vertices (proposals), and the
+ * improved vertices are exchanged between the iterations. Their owner then
+ * takes the best proposal of all devices into its partition of the
+ * distances.
+ */
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::adaptive>
+struct multi_gpu_enactor_t : gunrock::multi_gpu_enactor_t<problem_t> {
+  using base_t = gunrock::multi_gpu_enactor_t<problem_t>;
+  using vertex_t = typename problem_t::vertex_t;
+  using edge_t = typename problem_t::edge_t;
+  using weight_t = typename problem_t::weight_t;
+  using frontier_t = typename base_t::frontier_t;
+
+  /*!
+   * Distances of the vertices owned by each device.
+   */
+  typename base_t::template partitioned_vector_t<weight_t> distances;
+
+  /*!
+   * Per device, the best distance it found for every vertex (|V|), and the
+   * proposals of all the devices (read by the owners in `receive()`).
+   */
+  std::vector<pooled_vector_t<weight_t>> proposals;
+  std::vector<pooled_vector_t<weight_t*>> all_proposals;
+
+  multi_gpu_enactor_t(problem_t* _problem,
+                      std::shared_ptr<gcuda::multi_context_t> _context,
+                      enactor_properties_t _properties = enactor_properties_t())
+      : base_t(_problem, _context, _properties),
+        distances(this->template make_partitioned_vector<weight_t>(
+            std::numeric_limits<weight_t>::max())) {
+    auto n_vertices = _problem->get_graph().get_number_of_vertices();
+    auto n_devices = _context->size();
+
+    thrust::host_vector<weight_t*> pointers;
+    for (std::size_t device = 0; device < n_devices; ++device) {
+      auto device_context = _context->get_context(device);
+      gcuda::device::set(device_context->ordinal());
+      proposals.emplace_back(make_pooled_vector<weight_t>(
+          device_context->stream(), n_vertices));
+      pointers.push_back(proposals.back().data().get());
+    }
+
+    for (std::size_t device = 0; device < n_devices; ++device) {
+      auto device_context = _context->get_context(device);
+      gcuda::device::set(device_context->ordinal());
+      all_proposals.emplace_back(make_pooled_vector<weight_t*>(
+          device_context->stream(), pointers.begin(), pointers.end()));
+    }
+
+    gcuda::device::set(_context->get_context(0)->ordinal());
+  }
+
+  void prepare_frontier(int device,
+                        frontier_t* f,
+                        gcuda::multi_context_t& context) override {
+    auto P = this->get_problem();
+    auto source = P->param.single_source;
+    auto policy = context.get_context(0)->execution_policy();
+
+    auto& owned = distances[device];
+    auto& proposed = proposals[device];
+    auto begin = this->partition.begin(device);
+    thrust::fill(policy, owned.begin(), owned.end(),
+                 std::numeric_limits<weight_t>::max());
+    thrust::fill(policy, proposed.begin(), proposed.end(),
+                 std::numeric_limits<weight_t>::max());
+    if (this->partition.owner(source) == device) {
+      thrust::fill_n(policy, owned.begin() + (source - begin), 1, 0);
+      f->push_back(source);
+    }
+  }
+
+  void loop(int device, gcuda::multi_context_t& context) override {
+    auto E = this->get_slice(device);
+    auto G = this->get_problem()->get_graph();
+
+    auto begin = this->partition.begin(device);
+    auto owned = distances[device].data().get();
+    auto proposed = proposals[device].data().get();
+
+    // The sources are owned by this device, only the neighbors whose proposal
+    // improved are sent to their owner.
+    auto shortest_path = [=] __host__ __device__(
+                             vertex_t const& source,    // ... source
+                             vertex_t const& neighbor,  // neighbor
+                             edge_t const& edge,        // edge
+                             weight_t const& weight     // weight (tuple).
+                             ) -> bool {
+      weight_t distance_to_neighbor = owned[source - begin] + weight;
+      weight_t recover_distance =
+          math::atomic::min(&proposed[neighbor], distance_to_neighbor);
+      return (distance_to_neighbor < recover_distance);
+    };
+
+    operators::advance::execute<lb>(G, E, shortest_path, context);
+  }
+
+  void receive(int device, gcuda::multi_context_t& context) override {
+    auto E = this->get_slice(device);
+    auto G = this->get_problem()->get_graph();
+
+    auto begin = this->partition.begin(device);
+    auto owned = distances[device].data().get();
+    auto peers = all_proposals[device].data().get();
+    int n_devices = all_proposals.size();
+
+    // Take the best proposal (peer reads), a vertex is kept once, by the copy
+    // that improved its distance.
+    auto settle = [=] __host__ __device__(vertex_t const& v) -> bool {
+      weight_t best = std::numeric_limits<weight_t>::max();
+      for (int peer = 0; peer < n_devices; ++peer) {
+        weight_t proposal = thread::load(&peers[peer][v]);
+        best = (proposal < best) ? proposal : best;
+      }
+      return best < math::atomic::min(&owned[v - begin], best);
+    };
+    auto keep = [] __host__ __device__(vertex_t const& v) -> bool {
+      return true;
+    };
+
+    operators::filter::execute<operators::filter_algorithm_t::bypass>(
+        G, E, settle, context);
+    operators::filter::execute<operators::filter_algorithm_t::predicated>(
+        G, E, keep, context);
+  }
+
+  void finalize(int device, gcuda::multi_context_t& context) override {
+    this->gather(distances, device, this->get_problem()->result.distances);
+  }
+};  // struct multi_gpu_enactor_t
+
+/**
+ * @brief Run Single-Source Shortest Path algorithm on a given graph, G, with
+ * the given parameters (source and delta-stepping bucket width).
+ *
+ * @note If the context holds more than one device, the search runs on all of
+ * them (@see multi_gpu_enactor_t, delta-stepping is not supported). G must
+ * then be accessible from every device.
+ *
+ * @tparam lb Load-balancing technique of the advance (if `param.delta == 0`),
+ * `block_mapped` fuses the advance with the filter of completed paths, and
+ * so does `adaptive` unless the frontier's degrees are skewed (merge-path).
+ * @tparam graph_t Graph type.
+ * @param G Graph object.
+ * @param param SSSP parameters, @see param_t.
+ * @param distances Pointer to the distances array of size number of vertices.
+ * @param predecessors Pointer to the predecessors array of size number of
+ * vertices. (optional, wip)
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <operators::load_balance_t lb =
+              operators::load_balance_t::adaptive,
+          typename graph_t>
 float run(graph_t& G,
-          typename graph_t::vertex_type& single_source,  // Parameter
-          typename graph_t::weight_type* distances,      // Output
-          typename graph_t::vertex_type* predecessors,   // Output
+          param_t<typename graph_t::vertex_type,
+                  typename graph_t::weight_type>& param,  // Parameter
+          typename graph_t::weight_type* distances,       // Output
+          typename graph_t::vertex_type* predecessors,    // Output
           std::shared_ptr<gcuda::multi_context_t> context =
               std::shared_ptr<gcuda::multi_context_t>(
                   new gcuda::multi_context_t(0))  // Context
@@ -164,24 +404,53 @@ float run(graph_t& G,
   using vertex_t = typename graph_t::vertex_type;
   using weight_t = typename graph_t::weight_type;
 
-  using param_type = param_t<vertex_t>;
+  using param_type = param_t<vertex_t, weight_t>;
   using result_type = result_t<vertex_t, weight_t>;
 
-  param_type param(single_source);
   result_type result(distances, predecessors, G.get_number_of_vertices());
   // </user-defined>
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   problem_type problem(G, param, result, context);
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, context);
+  // Dense SSSP frontiers carry many invalids and duplicates, rebuild them
+  // through a bitmap once they exceed 10% of the vertices.
+  enactor_properties_t props;
+  props.dense_frontier_ratio = 0.1f;
+
+  if (context->size() > 1) {
+    error::throw_if_exception(param.delta > 0,
+                              "Multi-GPU delta-stepping is not supported.");
+    multi_gpu_enactor_t<problem_type, lb> enactor(&problem, context);
+    return enactor.enact();
+  }
+
+  enactor_type enactor(&problem, context, props);
   return enactor.enact();
   // </boiler-plate>
 }
 
+template <operators::load_balance_t lb =
+              operators::load_balance_t::adaptive,
+          typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type& single_source,  // Parameter
+          typename graph_t::weight_type* distances,      // Output
+          typename graph_t::vertex_type* predecessors,   // Output
+          std::shared_ptr<gcuda::multi_context_t> context =
+              std::shared_ptr<gcuda::multi_context_t>(
+                  new gcuda::multi_context_t(0))  // Context
+) {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  param_t<vertex_t, weight_t> param(single_source);
+  return run<lb>(G, param, distances, predecessors, context);
+}
+
 }  // namespace sssp
 }  // namespace gunrock
@@ -12,6 +12,11 @@
 #include <gunrock/algorithms/algorithms.hxx>
 #include <gunrock/util/timer.hxx>
 
+#include <thrust/binary_search.h>
+
+#include <cub/warp/warp_reduce.cuh>
+#include <cub/block/block_reduce.cuh>
+
 namespace gunrock {
 namespace tc {
 
@@ -31,6 +36,274 @@ struct result_t {
         total_triangles_count(_total_triangles_count) {}
 };
 
+namespace detail {
+
+constexpr unsigned int warp_size = 32;
+
+/*!
+ * Oriented degrees up to `warp_degree` are intersected by a warp, up to
+ * `hash_degree` by a block with a shared-memory hash table of `hash_slots`
+ * slots, and the others by a block with a bitmap of all the vertices.
+ */
+constexpr std::size_t warp_degree = warp_size;
+constexpr std::size_t hash_degree = 1024;
+constexpr unsigned int hash_bits = 11;
+constexpr std::size_t hash_slots = std::size_t(1) << hash_bits;
+
+/*!
+ * Memory budget of the bitmaps (one per resident block).
+ */
+constexpr std::size_t bitmap_budget = std::size_t(1) << 28;
+
+/**
+ * @brief Degree ordering, u precedes v if it has less neighbors (ties broken
+ * by ids). Orienting the edges along it bounds the oriented degrees by
+ * `sqrt(2 |E|)`.
+ */
+template <typename graph_t, typename vertex_t>
+__host__ __device__ __forceinline__ bool precedes(graph_t const& G,
+                                                  vertex_t const& u,
+                                                  vertex_t const& v) {
+  auto u_degree = G.get_number_of_neighbors(u);
+  auto v_degree = G.get_number_of_neighbors(v);
+  return (u_degree < v_degree) || (u_degree == v_degree && u < v);
+}
+
+template <typename vertex_t>
+__device__ __forceinline__ std::size_t hash(vertex_t const& v) {
+  return (static_cast<unsigned int>(v) * 2654435761u) >> (32 - hash_bits);
+}
+
+/**
+ * @brief One warp per vertex u: the (sorted) oriented neighbors of u are
+ * staged in shared memory, and for each oriented neighbor v the lanes stride
+ * over the oriented neighbors of v, looking each of them up in the list of u.
+ * Each triangle (u, v, w) is found once, and the counts of u and v are added
+ * once per warp.
+ */
+template <unsigned int THREADS_PER_BLOCK,
+          typename vertex_t,
+          typename edge_t,
+          typename count_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    warp_intersect_kernel(edge_t const* offsets,
+                          vertex_t const* indices,
+                          vertex_t const* vertices,
+                          std::size_t size,
+                          count_t* counts) {
+  constexpr unsigned int warps_per_block = THREADS_PER_BLOCK / warp_size;
+  using warp_reduce_t = cub::WarpReduce<count_t>;
+
+  __shared__ typename warp_reduce_t::TempStorage reduce[warps_per_block];
+  __shared__ vertex_t lists[warps_per_block][warp_degree];
+
+  std::size_t lane = gcuda::thread::local::id::x() & (warp_size - 1);
+  std::size_t local_warp = gcuda::thread::local::id::x() / warp_size;
+  std::size_t warp_id = gcuda::thread::global::id::x() / warp_size;
+  std::size_t total_warps =
+      (gcuda::block::size::x() * gcuda::grid::size::x()) / warp_size;
+
+  vertex_t* list = lists[local_warp];
+
+  // The loop bound is uniform across the warp, all lanes stay converged.
+  for (std::size_t i = warp_id; i < size; i += total_warps) {
+    vertex_t u = vertices[i];
+    edge_t first = offsets[u];
+    edge_t degree = offsets[u + 1] - first;
+
+    if (lane < degree)
+      list[lane] = indices[first + lane];
+    __syncwarp();
+
+    count_t u_count = 0;
+    for (edge_t j = 0; j < degree; ++j) {
+      vertex_t v = list[j];
+      edge_t v_first = offsets[v];
+      edge_t v_degree = offsets[v + 1] - v_first;
+
+      count_t v_count = 0;
+      for (edge_t k = lane; k < v_degree; k += warp_size) {
+        vertex_t w = indices[v_first + k];
+        if (thrust::binary_search(thrust::seq, list, list + degree, w)) {
+          math::atomic::add(&counts[w], count_t{1});
+          ++v_count;
+        }
+      }
+
+      v_count = warp_reduce_t(reduce[local_warp]).Sum(v_count);
+      if (lane == 0 && v_count != 0)
+        math::atomic::add(&counts[v], v_count);
+      u_count += v_count;  // Valid in lane 0.
+      __syncwarp();
+    }
+
+    if (lane == 0 && u_count != 0)
+      math::atomic::add(&counts[u], u_count);
+    __syncwarp();
+  }
+}
+
+/**
+ * @brief One block per vertex u: the oriented neighbors of u are inserted in
+ * a shared-memory hash table (linear probing), then each warp takes an
+ * oriented neighbor v and its lanes probe the table with the oriented
+ * neighbors of v.
+ */
+template <unsigned int THREADS_PER_BLOCK,
+          typename vertex_t,
+          typename edge_t,
+          typename count_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    hash_intersect_kernel(edge_t const* offsets,
+                          vertex_t const* indices,
+                          vertex_t const* vertices,
+                          std::size_t size,
+                          count_t* counts) {
+  constexpr unsigned int warps_per_block = THREADS_PER_BLOCK / warp_size;
+  using warp_reduce_t = cub::WarpReduce<count_t>;
+  using block_reduce_t = cub::BlockReduce<count_t, THREADS_PER_BLOCK>;
+
+  __shared__ typename warp_reduce_t::TempStorage reduce[warps_per_block];
+  __shared__ typename block_reduce_t::TempStorage block_reduce;
+  __shared__ vertex_t table[hash_slots];
+
+  auto empty = gunrock::numeric_limits<vertex_t>::invalid();
+  std::size_t tid = gcuda::thread::local::id::x();
+  std::size_t lane = tid & (warp_size - 1);
+  std::size_t local_warp = tid / warp_size;
+
+  for (std::size_t i = gcuda::block::id::x(); i < size;
+       i += gcuda::grid::size::x()) {
+    vertex_t u = vertices[i];
+    edge_t first = offsets[u];
+    edge_t degree = offsets[u + 1] - first;
+
+    /// 1. Build the table of the oriented neighbors of u.
+    for (std::size_t slot = tid; slot < hash_slots; slot += THREADS_PER_BLOCK)
+      table[slot] = empty;
+    __syncthreads();
+
+    for (edge_t j = tid; j < degree; j += THREADS_PER_BLOCK) {
+      vertex_t w = indices[first + j];
+      for (auto slot = hash(w);; slot = (slot + 1) & (hash_slots - 1)) {
+        auto previous = math::atomic::cas(&table[slot], empty, w);
+        if (previous == empty || previous == w)
+          break;
+      }
+    }
+    __syncthreads();
+
+    /// 2. Probe with the oriented neighbors of each oriented neighbor v.
+    count_t u_count = 0;
+    for (edge_t j = local_warp; j < degree; j += warps_per_block) {
+      vertex_t v = indices[first + j];
+      edge_t v_first = offsets[v];
+      edge_t v_degree = offsets[v + 1] - v_first;
+
+      count_t v_count = 0;
+      for (edge_t k = lane; k < v_degree; k += warp_size) {
+        vertex_t w = indices[v_first + k];
+        for (auto slot = hash(w); table[slot] != empty;
+             slot = (slot + 1) & (hash_slots - 1)) {
+          if (table[slot] == w) {
+            math::atomic::add(&counts[w], count_t{1});
+            ++v_count;
+            break;
+          }
+        }
+      }
+
+      v_count = warp_reduce_t(reduce[local_warp]).Sum(v_count);
+      if (lane == 0 && v_count != 0)
+        math::atomic::add(&counts[v], v_count);
+      u_count += v_count;  // Valid in lane 0.
+      __syncwarp();
+    }
+
+    u_count = block_reduce_t(block_reduce).Sum(u_count);
+    if (tid == 0 && u_count != 0)
+      math::atomic::add(&counts[u], u_count);
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief One block per vertex u, for the oriented neighbor lists too long for
+ * the hash table: the oriented neighbors of u are set in the (global memory)
+ * bitmap of the block, probed as in `hash_intersect_kernel`, and cleared.
+ */
+template <unsigned int THREADS_PER_BLOCK,
+          typename vertex_t,
+          typename edge_t,
+          typename count_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    bitmap_intersect_kernel(edge_t const* offsets,
+                            vertex_t const* indices,
+                            vertex_t const* vertices,
+                            std::size_t size,
+                            unsigned int* bitmaps,
+                            std::size_t words_per_bitmap,
+                            count_t* counts) {
+  constexpr unsigned int warps_per_block = THREADS_PER_BLOCK / warp_size;
+  using warp_reduce_t = cub::WarpReduce<count_t>;
+  using block_reduce_t = cub::BlockReduce<count_t, THREADS_PER_BLOCK>;
+
+  __shared__ typename warp_reduce_t::TempStorage reduce[warps_per_block];
+  __shared__ typename block_reduce_t::TempStorage block_reduce;
+
+  std::size_t tid = gcuda::thread::local::id::x();
+  std::size_t lane = tid & (warp_size - 1);
+  std::size_t local_warp = tid / warp_size;
+  unsigned int* bitmap = bitmaps + gcuda::block::id::x() * words_per_bitmap;
+
+  for (std::size_t i = gcuda::block::id::x(); i < size;
+       i += gcuda::grid::size::x()) {
+    vertex_t u = vertices[i];
+    edge_t first = offsets[u];
+    edge_t degree = offsets[u + 1] - first;
+
+    for (edge_t j = tid; j < degree; j += THREADS_PER_BLOCK) {
+      vertex_t w = indices[first + j];
+      math::atomic::bit_or(&bitmap[w / 32], 1u << (w % 32));
+    }
+    __syncthreads();
+
+    count_t u_count = 0;
+    for (edge_t j = local_warp; j < degree; j += warps_per_block) {
+      vertex_t v = indices[first + j];
+      edge_t v_first = offsets[v];
+      edge_t v_degree = offsets[v + 1] - v_first;
+
+      count_t v_count = 0;
+      for (edge_t k = lane; k < v_degree; k += warp_size) {
+        vertex_t w = indices[v_first + k];
+        if (bitmap[w / 32] & (1u << (w % 32))) {
+          math::atomic::add(&counts[w], count_t{1});
+          ++v_count;
+        }
+      }
+
+      v_count = warp_reduce_t(reduce[local_warp]).Sum(v_count);
+      if (lane == 0 && v_count != 0)
+        math::atomic::add(&counts[v], v_count);
+      u_count += v_count;  // Valid in lane 0.
+      __syncwarp();
+    }
+
+    u_count = block_reduce_t(block_reduce).Sum(u_count);
+    if (tid == 0 && u_count != 0)
+      math::atomic::add(&counts[u], u_count);
+    __syncthreads();
+
+    // Leave the bitmap empty for the next vertex.
+    for (edge_t j = tid; j < degree; j += THREADS_PER_BLOCK)
+      bitmap[indices[first + j] / 32] = 0;
+    __syncthreads();
+  }
+}
+
+}  // namespace detail
+
 template <typename graph_t, typename param_type, typename result_type>
 struct problem_t : gunrock::problem_t<graph_t> {
   param_type param;
@@ -47,12 +320,41 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using vertex_t = typename graph_t::vertex_type;
   using edge_t = typename graph_t::edge_type;
 
-  void init() override {}
+  /*!
+   * Edges oriented along the degree ordering (CSR, sorted neighbors), @see
+   * detail::precedes().
+   */
+  thrust::device_vector<edge_t> oriented_offsets;
+  thrust::device_vector<vertex_t> oriented_indices;
+
+  /*!
+   * Vertices with at least two oriented neighbors, grouped by the
+   * intersection they use (warp, hash and bitmap).
+   */
+  thrust::device_vector<vertex_t> vertices;
+  thrust::device_vector<unsigned int> bitmaps;
+
+  void init() override {
+    auto g = this->get_graph();
+    oriented_offsets.resize(g.get_number_of_vertices() + 1);
+    vertices.resize(g.get_number_of_vertices());
+  }
 
   void reset() override {}
 };
 
-template <typename problem_t>
+/**
+ * @brief Triangle counting by degree ordering: every edge is oriented from
+ * the vertex with the fewest neighbors, such that every triangle is found
+ * once, by intersecting the oriented neighbors of the two ends of one of its
+ * edges. Each vertex u is intersected with all its oriented neighbors at once,
+ * by a warp (sorted lookups), a block with a shared-memory hash table, or a
+ * block with a bitmap, depending on its oriented degree. The neighbor lists of
+ * the graph must be sorted.
+ */
+template <typename problem_t,
+          operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped>
 struct enactor_t : gunrock::enactor_t<problem_t> {
   enactor_t(problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context,
@@ -62,44 +364,120 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
-  using frontier_t = typename enactor_t<problem_t>::frontier_t;
+  using frontier_t = typename gunrock::enactor_t<problem_t>::frontier_t;
 
   void loop(gcuda::multi_context_t& context) override {
     // Data slice
-    auto E = this->get_enactor();
     auto P = this->get_problem();
     auto G = P->get_graph();
 
+    auto single_context = context.get_context(0);
+    auto policy = single_context->execution_policy();
+    auto n_vertices = G.get_number_of_vertices();
     auto vertex_triangles_count = P->result.vertex_triangles_count;
 
-    auto intersect = [G, vertex_triangles_count] __host__ __device__(
-                         vertex_t const& source,    // ... source
-                         vertex_t const& neighbor,  // neighbor
-                         edge_t const& edge,        // edge
-                         weight_t const& weight     // weight (tuple).
-                         ) -> bool {
-      if (neighbor > source) {
-        auto src_vertex_triangles_count = G.get_intersection_count(
-            source, neighbor,
-            [vertex_triangles_count, source,
-             neighbor](auto intersection_vertex) {
-              if (source != intersection_vertex &&
-                  neighbor != intersection_vertex) {
-                math::atomic::add(
-                    &(vertex_triangles_count[intersection_vertex]),
-                    vertex_t{1});
-              }
-            });
+    /// 1. Orient the edges along the degree ordering.
+    auto& oriented_offsets = P->oriented_offsets;
+    auto& oriented_indices = P->oriented_indices;
+
+    thrust::transform(
+        policy, thrust::counting_iterator<vertex_t>(0),
+        thrust::counting_iterator<vertex_t>(n_vertices),
+        oriented_offsets.begin(), [G] __device__(vertex_t const& u) -> edge_t {
+          edge_t count = 0;
+          edge_t first = G.get_starting_edge(u);
+          edge_t last = first + G.get_number_of_neighbors(u);
+          for (edge_t e = first; e < last; ++e)
+            if (detail::precedes(G, u, G.get_destination_vertex(e)))
+              ++count;
+          return count;
+        });
+    oriented_offsets[n_vertices] = 0;
+    thrust::exclusive_scan(policy, oriented_offsets.begin(),
+                           oriented_offsets.end(), oriented_offsets.begin());
+    oriented_indices.resize(oriented_offsets[n_vertices]);
+
+    auto offsets = oriented_offsets.data().get();
+    auto indices = oriented_indices.data().get();
+    auto orient = [G, offsets, indices] __device__(vertex_t const& u) {
+      edge_t position = offsets[u];
+      edge_t first = G.get_starting_edge(u);
+      edge_t last = first + G.get_number_of_neighbors(u);
+      for (edge_t e = first; e < last; ++e) {
+        auto v = G.get_destination_vertex(e);
+        if (detail::precedes(G, u, v))
+          indices[position++] = v;
       }
-      return false;
     };
+    operators::parallel_for::execute<operators::parallel_for_each_t::vertex>(
+        G, orient, context);
+
+    /// 2. Group the vertices by intersection (by oriented degree, vertices
+    /// with less than two oriented neighbors close no triangle).
+    std::size_t bounds[4] = {2, detail::warp_degree + 1,
+                             detail::hash_degree + 1,
+                             std::numeric_limits<std::size_t>::max()};
+    std::size_t group_sizes[3];
+    auto vertices = P->vertices.data().get();
+    auto output = vertices;
+    for (int group = 0; group < 3; ++group) {
+      std::size_t lo = bounds[group];
+      std::size_t hi = bounds[group + 1];
+      auto last = thrust::copy_if(
+          policy, thrust::counting_iterator<vertex_t>(0),
+          thrust::counting_iterator<vertex_t>(n_vertices), output,
+          [offsets, lo, hi] __device__(vertex_t const& u) {
+            std::size_t degree = offsets[u + 1] - offsets[u];
+            return degree >= lo && degree < hi;
+          });
+      group_sizes[group] = thrust::distance(output, last);
+      output = last;
+    }
+    auto n_warp = group_sizes[0];
+    auto n_hash = group_sizes[1];
+    auto n_bitmap = group_sizes[2];
 
-    // Execute advance operator on the provided lambda
-    operators::advance::execute<operators::load_balance_t::block_mapped,
-                                operators::advance_direction_t::forward,
-                                operators::advance_io_type_t::graph,
-                                operators::advance_io_type_t::none>(
-        G, E, intersect, context);
+    /// 3. Intersect.
+    using namespace gcuda::launch_box;
+    using launch_t =
+        launch_box_t<launch_params_dynamic_grid_t<fallback, dim3_t<256>>>;
+    constexpr unsigned int threads_per_block = 256;
+
+    launch_t launch_box;
+    if (n_warp > 0) {
+      launch_box.calculate_grid_dimensions_strided(n_warp * detail::warp_size);
+      auto kernel = detail::warp_intersect_kernel<threads_per_block, vertex_t,
+                                                  edge_t, vertex_t>;
+      launch_box.launch(*single_context, kernel, offsets, indices, vertices,
+                        n_warp, vertex_triangles_count);
+    }
+
+    if (n_hash > 0) {
+      launch_box.calculate_grid_dimensions_strided(n_hash * threads_per_block);
+      auto kernel = detail::hash_intersect_kernel<threads_per_block, vertex_t,
+                                                  edge_t, vertex_t>;
+      launch_box.launch(*single_context, kernel, offsets, indices,
+                        vertices + n_warp, n_hash, vertex_triangles_count);
+    }
+
+    if (n_bitmap > 0) {
+      std::size_t words = (n_vertices + 31) / 32;
+      std::size_t n_blocks = std::min<std::size_t>(
+          n_bitmap, std::max<std::size_t>(
+                        1, detail::bitmap_budget / (words * sizeof(unsigned))));
+      P->bitmaps.resize(n_blocks * words);
+      thrust::fill(policy, P->bitmaps.begin(), P->bitmaps.end(), 0u);
+
+      launch_box.calculate_grid_dimensions_strided(n_blocks *
+                                                   threads_per_block);
+      auto kernel = detail::bitmap_intersect_kernel<threads_per_block, vertex_t,
+                                                    edge_t, vertex_t>;
+      launch_box.launch(*single_context, kernel, offsets, indices,
+                        vertices + n_warp + n_hash, n_bitmap,
+                        P->bitmaps.data().get(), words,
+                        vertex_triangles_count);
+    }
+    single_context->synchronize();
   }
 
   virtual bool is_converged(gcuda::multi_context_t& context) {
@@ -128,7 +506,21 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   }
 };  // struct enactor_t
 
-template <typename graph_t>
+/**
+ * @brief Count the triangles of each vertex of an undirected graph (with
+ * sorted neighbor lists), @see enactor_t.
+ *
+ * @tparam lb Unused, the intersections are balanced by oriented degree.
+ * @param G Graph.
+ * @param reduce_all_triangles Also sum the counts of all the vertices.
+ * @param vertex_triangles_count Output per-vertex counts (added to).
+ * @param total_triangles_count Output sum of the per-vertex counts.
+ * @param context Device context.
+ * @return float Time taken to run the algorithm.
+ */
+template <operators::load_balance_t lb =
+              operators::load_balance_t::block_mapped,
+          typename graph_t>
 float run(graph_t& G,
           bool reduce_all_triangles,
           typename graph_t::vertex_type* vertex_triangles_count,  // Output
@@ -149,7 +541,7 @@ float run(graph_t& G,
   // </user-defined>
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
-  using enactor_type = enactor_t<problem_type>;
+  using enactor_type = enactor_t<problem_type, lb>;
 
   problem_type problem(G, param, result, context);
   problem.init();
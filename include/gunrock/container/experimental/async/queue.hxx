@@ -1,11 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <inttypes.h>
 #include <limits>
 #include <assert.h>
+#include <vector>
 
+#include <gunrock/error.hxx>
 #include <gunrock/util/experimental/async/util.hxx>
 
+#include <thrust/device_vector.h>
+
 namespace gunrock {
 namespace experimental {
 namespace async {
@@ -19,6 +24,7 @@ struct Queue {
   volatile CounterT *start, *end, *start_alloc, *end_alloc, *end_max,
       *end_count;
   volatile CounterT* stop;
+  volatile CounterT* overflow;
   uint32_t min_iter;
   uint32_t queue_id = 0;  // remove queue_id change the structure layout and
                           // gets bad performance
@@ -35,6 +41,7 @@ struct Queue {
                      volatile CounterT* _end_max,
                      volatile CounterT* _end_count,
                      volatile CounterT* _stop,
+                     volatile CounterT* _overflow,
                      int _num_queues,
                      uint32_t _queue_id,
                      uint32_t _min_iter = 800) {
@@ -48,6 +55,7 @@ struct Queue {
     end_max = _end_max;
     end_count = _end_count;
     stop = _stop;
+    overflow = _overflow;
 
     num_queues = _num_queues;
     queue_id = _queue_id;
@@ -149,6 +157,10 @@ __launch_bounds__(512, 2) __global__
     __syncwarp();
     end = *(q.end);
 
+    // Pushes were dropped, the run is abandoned (@see Queues::overflowed).
+    if (*(q.overflow))
+      break;
+
     if (index >= end) {
       if (*(q.stop) == blockDim.x * gridDim.x / 32 * q.num_queues)
         break;  // All threads have finished?
@@ -171,6 +183,21 @@ __launch_bounds__(512, 2) __global__
   __syncwarp();
 }
 
+/**
+ * @brief One bulk-synchronous round: consumes the items in [begin, end) of the
+ * queue (grid-stride), items pushed meanwhile are left for the next round.
+ */
+template <typename T, typename CounterT, typename Functor, typename... Args>
+__global__ void _launch_round(Queue<T, CounterT> q,
+                              CounterT begin,
+                              CounterT end,
+                              Functor F,
+                              Args... args) {
+  for (CounterT index = begin + TID; index < end;
+       index += blockDim.x * gridDim.x)
+    F(q.get(index), args...);
+}
+
 template <typename T, typename CounterT>
 template <typename Functor, typename... Args>
 void Queue<T, CounterT>::launch_thread(int numBlock,
@@ -188,31 +215,64 @@ void Queue<T, CounterT>::launch_thread(int numBlock,
 
 template <typename T, typename CounterT = uint32_t>
 struct Queues {
-  T* queue;
+  T* queue = NULL;
   CounterT capacity;
   uint32_t num_queues;
 
-  volatile CounterT* counters;
+  volatile CounterT* counters = NULL;
   volatile CounterT *start, *end, *start_alloc, *end_alloc, *end_max,
-      *end_count, *stop;
-  int num_counters = 7;
+      *end_count, *stop, *overflow;
+  int num_counters = 8;
   int num_block;
   int num_thread;
+  int num_sms;
 
   uint32_t min_iter;
-  Queue<T, CounterT>* worklist;
-  cudaStream_t* streams;
-
+  Queue<T, CounterT>* worklist = NULL;
+  cudaStream_t* streams = NULL;
+
+  // Bulk-synchronous mode: items are consumed in rounds, and an item is pushed
+  // at most once per round (`stamps[item]` holds the last round it was pushed
+  // in), so items must be ids in [0, num_items).
+  bool bulk_synchronous = false;
+  uint32_t* stamps = NULL;
+  CounterT num_items = 0;
+  uint32_t round = 0;
+
+  /**
+   * @brief Allocate the queues.
+   *
+   * @param _capacity capacity of each queue (items are never recycled in the
+   * asynchronous mode, so it bounds the number of pushes of a run).
+   * @param _num_q number of queues (and streams).
+   * @param _num_block total number of persistent blocks, 0 for as many as can
+   * be resident at once (never more, persistent blocks wait on each other).
+   * @param _num_thread threads per block (at most 512).
+   * @param _min_iter idle polls of the queue before a warp votes to stop.
+   * @param _num_sms number of multiprocessors of the device.
+   * @param _num_items number of distinct items, for the bulk-synchronous mode
+   * (0 for the asynchronous mode).
+   */
   __host__ void init(CounterT _capacity,
                      uint32_t _num_q = 8,
                      int _num_block = 280,
                      int _num_thread = 256,
-                     uint32_t _min_iter = 800) {
+                     uint32_t _min_iter = 800,
+                     int _num_sms = 1,
+                     CounterT _num_items = 0) {
     capacity = _capacity;
     num_queues = _num_q;
     min_iter = _min_iter;
     num_block = _num_block;
     num_thread = _num_thread;
+    num_sms = _num_sms;
+    num_items = _num_items;
+    bulk_synchronous = (_num_items > 0);
+    round = 0;
+
+    error::throw_if_exception(num_thread > 512 || num_thread % 32 != 0,
+                              "Queue threads per block must be a multiple of "
+                              "32, and at most 512.");
 
     // Allocate queue memory
     auto queue_size = sizeof(T) * capacity * num_queues;
@@ -232,6 +292,12 @@ struct Queues {
     end_max = &counters[4 * num_queues * PADDING_SIZE];
     end_count = &counters[5 * num_queues * PADDING_SIZE];
     stop = &counters[6 * num_queues * PADDING_SIZE];
+    overflow = &counters[7 * num_queues * PADDING_SIZE];
+
+    if (bulk_synchronous) {
+      cudaMalloc(&stamps, sizeof(uint32_t) * num_items);
+      cudaMemset(stamps, -1, sizeof(uint32_t) * num_items);
+    }
 
     worklist =
         (Queue<T, CounterT>*)malloc(sizeof(Queue<T, CounterT>) * num_queues);
@@ -243,7 +309,7 @@ struct Queues {
       worklist[q_id].init(
           capacity, queue + q_offset, start + c_offset, end + c_offset,
           start_alloc + c_offset, end_alloc + c_offset, end_max + c_offset,
-          end_count + c_offset, stop, num_queues, q_id, min_iter);
+          end_count + c_offset, stop, overflow, num_queues, q_id, min_iter);
 
       cudaStreamCreateWithFlags(&streams[q_id], cudaStreamNonBlocking);
     }
@@ -254,15 +320,30 @@ struct Queues {
       cudaFree(queue);
     if (counters != NULL)
       cudaFree((void*)counters);
-    if (streams != NULL)
+    if (stamps != NULL)
+      cudaFree(stamps);
+    if (streams != NULL) {
+      for (int i = 0; i < num_queues; i++)
+        cudaStreamDestroy(streams[i]);
       free(streams);
+    }
     if (worklist != NULL)
       free(worklist);
+
+    queue = NULL;
+    counters = NULL;
+    stamps = NULL;
+    streams = NULL;
+    worklist = NULL;
   }
 
   __device__ void push(T item) {
     // printf("push | %d\n", item);
 
+    // Already pushed this round.
+    if (stamps != NULL && atomicExch(stamps + item, round) == round)
+      return;
+
     unsigned mask =
         __activemask();  // 32-bit mask indicating active threads in warp
     uint32_t total = __popc(mask);  // Number of active threads
@@ -282,7 +363,14 @@ struct Queues {
 
     alloc =
         __shfl_sync(mask, alloc, leader);  // copy alloc to all active threads
-    assert(alloc + total <= capacity);
+
+    // Out of space: flag it and drop the items (@see overflowed).
+    if (alloc + total > capacity) {
+      if (rank == 0)
+        atomicExch((CounterT*)overflow, 1);
+      __syncwarp(mask);
+      return;
+    }
 
     queue[q_id * capacity + (alloc + rank)] =
         item;  // Insert item into queue at alloc + rank
@@ -310,16 +398,116 @@ struct Queues {
     __syncwarp(mask);
   }
 
+  /**
+   * @brief Blocks of `kernel` that can be resident on the device at once.
+   */
+  template <typename kernel_t>
+  __host__ int resident_blocks(kernel_t kernel) {
+    int blocks_per_sm = 0;
+    error::throw_if_exception(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &blocks_per_sm, kernel, num_thread, 0));
+    return num_sms * blocks_per_sm;
+  }
+
+  /**
+   * @brief Run `f` on every item pushed until the queues drain: persistent
+   * blocks (one grid per queue and stream) in the asynchronous mode, rounds
+   * separated by a device-wide barrier in the bulk-synchronous mode.
+   */
   template <typename Functor>
   __host__ void launch_thread(Functor f) {
+    if (bulk_synchronous) {
+      launch_rounds(f);
+      return;
+    }
+
+    // The vote to stop counts every warp, so every block must be resident.
+    int resident = resident_blocks(
+        _launch_thread<T, CounterT, Functor, Queues<T, CounterT>>);
+    int blocks = (num_block > 0) ? std::min(num_block, resident) : resident;
+    blocks = std::max(1, blocks / (int)num_queues);
+
     for (int i = 0; i < num_queues; i++)
-      worklist[i].launch_thread(num_block / num_queues, num_thread, streams[i],
-                                f, *this);
+      worklist[i].launch_thread(blocks, num_thread, streams[i], f, *this);
+  }
+
+  template <typename Functor>
+  __host__ void launch_rounds(Functor f) {
+    auto kernel = _launch_round<T, CounterT, Functor, Queues<T, CounterT>>;
+    int blocks = std::max(1, resident_blocks(kernel) / (int)num_queues);
+
+    std::vector<CounterT> begin(num_queues, 0), end(num_queues, 0);
+    while (true) {
+      // Items pushed by the last round (or before the first) are visible.
+      bool empty = true;
+      for (int i = 0; i < num_queues; i++) {
+        end[i] = read(end_alloc + i * PADDING_SIZE);
+        empty = empty && (end[i] == begin[i]);
+      }
+      error::throw_if_exception(read(overflow) != 0,
+                                "Queue overflow in bulk-synchronous mode.");
+      if (empty)
+        break;
+
+      // A round pushes at most `num_items` items into a queue.
+      for (int i = 0; i < num_queues; i++)
+        if (capacity - end[i] < num_items)
+          compact(i, begin[i], end[i]);
+
+      ++round;
+      for (int i = 0; i < num_queues; i++) {
+        CounterT size = end[i] - begin[i];
+        if (size == 0)
+          continue;
+        CounterT needed = (size + num_thread - 1) / num_thread;
+        kernel<<<std::min<CounterT>(blocks, needed), num_thread, 0,
+                 streams[i]>>>(worklist[i], begin[i], end[i], f, *this);
+      }
+      sync();
+      begin = end;
+    }
+  }
+
+  /**
+   * @brief Move the unconsumed items [begin, end) of queue `i` to its front.
+   */
+  __host__ void compact(int i, CounterT& begin, CounterT& end) {
+    CounterT size = end - begin;
+    T* items = queue + i * capacity;
+    thrust::device_vector<T> pending(items + begin, items + end);
+    cudaMemcpy(items, pending.data().get(), sizeof(T) * size,
+               cudaMemcpyDeviceToDevice);
+
+    for (auto counter : {start, start_alloc, end_alloc, this->end, end_max,
+                         end_count}) {
+      CounterT value = (counter == start || counter == start_alloc) ? 0 : size;
+      cudaMemcpy((void*)(counter + i * PADDING_SIZE), &value, sizeof(CounterT),
+                 cudaMemcpyHostToDevice);
+    }
+    begin = 0;
+    end = size;
+  }
+
+  __host__ CounterT read(volatile CounterT* counter) {
+    CounterT value;
+    cudaMemcpy(&value, (void*)counter, sizeof(CounterT),
+               cudaMemcpyDeviceToHost);
+    return value;
   }
 
+  /**
+   * @brief Whether a push found its queue full since the last `reset()`. The
+   * pushed items were dropped, so the results of the run are incomplete.
+   */
+  __host__ bool overflowed() { return read(overflow) != 0; }
+
   __host__ void reset() {
     for (int i = 0; i < num_queues; i++)
       worklist[i].reset();
+    cudaMemset((void*)overflow, 0, sizeof(CounterT));
+    if (stamps != NULL)
+      cudaMemset(stamps, -1, sizeof(uint32_t) * num_items);
+    round = 0;
 
     cudaDeviceSynchronize();
   }
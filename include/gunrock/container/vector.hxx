@@ -12,27 +12,52 @@
 
 #pragma once
 
+#include <utility>
+
 #include <gunrock/memory.hxx>
 #include <gunrock/util/type_traits.hxx>
 
 // includes: thrust
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
+#include <thrust/universal_vector.h>
 
 namespace gunrock {
 
 using namespace memory;
 
 template <typename type_t, memory_space_t space = memory_space_t::device>
-using vector_t =
-    std::conditional_t<space == memory_space_t::host,  // condition
-                       thrust::host_vector<type_t>,    // host_type
-                       thrust::device_vector<type_t>   // device_type
-                       >;
+using vector_t = std::conditional_t<
+    space == memory_space_t::host,  // condition
+    thrust::host_vector<type_t>,    // host_type
+    std::conditional_t<space == memory_space_t::managed,  // condition
+                       thrust::universal_vector<type_t>,  // managed_type
+                       thrust::device_vector<type_t>      // device_type
+                       >>;
 
 template <typename type_t>
 using host_vector_t = thrust::host_vector<type_t>;
 template <typename type_t>
 using device_vector_t = thrust::device_vector<type_t>;
 
+/**
+ * @brief Device vector allocated from the device's memory pool, @see
+ * memory::pool_allocator_t.
+ */
+template <typename type_t>
+using pooled_vector_t =
+    thrust::device_vector<type_t, memory::pool_allocator_t<type_t>>;
+
+/**
+ * @brief Pooled vector used on (and allocated and freed on) `stream`, the
+ * arguments are those of the `thrust::device_vector` constructors, without the
+ * allocator. For example, `make_pooled_vector<int>(stream, n, 0)`.
+ */
+template <typename type_t, typename... args_t>
+pooled_vector_t<type_t> make_pooled_vector(cudaStream_t stream,
+                                           args_t&&... args) {
+  return pooled_vector_t<type_t>(std::forward<args_t>(args)...,
+                                 memory::pool_allocator_t<type_t>(stream));
+}
+
 }  // namespace gunrock
\ No newline at end of file
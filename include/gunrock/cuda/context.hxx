@@ -69,19 +69,25 @@ class standard_context_t : public context_t {
   util::timer_t _timer;
 
   // Making this a template argument means we won't generate an instance
-  // of dummy_k for each translation unit.
+  // of dummy_k for each translation unit. A stream is created unless the user
+  // provided one.
   template <int dummy_arg = 0>
-  void init() {
+  void init(bool create_stream = true) {
     gcuda::function_attributes_t attr;
     error::error_t status = cudaFuncGetAttributes(&attr, dummy_k<0>);
     error::throw_if_exception(status);
     _ptx_version = gcuda::make_compute_capability(attr.ptxVersion);
 
     cudaSetDevice(_ordinal);
-    cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking);
+    if (create_stream)
+      cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking);
     cudaEventCreateWithFlags(&_event, cudaEventDisableTiming);
     cudaGetDeviceProperties(&_props, _ordinal);
 
+    // Pooled (stream-ordered) allocations outlive a run, such that buffers
+    // allocated by every run are served from the pool after the first.
+    memory::retain_pool_memory(_ordinal);
+
     _mgpu_context = new mgpu::standard_context_t(false, _stream);
   }
 
@@ -93,7 +99,7 @@ class standard_context_t : public context_t {
 
   standard_context_t(cudaStream_t stream, gcuda::device_id_t device = 0)
       : context_t(), _ordinal(device), _mgpu_context(nullptr), _stream(stream) {
-    init();
+    init(false);
   }
 
   ~standard_context_t() { cudaEventDestroy(_event); }
@@ -175,6 +181,13 @@ class multi_context_t {
       contexts.push_back(device_context);
     }
   }
+
+  // View of an existing single-device context (not owned).
+  multi_context_t(standard_context_t* _context)
+      : devices(1, _context->ordinal()) {
+    contexts.push_back(_context);
+  }
+
   ~multi_context_t() {}
 
   auto get_context(gcuda::device_id_t device) {
@@ -19,6 +19,8 @@ namespace gcuda {}  // namespace gcuda
 #include <gunrock/cuda/function.hxx>
 #include <gunrock/cuda/stream_management.hxx>
 #include <gunrock/cuda/event_management.hxx>
+#include <gunrock/cuda/graph_management.hxx>
+#include <gunrock/cuda/readback.hxx>
 #include <gunrock/cuda/device_properties.hxx>
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/cuda/sm.hxx>
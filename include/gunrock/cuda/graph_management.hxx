@@ -0,0 +1,84 @@
+/**
+ * @file graph_management.hxx
+ * @brief Capture and replay of stream-ordered work as a CUDA graph.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <gunrock/error.hxx>
+#include <gunrock/cuda/stream_management.hxx>
+
+namespace gunrock {
+namespace gcuda {
+
+/**
+ * @brief Owns a CUDA graph captured from a stream and its executable instance.
+ *
+ * @par Overview
+ * Everything enqueued on the stream between `begin()` and `end()` is recorded
+ * (not executed), and `launch()` replays the recording with a single launch.
+ * Host-side values and device addresses used by the captured work are frozen at
+ * capture time.
+ */
+class captured_graph_t {
+ public:
+  captured_graph_t() = default;
+  captured_graph_t(const captured_graph_t& rhs) = delete;
+  captured_graph_t& operator=(const captured_graph_t& rhs) = delete;
+
+  ~captured_graph_t() { clear(); }
+
+  /**
+   * @brief Start recording the work enqueued on `stream`. Unsafe calls (for
+   * example, synchronous copies) by this thread fail during the recording.
+   */
+  void begin(stream_t stream) {
+    clear();
+    error::throw_if_exception(
+        cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal),
+        "Failed to begin the capture of a CUDA graph.");
+    _stream = stream;
+  }
+
+  /**
+   * @brief Stop recording and instantiate the recorded graph.
+   */
+  void end() {
+    error::throw_if_exception(cudaStreamEndCapture(_stream, &_graph),
+                              "Failed to capture a CUDA graph, the captured "
+                              "work must be stream-ordered.");
+    error::throw_if_exception(
+        cudaGraphInstantiateWithFlags(&_instance, _graph, 0),
+        "Failed to instantiate the captured CUDA graph.");
+  }
+
+  /**
+   * @brief Replay the captured work on `stream` (asynchronous).
+   */
+  void launch(stream_t stream) {
+    error::throw_if_exception(cudaGraphLaunch(_instance, stream),
+                              "Failed to launch the captured CUDA graph.");
+  }
+
+  bool is_captured() const { return _instance != nullptr; }
+
+  void clear() {
+    if (_instance)
+      cudaGraphExecDestroy(_instance);
+    if (_graph)
+      cudaGraphDestroy(_graph);
+    _instance = nullptr;
+    _graph = nullptr;
+  }
+
+ private:
+  stream_t _stream{nullptr};
+  cudaGraph_t _graph{nullptr};
+  cudaGraphExec_t _instance{nullptr};
+};
+
+}  // namespace gcuda
+}  // namespace gunrock
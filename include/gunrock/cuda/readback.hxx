@@ -0,0 +1,94 @@
+/**
+ * @file readback.hxx
+ * @brief Asynchronous, lagged readback of a device value into pinned memory.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <gunrock/error.hxx>
+#include <gunrock/memory.hxx>
+#include <gunrock/cuda/stream_management.hxx>
+#include <gunrock/cuda/event_management.hxx>
+
+namespace gunrock {
+namespace gcuda {
+
+/**
+ * @brief Copies a device value into pinned host memory without blocking, and
+ * reads it back one (or more) record(s) later.
+ *
+ * @par Overview
+ * An iterative algorithm can `record()` its convergence value (for example, a
+ * device flag, or the result of a reduction into device memory) at the end of
+ * every iteration and test the value of the previous iteration. By then the
+ * copy has usually completed while the GPU works on the queued iteration, such
+ * that the host never waits for the whole stream to drain. The cost is that the
+ * convergence is observed one iteration late.
+ *
+ * @tparam type_t Type of the value.
+ * @tparam SLOTS Number of values in flight, the largest usable lag is
+ * `SLOTS - 1`.
+ */
+template <typename type_t, std::size_t SLOTS = 2>
+class lagged_readback_t {
+ public:
+  lagged_readback_t() {
+    values = memory::allocate<type_t>(SLOTS * sizeof(type_t),
+                                      memory::memory_space_t::host);
+    for (auto& event : events)
+      error::throw_if_exception(
+          cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  }
+
+  lagged_readback_t(const lagged_readback_t& rhs) = delete;
+  lagged_readback_t& operator=(const lagged_readback_t& rhs) = delete;
+
+  ~lagged_readback_t() {
+    for (auto& event : events)
+      cudaEventDestroy(event);
+    memory::free(values, memory::memory_space_t::host);
+  }
+
+  /**
+   * @brief Enqueue the copy of `*value` (a device pointer) on `stream`.
+   */
+  void record(type_t const* value, stream_t stream) {
+    auto slot = recorded % SLOTS;
+    error::throw_if_exception(cudaMemcpyAsync(values + slot, value,
+                                              sizeof(type_t),
+                                              cudaMemcpyDeviceToHost, stream));
+    error::throw_if_exception(cudaEventRecord(events[slot], stream));
+    ++recorded;
+  }
+
+  /**
+   * @brief True if a value recorded `lag` records ago exists.
+   */
+  bool has_value(std::size_t lag = 1) const { return recorded > lag; }
+
+  /**
+   * @brief Value recorded `lag` records ago (`has_value(lag)` must be true),
+   * waits only for that copy.
+   */
+  type_t get(std::size_t lag = 1) {
+    auto slot = (recorded - 1 - lag) % SLOTS;
+    error::throw_if_exception(cudaEventSynchronize(events[slot]));
+    return values[slot];
+  }
+
+  /**
+   * @brief Forget the recorded values.
+   */
+  void reset() { recorded = 0; }
+
+ private:
+  type_t* values;
+  event_t events[SLOTS];
+  std::size_t recorded{0};
+};
+
+}  // namespace gcuda
+}  // namespace gunrock
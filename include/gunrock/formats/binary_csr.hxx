@@ -0,0 +1,467 @@
+/**
+ * @file binary_csr.hxx
+ * @brief Versioned, page-aligned binary container for Compressed Sparse Row
+ * (CSR) graphs. Host graphs can be memory mapped in place, device graphs are
+ * streamed from the file straight to device memory, with cuFile (GPUDirect
+ * Storage) if enabled, through double-buffered pinned staging otherwise.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gunrock/error.hxx>
+#include <gunrock/memory.hxx>
+#include <gunrock/io/detail/parallel_parse.hxx>
+
+#if ESSENTIALS_HAS_CUFILE
+#include <cufile.h>
+#endif
+
+namespace gunrock {
+namespace format {
+namespace binary {
+
+/*!
+ * Sections (and the file size) are aligned to pages, which O_DIRECT and cuFile
+ * reads require.
+ */
+constexpr std::size_t alignment = 4096;
+constexpr char magic[8] = {'G', 'R', 'C', 'S', 'R', 'B', 'I', 'N'};
+constexpr std::uint32_t version = 1;
+
+/**
+ * @brief Sections of the container, in file order.
+ */
+enum section_t { row_offsets, column_indices, nonzero_values, sections };
+
+/**
+ * @brief Layout of the container:
+ *
+ *     +--------+------+-------------+------+----------------+------+-----
+ *     | header | pad  | row_offsets | pad  | column_indices | pad  | ...
+ *     +--------+------+-------------+------+----------------+------+-----
+ *     ^-- 0           ^-- position[0]      ^-- position[1]
+ *
+ * Every section starts at a multiple of `binary::alignment`. The header holds
+ * the element sizes (such that a file is never read with mismatching types)
+ * and a checksum per section.
+ */
+struct header_t {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t header_size;
+  std::uint32_t offset_size;
+  std::uint32_t index_size;
+  std::uint32_t value_size;
+  std::uint32_t alignment;
+  std::uint64_t number_of_rows;
+  std::uint64_t number_of_columns;
+  std::uint64_t number_of_nonzeros;
+  std::uint64_t position[sections];  // Byte offset of a section in the file.
+  std::uint64_t bytes[sections];     // Size of a section in bytes.
+  std::uint64_t checksum[sections];  // @see binary::checksum().
+
+  bool is_valid() const {
+    return (std::memcmp(magic, binary::magic, sizeof(magic)) == 0) &&
+           (version == binary::version) && (header_size == sizeof(header_t));
+  }
+
+  /**
+   * @brief Throws if the file was written with other types.
+   */
+  template <typename index_t, typename offset_t, typename value_t>
+  void check_types() const {
+    error::throw_if_exception(offset_size != sizeof(offset_t) ||
+                                  index_size != sizeof(index_t) ||
+                                  value_size != sizeof(value_t),
+                              "Binary CSR was written with different types.");
+  }
+};
+
+inline std::uint64_t round_up(std::uint64_t x) {
+  return ((x + alignment - 1) / alignment) * alignment;
+}
+
+/**
+ * @brief Build the header of a CSR, sections laid out back to back (aligned).
+ */
+template <typename index_t, typename offset_t, typename value_t>
+header_t make_header(std::uint64_t rows,
+                     std::uint64_t columns,
+                     std::uint64_t nonzeros) {
+  header_t header = {};
+  std::memcpy(header.magic, binary::magic, sizeof(header.magic));
+  header.version = binary::version;
+  header.header_size = sizeof(header_t);
+  header.offset_size = sizeof(offset_t);
+  header.index_size = sizeof(index_t);
+  header.value_size = sizeof(value_t);
+  header.alignment = alignment;
+  header.number_of_rows = rows;
+  header.number_of_columns = columns;
+  header.number_of_nonzeros = nonzeros;
+
+  header.bytes[row_offsets] = (rows + 1) * sizeof(offset_t);
+  header.bytes[column_indices] = nonzeros * sizeof(index_t);
+  header.bytes[nonzero_values] = nonzeros * sizeof(value_t);
+
+  std::uint64_t position = round_up(sizeof(header_t));
+  for (int s = 0; s < sections; ++s) {
+    header.position[s] = position;
+    position = round_up(position + header.bytes[s]);
+  }
+  return header;
+}
+
+/**
+ * @brief 64-bit FNV-1a over 8-byte words (and the trailing bytes). Chaining
+ * the hash of consecutive pieces (passing the previous hash as `hash`) equals
+ * the hash of the whole, as long as every piece but the last is a multiple of
+ * 8 bytes.
+ */
+inline std::uint64_t checksum(void const* data,
+                              std::size_t bytes,
+                              std::uint64_t hash = 0xcbf29ce484222325ull) {
+  constexpr std::uint64_t prime = 0x100000001b3ull;
+  auto p = static_cast<unsigned char const*>(data);
+
+  std::size_t words = bytes / sizeof(std::uint64_t);
+  for (std::size_t i = 0; i < words; ++i) {
+    std::uint64_t word;
+    std::memcpy(&word, p + i * sizeof(word), sizeof(word));
+    hash = (hash ^ word) * prime;
+  }
+  for (std::size_t i = words * sizeof(std::uint64_t); i < bytes; ++i)
+    hash = (hash ^ p[i]) * prime;
+  return hash;
+}
+
+namespace detail {
+
+inline void write_all(int descriptor,
+                      void const* data,
+                      std::size_t bytes,
+                      std::uint64_t position) {
+  auto p = static_cast<char const*>(data);
+  while (bytes > 0) {
+    auto written = ::pwrite(descriptor, p, bytes, position);
+    error::throw_if_exception(written <= 0, "Failed to write binary CSR.");
+    p += written;
+    bytes -= written;
+    position += written;
+  }
+}
+
+inline void read_all(int descriptor,
+                     void* data,
+                     std::size_t bytes,
+                     std::uint64_t position) {
+  auto p = static_cast<char*>(data);
+  while (bytes > 0) {
+    auto read = ::pread(descriptor, p, bytes, position);
+    error::throw_if_exception(read <= 0, "Failed to read binary CSR.");
+    p += read;
+    bytes -= read;
+    position += read;
+  }
+}
+
+/**
+ * @brief Owns a file descriptor.
+ */
+struct file_t {
+  int descriptor;
+  file_t(std::string const& filename, int flags, mode_t mode = 0644)
+      : descriptor(::open(filename.c_str(), flags, mode)) {
+    error::throw_if_exception(descriptor < 0,
+                              "File could not be opened: " + filename);
+  }
+  file_t(const file_t& rhs) = delete;
+  file_t& operator=(const file_t& rhs) = delete;
+  ~file_t() { ::close(descriptor); }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Write the header and the sections (host pointers) to `filename`, the
+ * checksums of the header are computed here.
+ */
+inline void write(std::string const& filename,
+                  header_t header,
+                  void const* const data[sections]) {
+  for (int s = 0; s < sections; ++s)
+    header.checksum[s] = checksum(data[s], header.bytes[s]);
+
+  detail::file_t file(filename, O_WRONLY | O_CREAT | O_TRUNC);
+  detail::write_all(file.descriptor, &header, sizeof(header), 0);
+  for (int s = 0; s < sections; ++s)
+    detail::write_all(file.descriptor, data[s], header.bytes[s],
+                      header.position[s]);
+
+  // Pad the file to a whole page.
+  auto last = header.position[sections - 1] + header.bytes[sections - 1];
+  error::throw_if_exception(::ftruncate(file.descriptor, round_up(last)) != 0,
+                            "Failed to write binary CSR.");
+}
+
+/**
+ * @brief Read the header of `filename`, returns false if the file is not a
+ * (supported) binary CSR container.
+ */
+inline bool read_header(std::string const& filename, header_t& header) {
+  detail::file_t file(filename, O_RDONLY);
+  auto read = ::pread(file.descriptor, &header, sizeof(header), 0);
+  return (read == sizeof(header)) && header.is_valid();
+}
+
+/**
+ * @brief Read the sections into host memory.
+ *
+ * @param verify if true, throws if a section does not match its checksum.
+ */
+inline void read_to_host(std::string const& filename,
+                         header_t const& header,
+                         void* const data[sections],
+                         bool verify = false) {
+  detail::file_t file(filename, O_RDONLY);
+  for (int s = 0; s < sections; ++s) {
+    detail::read_all(file.descriptor, data[s], header.bytes[s],
+                     header.position[s]);
+    error::throw_if_exception(
+        verify && checksum(data[s], header.bytes[s]) != header.checksum[s],
+        "Binary CSR checksum mismatch.");
+  }
+}
+
+/**
+ * @brief Streams file ranges into device memory through two pinned buffers,
+ * the read of a chunk overlaps with the copy of the previous one.
+ */
+class staging_reader_t {
+ public:
+  staging_reader_t(std::size_t _chunk_bytes = std::size_t(64) << 20)
+      : chunk_bytes(_chunk_bytes) {
+    for (int k = 0; k < 2; ++k) {
+      buffers[k] = memory::allocate<char>(chunk_bytes,
+                                          memory::memory_space_t::host);
+      error::throw_if_exception(
+          cudaEventCreateWithFlags(&copied[k], cudaEventDisableTiming));
+    }
+    error::throw_if_exception(
+        cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  }
+
+  staging_reader_t(const staging_reader_t& rhs) = delete;
+  staging_reader_t& operator=(const staging_reader_t& rhs) = delete;
+
+  ~staging_reader_t() {
+    cudaStreamSynchronize(stream);
+    for (int k = 0; k < 2; ++k) {
+      cudaEventDestroy(copied[k]);
+      memory::free(buffers[k], memory::memory_space_t::host);
+    }
+    cudaStreamDestroy(stream);
+  }
+
+  /**
+   * @brief Read `bytes` bytes at `position` of `descriptor` into `device`,
+   * returns the checksum of the bytes if `verify` (0 otherwise).
+   */
+  std::uint64_t read(int descriptor,
+                     std::uint64_t position,
+                     void* device,
+                     std::size_t bytes,
+                     bool verify) {
+    std::uint64_t hash = checksum(nullptr, 0);
+    auto destination = static_cast<char*>(device);
+
+    for (std::size_t offset = 0, k = 0; offset < bytes;
+         offset += chunk_bytes, k ^= 1) {
+      auto size = std::min(chunk_bytes, bytes - offset);
+
+      // Wait until the previous copy out of this buffer completed.
+      error::throw_if_exception(cudaEventSynchronize(copied[k]));
+      detail::read_all(descriptor, buffers[k], size, position + offset);
+      if (verify)
+        hash = checksum(buffers[k], size, hash);
+
+      error::throw_if_exception(
+          cudaMemcpyAsync(destination + offset, buffers[k], size,
+                          cudaMemcpyHostToDevice, stream));
+      error::throw_if_exception(cudaEventRecord(copied[k], stream));
+    }
+
+    error::throw_if_exception(cudaStreamSynchronize(stream));
+    return verify ? hash : 0;
+  }
+
+ private:
+  std::size_t chunk_bytes;
+  char* buffers[2];
+  cudaEvent_t copied[2];
+  cudaStream_t stream;
+};
+
+#if ESSENTIALS_HAS_CUFILE
+/**
+ * @brief Read the sections directly into device memory with cuFile (DMA from
+ * storage to the GPU, no bounce through host memory). Returns false if the
+ * file cannot be used with GPUDirect Storage.
+ */
+inline bool read_with_gds(std::string const& filename,
+                          header_t const& header,
+                          void* const data[sections]) {
+  if (cuFileDriverOpen().err != CU_FILE_SUCCESS)
+    return false;
+
+  int descriptor = ::open(filename.c_str(), O_RDONLY | O_DIRECT);
+  if (descriptor < 0)
+    return false;
+
+  CUfileDescr_t description = {};
+  description.handle.fd = descriptor;
+  description.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+
+  CUfileHandle_t handle;
+  if (cuFileHandleRegister(&handle, &description).err != CU_FILE_SUCCESS) {
+    ::close(descriptor);
+    return false;
+  }
+
+  bool complete = true;
+  for (int s = 0; s < sections && complete; ++s)
+    complete = (cuFileRead(handle, data[s], header.bytes[s],
+                           header.position[s], 0) == (ssize_t)header.bytes[s]);
+
+  cuFileHandleDeregister(handle);
+  ::close(descriptor);
+  error::throw_if_exception(!complete, "Failed to read binary CSR (cuFile).");
+  return true;
+}
+#endif
+
+/**
+ * @brief Read the sections into device memory, with GPUDirect Storage if the
+ * library was built with it (`ESSENTIALS_HAS_CUFILE`), unless checksums must be
+ * verified, through pinned staging buffers otherwise.
+ *
+ * @param verify if true, throws if a section does not match its checksum.
+ */
+inline void read_to_device(std::string const& filename,
+                           header_t const& header,
+                           void* const data[sections],
+                           bool verify = false) {
+#if ESSENTIALS_HAS_CUFILE
+  if (!verify && read_with_gds(filename, header, data))
+    return;
+#endif
+
+  detail::file_t file(filename, O_RDONLY);
+  staging_reader_t reader;
+  for (int s = 0; s < sections; ++s) {
+    auto hash = reader.read(file.descriptor, header.position[s], data[s],
+                            header.bytes[s], verify);
+    error::throw_if_exception(verify && hash != header.checksum[s],
+                              "Binary CSR checksum mismatch.");
+  }
+}
+
+/**
+ * @brief Pointer and size of an array inside a mapping.
+ */
+template <typename type_t>
+struct mapped_array_t {
+  type_t* pointer{nullptr};
+  std::size_t length{0};
+
+  type_t* data() const { return pointer; }
+  std::size_t size() const { return length; }
+  type_t& operator[](std::size_t i) const { return pointer[i]; }
+};
+
+}  // namespace binary
+
+/**
+ * @brief Zero-copy host CSR, a read-only memory mapping of a binary CSR
+ * container. It can set a host graph view in place
+ * (`G.template set<csr_view_t>(mapped)`) and must outlive the graph.
+ *
+ * @tparam index_t
+ * @tparam offset_t
+ * @tparam value_t
+ */
+template <typename index_t, typename offset_t, typename value_t>
+struct mapped_csr_t {
+  using index_type = index_t;
+  using offset_type = offset_t;
+  using value_type = value_t;
+
+  io::detail::mapped_file_t file;
+  binary::header_t header;
+
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;
+
+  // Read-only (the mapping is not writable).
+  binary::mapped_array_t<offset_t> row_offsets;    // Ap
+  binary::mapped_array_t<index_t> column_indices;  // Aj
+  binary::mapped_array_t<value_t> nonzero_values;  // Ax
+
+  mapped_csr_t(std::string const& filename) : file(filename) {
+    error::throw_if_exception(file.size() < sizeof(header),
+                              "Not a binary CSR: " + filename);
+    std::memcpy(&header, file.begin(), sizeof(header));
+    error::throw_if_exception(!header.is_valid(),
+                              "Not a binary CSR: " + filename);
+    header.check_types<index_t, offset_t, value_t>();
+
+    auto last = header.position[binary::sections - 1] +
+                header.bytes[binary::sections - 1];
+    error::throw_if_exception(file.size() < last,
+                              "Truncated binary CSR: " + filename);
+
+    number_of_rows = header.number_of_rows;
+    number_of_columns = header.number_of_columns;
+    number_of_nonzeros = header.number_of_nonzeros;
+
+    row_offsets = section<offset_t>(binary::row_offsets);
+    column_indices = section<index_t>(binary::column_indices);
+    nonzero_values = section<value_t>(binary::nonzero_values);
+  }
+
+  /**
+   * @brief Throws if a section does not match its checksum (reads the whole
+   * file).
+   */
+  void verify() const {
+    for (int s = 0; s < binary::sections; ++s)
+      error::throw_if_exception(
+          binary::checksum(file.begin() + header.position[s],
+                           header.bytes[s]) != header.checksum[s],
+          "Binary CSR checksum mismatch.");
+  }
+
+ private:
+  template <typename type_t>
+  binary::mapped_array_t<type_t> section(int s) const {
+    auto address = const_cast<char*>(file.begin()) + header.position[s];
+    return {reinterpret_cast<type_t*>(address),
+            header.bytes[s] / sizeof(type_t)};
+  }
+};  // struct mapped_csr_t
+
+}  // namespace format
+}  // namespace gunrock
@@ -0,0 +1,170 @@
+/**
+ * @file compressed_csr.hxx
+ * @brief Compressed Sparse Row format with bit-packed column indices, each
+ * block of 32 consecutive column indices is stored as deltas from its smallest
+ * index, packed with the fewest bits that fit the largest delta.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/error.hxx>
+
+#include <gunrock/container/vector.hxx>
+#include <gunrock/formats/formats.hxx>
+
+namespace gunrock {
+namespace format {
+
+using namespace memory;
+
+/**
+ * @brief Compressed Sparse Row (CSR) format whose column indices are bit-packed
+ * per block of `block_size` edges.
+ *
+ * @par Overview
+ * The adjacency list of every row is sorted, and the column indices are split
+ * into blocks of 32 consecutive edges. Block `b` stores the smallest index of
+ * the block, `block_bases[b]`, and the deltas of the indices from it, packed
+ * with `w` bits each into `w` 32-bit words starting at `block_words[b]` (`w` is
+ * `block_words[b + 1] - block_words[b]`). Sorted adjacency lists make the
+ * deltas small, and every index can be decoded independently (two word loads
+ * at most), such that edge-parallel kernels access edges in any order. Row
+ * offsets and nonzero values are stored as in `csr_t`.
+ *
+ * @tparam index_t Column index type (at most 32 bits).
+ * @tparam offset_t
+ * @tparam value_t
+ */
+template <memory_space_t space,
+          typename index_t,
+          typename offset_t,
+          typename value_t>
+struct compressed_csr_t {
+  static_assert(sizeof(index_t) <= sizeof(std::uint32_t),
+                "Compressed column indices are at most 32 bits.");
+
+  using index_type = index_t;
+  using offset_type = offset_t;
+  using value_type = value_t;
+  using word_type = std::uint32_t;
+
+  static constexpr std::size_t block_size = 32;
+
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;
+
+  vector_t<offset_t, space> row_offsets;     // Ap
+  vector_t<index_t, space> block_bases;      // Smallest index per block.
+  vector_t<offset_t, space> block_words;     // First packed word per block.
+  vector_t<word_type, space> packed_deltas;  // Bit-packed deltas.
+  vector_t<value_t, space> nonzero_values;   // Ax
+
+  compressed_csr_t()
+      : number_of_rows(0), number_of_columns(0), number_of_nonzeros(0) {}
+
+  /**
+   * @brief Compress a CSR (host or device), the adjacency lists are sorted
+   * (with their nonzero values) if they are not already.
+   */
+  template <memory_space_t input_space>
+  compressed_csr_t<space, index_t, offset_t, value_t> from_csr(
+      csr_t<input_space, index_t, offset_t, value_t> const& csr) {
+    number_of_rows = csr.number_of_rows;
+    number_of_columns = csr.number_of_columns;
+    number_of_nonzeros = csr.number_of_nonzeros;
+
+    thrust::host_vector<offset_t> Ap = csr.row_offsets;
+    thrust::host_vector<index_t> Aj = csr.column_indices;
+    thrust::host_vector<value_t> Ax = csr.nonzero_values;
+
+    // Sort the adjacency lists.
+    std::vector<std::pair<index_t, value_t>> row;
+    for (index_t r = 0; r < number_of_rows; ++r) {
+      if (std::is_sorted(Aj.begin() + Ap[r], Aj.begin() + Ap[r + 1]))
+        continue;
+      row.clear();
+      for (auto e = Ap[r]; e < Ap[r + 1]; ++e)
+        row.emplace_back(Aj[e], Ax[e]);
+      std::sort(row.begin(), row.end());
+      for (auto e = Ap[r]; e < Ap[r + 1]; ++e) {
+        Aj[e] = row[e - Ap[r]].first;
+        Ax[e] = row[e - Ap[r]].second;
+      }
+    }
+
+    // Pick the base and the width of every block.
+    std::size_t number_of_blocks =
+        (number_of_nonzeros + block_size - 1) / block_size;
+    thrust::host_vector<index_t> bases(number_of_blocks);
+    thrust::host_vector<offset_t> words(number_of_blocks + 1);
+
+    words[0] = 0;
+    for (std::size_t b = 0; b < number_of_blocks; ++b) {
+      auto first = Aj.begin() + b * block_size;
+      auto last = Aj.begin() + std::min<std::size_t>((b + 1) * block_size,
+                                                     number_of_nonzeros);
+      auto [smallest, largest] = std::minmax_element(first, last);
+      bases[b] = *smallest;
+      words[b + 1] = words[b] + width(word_type(*largest - *smallest));
+    }
+
+    // Pack the deltas, a block of width w fills exactly w words.
+    thrust::host_vector<word_type> packed(words[number_of_blocks], 0);
+    for (offset_t e = 0; e < number_of_nonzeros; ++e) {
+      std::size_t b = e / block_size;
+      std::size_t w = words[b + 1] - words[b];
+      if (w == 0)
+        continue;
+
+      std::uint64_t delta = word_type(Aj[e] - bases[b]);
+      std::size_t bit = (e % block_size) * w;
+      std::size_t word = words[b] + bit / 32;
+      std::size_t shift = bit % 32;
+
+      packed[word] |= word_type(delta << shift);
+      if (shift + w > 32)
+        packed[word + 1] |= word_type(delta >> (32 - shift));
+    }
+
+    row_offsets = Ap;
+    block_bases = bases;
+    block_words = words;
+    packed_deltas = packed;
+    nonzero_values = Ax;
+
+    return *this;
+  }
+
+  /**
+   * @brief Bytes used by the row offsets and the column indices (the nonzero
+   * values are uncompressed).
+   */
+  std::size_t get_index_bytes() const {
+    return row_offsets.size() * sizeof(offset_t) +
+           block_bases.size() * sizeof(index_t) +
+           block_words.size() * sizeof(offset_t) +
+           packed_deltas.size() * sizeof(word_type);
+  }
+
+ private:
+  static std::size_t width(word_type x) {
+    std::size_t bits = 0;
+    for (; x != 0; x >>= 1)
+      ++bits;
+    return bits;
+  }
+};  // struct compressed_csr_t
+
+}  // namespace format
+}  // namespace gunrock
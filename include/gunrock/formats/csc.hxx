@@ -85,7 +85,7 @@ struct csc_t {
 
     // Convert column indices to offsets
     using execution_policy_t =
-        std::conditional_t<space == memory_space_t::device,
+        std::conditional_t<space != memory_space_t::host,
                            decltype(thrust::device), decltype(thrust::host)>;
     execution_policy_t exec;
 
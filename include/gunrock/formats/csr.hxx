@@ -5,6 +5,7 @@
 
 #include <gunrock/container/vector.hxx>
 #include <gunrock/formats/formats.hxx>
+#include <gunrock/formats/binary_csr.hxx>
 
 #include <thrust/transform.h>
 
@@ -139,92 +140,106 @@ struct csr_t {
     return *this;  // CSR representation (with possible duplicates)
   }
 
-  void read_binary(std::string filename) {
-    FILE* file = fopen(filename.c_str(), "rb");
+  /**
+   * @brief Read a binary CSR container (@see binary::header_t) written by
+   * `write_binary()`, device CSRs are streamed straight to device memory.
+   * Files without a container header are read in the legacy layout (sizes
+   * followed by the unaligned arrays).
+   *
+   * @param filename binary CSR file (.csr)
+   * @param verify if true, throws if the data does not match its checksums.
+   */
+  void read_binary(std::string filename, bool verify = false) {
+    binary::header_t header;
+    if (!binary::read_header(filename, header)) {
+      read_legacy_binary(filename);
+      return;
+    }
 
-    // Read metadata
-    error::throw_if_exception(
-        fread(&number_of_rows, sizeof(index_t), 1, file) != 0);
-    error::throw_if_exception(
-        fread(&number_of_columns, sizeof(index_t), 1, file) != 0);
-    error::throw_if_exception(
-        fread(&number_of_nonzeros, sizeof(offset_t), 1, file) != 0);
+    header.check_types<index_t, offset_t, value_t>();
+    number_of_rows = header.number_of_rows;
+    number_of_columns = header.number_of_columns;
+    number_of_nonzeros = header.number_of_nonzeros;
 
     row_offsets.resize(number_of_rows + 1);
     column_indices.resize(number_of_nonzeros);
     nonzero_values.resize(number_of_nonzeros);
 
-    if (space == memory_space_t::device) {
-      assert(space == memory_space_t::device);
-
-      thrust::host_vector<offset_t> h_row_offsets(number_of_rows + 1);
-      thrust::host_vector<index_t> h_column_indices(number_of_nonzeros);
-      thrust::host_vector<value_t> h_nonzero_values(number_of_nonzeros);
-
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(h_row_offsets.data()),
-                sizeof(offset_t), number_of_rows + 1, file) != 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(h_column_indices.data()),
-                sizeof(index_t), number_of_nonzeros, file) != 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(h_nonzero_values.data()),
-                sizeof(value_t), number_of_nonzeros, file) != 0);
-
-      // Copy data from host to device
-      row_offsets = h_row_offsets;
-      column_indices = h_column_indices;
-      nonzero_values = h_nonzero_values;
+    void* const data[binary::sections] = {
+        memory::raw_pointer_cast(row_offsets.data()),
+        memory::raw_pointer_cast(column_indices.data()),
+        memory::raw_pointer_cast(nonzero_values.data())};
 
-    } else {
-      assert(space == memory_space_t::host);
-
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(row_offsets.data()), sizeof(offset_t),
-                number_of_rows + 1, file) != 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(column_indices.data()),
-                sizeof(index_t), number_of_nonzeros, file) != 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(nonzero_values.data()),
-                sizeof(value_t), number_of_nonzeros, file) != 0);
-    }
+    if (space == memory_space_t::device)
+      binary::read_to_device(filename, header, data, verify);
+    else
+      binary::read_to_host(filename, header, data, verify);
   }
 
+  /**
+   * @brief Write a versioned, page-aligned binary CSR container with
+   * checksums, @see binary::header_t.
+   *
+   * @param filename binary CSR file (.csr)
+   */
   void write_binary(std::string filename) {
-    FILE* file = fopen(filename.c_str(), "wb");
+    auto header = binary::make_header<index_t, offset_t, value_t>(
+        number_of_rows, number_of_columns, number_of_nonzeros);
 
-    // Write metadata
-    fwrite(&number_of_rows, sizeof(index_t), 1, file);
-    fwrite(&number_of_columns, sizeof(index_t), 1, file);
-    fwrite(&number_of_nonzeros, sizeof(offset_t), 1, file);
-
-    // Write data
     if (space == memory_space_t::device) {
-      assert(space == memory_space_t::device);
-
       thrust::host_vector<offset_t> h_row_offsets(row_offsets);
       thrust::host_vector<index_t> h_column_indices(column_indices);
       thrust::host_vector<value_t> h_nonzero_values(nonzero_values);
 
-      fwrite(memory::raw_pointer_cast(h_row_offsets.data()), sizeof(offset_t),
-             number_of_rows + 1, file);
-      fwrite(memory::raw_pointer_cast(h_column_indices.data()), sizeof(index_t),
-             number_of_nonzeros, file);
-      fwrite(memory::raw_pointer_cast(h_nonzero_values.data()), sizeof(value_t),
-             number_of_nonzeros, file);
+      void const* const data[binary::sections] = {
+          memory::raw_pointer_cast(h_row_offsets.data()),
+          memory::raw_pointer_cast(h_column_indices.data()),
+          memory::raw_pointer_cast(h_nonzero_values.data())};
+      binary::write(filename, header, data);
     } else {
-      assert(space == memory_space_t::host);
-
-      fwrite(memory::raw_pointer_cast(row_offsets.data()), sizeof(offset_t),
-             number_of_rows + 1, file);
-      fwrite(memory::raw_pointer_cast(column_indices.data()), sizeof(index_t),
-             number_of_nonzeros, file);
-      fwrite(memory::raw_pointer_cast(nonzero_values.data()), sizeof(value_t),
-             number_of_nonzeros, file);
+      void const* const data[binary::sections] = {
+          memory::raw_pointer_cast(row_offsets.data()),
+          memory::raw_pointer_cast(column_indices.data()),
+          memory::raw_pointer_cast(nonzero_values.data())};
+      binary::write(filename, header, data);
     }
+  }
+
+ private:
+  void read_legacy_binary(std::string filename) {
+    FILE* file = fopen(filename.c_str(), "rb");
+    error::throw_if_exception(file == NULL,
+                              "File could not be opened: " + filename);
 
+    // Read metadata
+    error::throw_if_exception(
+        fread(&number_of_rows, sizeof(index_t), 1, file) != 1);
+    error::throw_if_exception(
+        fread(&number_of_columns, sizeof(index_t), 1, file) != 1);
+    error::throw_if_exception(
+        fread(&number_of_nonzeros, sizeof(offset_t), 1, file) != 1);
+
+    thrust::host_vector<offset_t> h_row_offsets(number_of_rows + 1);
+    thrust::host_vector<index_t> h_column_indices(number_of_nonzeros);
+    thrust::host_vector<value_t> h_nonzero_values(number_of_nonzeros);
+
+    error::throw_if_exception(
+        fread(memory::raw_pointer_cast(h_row_offsets.data()), sizeof(offset_t),
+              number_of_rows + 1, file) != (std::size_t)(number_of_rows + 1));
+    error::throw_if_exception(
+        fread(memory::raw_pointer_cast(h_column_indices.data()),
+              sizeof(index_t), number_of_nonzeros,
+              file) != (std::size_t)number_of_nonzeros);
+    error::throw_if_exception(
+        fread(memory::raw_pointer_cast(h_nonzero_values.data()),
+              sizeof(value_t), number_of_nonzeros,
+              file) != (std::size_t)number_of_nonzeros);
     fclose(file);
+
+    // Copy data from host (to device)
+    row_offsets = h_row_offsets;
+    column_indices = h_column_indices;
+    nonzero_values = h_nonzero_values;
   }
 
 };  // struct csr_t
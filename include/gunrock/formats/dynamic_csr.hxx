@@ -0,0 +1,433 @@
+/**
+ * @file dynamic_csr.hxx
+ * @brief Gapped Compressed Sparse Row format, every row keeps free slots after
+ * its edges such that batches of edges can be inserted (and deleted) in place.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/memory.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/util/math.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+#include <gunrock/container/vector.hxx>
+#include <gunrock/formats/formats.hxx>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+namespace gunrock {
+namespace format {
+
+using namespace memory;
+
+/**
+ * @brief Batch of (directed) edges of a graph update, stored on the device.
+ *
+ * @tparam index_t Vertex type.
+ * @tparam value_t Edge weight type.
+ */
+template <typename index_t, typename value_t>
+struct edge_batch_t {
+  thrust::device_vector<index_t> sources;
+  thrust::device_vector<index_t> destinations;
+  thrust::device_vector<value_t> values;
+
+  edge_batch_t() = default;
+  edge_batch_t(std::size_t size)
+      : sources(size), destinations(size), values(size) {}
+
+  std::size_t size() const { return sources.size(); }
+
+  void resize(std::size_t size) {
+    sources.resize(size);
+    destinations.resize(size);
+    values.resize(size);
+  }
+
+  /**
+   * @brief Sort the edges by (source, destination) and drop the repeated
+   * pairs, the first of the repeated edges is kept.
+   */
+  void sort_and_unique(gcuda::stream_t stream = 0) {
+    auto policy = thrust::cuda::par.on(stream);
+    auto keys = thrust::make_zip_iterator(
+        thrust::make_tuple(sources.begin(), destinations.begin()));
+    thrust::stable_sort_by_key(policy, keys, keys + size(), values.begin());
+    auto last = thrust::unique_by_key(policy, keys, keys + size(),
+                                      values.begin());
+    resize(thrust::get<1>(last) - values.begin());
+  }
+};
+
+/**
+ * @brief Compressed Sparse Row (CSR) format with free slots (gaps) after every
+ * row, updated in place by batches of edge insertions and deletions.
+ *
+ * @par Overview
+ * Row `v` owns the slots `[row_offsets[v], row_offsets[v + 1])`, of which the
+ * first `row_sizes[v]` hold its edges (unsorted) and the rest are free (their
+ * column index is `invalid()`). An insertion batch appends the new edges of
+ * every row into its free slots; rows without enough free slots are regrown
+ * (all rows are relaid out once, each overflowing row receiving
+ * `slack_factor` times its degree of free slots). A deletion moves the last
+ * edge of the row into the freed slot. Both return the edges actually
+ * applied, which incremental algorithms use to repair their previous result.
+ * Each row is updated by a single thread, such that rows with many updates
+ * per batch (hubs) serialize.
+ *
+ * @tparam space Memory space, only device is supported.
+ * @tparam index_t
+ * @tparam offset_t
+ * @tparam value_t
+ */
+template <memory_space_t space,
+          typename index_t,
+          typename offset_t,
+          typename value_t>
+struct dynamic_csr_t {
+  static_assert(space == memory_space_t::device,
+                "Dynamic CSR is updated on the device.");
+
+  using index_type = index_t;
+  using offset_type = offset_t;
+  using value_type = value_t;
+  using edge_batch_type = edge_batch_t<index_t, value_t>;
+
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;  // Edges (without the free slots).
+
+  vector_t<offset_t, space> row_offsets;    // First slot per row.
+  vector_t<offset_t, space> row_sizes;      // Edges per row.
+  vector_t<index_t, space> column_indices;  // Slots, invalid() if free.
+  vector_t<value_t, space> nonzero_values;  // Slots.
+
+  /*!
+   * Free slots given to a regrown row, relative to its degree (and at least
+   * `minimum_slack`).
+   */
+  float slack_factor;
+  offset_t minimum_slack;
+
+  dynamic_csr_t(float _slack_factor = 0.5f, offset_t _minimum_slack = 4)
+      : number_of_rows(0),
+        number_of_columns(0),
+        number_of_nonzeros(0),
+        slack_factor(_slack_factor),
+        minimum_slack(_minimum_slack) {}
+
+  /**
+   * @brief Number of slots (edges and free slots), edge ids of the graph view
+   * range over the slots.
+   */
+  std::size_t get_number_of_slots() const { return column_indices.size(); }
+
+  /**
+   * @brief Lay out a CSR (host or device) with free slots after every row.
+   */
+  template <memory_space_t input_space>
+  dynamic_csr_t<space, index_t, offset_t, value_t> from_csr(
+      csr_t<input_space, index_t, offset_t, value_t> const& csr,
+      gcuda::stream_t stream = 0) {
+    number_of_rows = csr.number_of_rows;
+    number_of_columns = csr.number_of_columns;
+    number_of_nonzeros = csr.number_of_nonzeros;
+
+    row_offsets = csr.row_offsets;
+    column_indices = csr.column_indices;
+    nonzero_values = csr.nonzero_values;
+
+    row_sizes.resize(number_of_rows);
+    thrust::transform(thrust::cuda::par.on(stream), row_offsets.begin() + 1,
+                      row_offsets.end(), row_offsets.begin(),
+                      row_sizes.begin(), thrust::minus<offset_t>());
+
+    regrow(nullptr, true, stream);
+    return *this;
+  }
+
+  /**
+   * @brief Insert a batch of edges, repeated edges (within the batch or with
+   * the graph) and edges with out of range vertices are ignored.
+   *
+   * @param batch Edges to insert.
+   * @param stream Stream to update on (the call is synchronous).
+   * @return edge_batch_type Edges inserted, sorted by (source, destination).
+   */
+  edge_batch_type insert_edges(edge_batch_type batch,
+                               gcuda::stream_t stream = 0) {
+    auto policy = thrust::cuda::par.on(stream);
+    batch.sort_and_unique(stream);
+
+    std::size_t n_batch = batch.size();
+    auto n_rows = number_of_rows;
+    auto n_columns = number_of_columns;
+    auto offsets = row_offsets.data().get();
+    auto sizes = row_sizes.data().get();
+    auto indices = column_indices.data().get();
+    auto sources = batch.sources.data().get();
+    auto destinations = batch.destinations.data().get();
+
+    // Keep the edges that are not in the graph yet.
+    thrust::device_vector<int> keep(n_batch);
+    thrust::transform(
+        policy, thrust::make_counting_iterator<std::size_t>(0),
+        thrust::make_counting_iterator<std::size_t>(n_batch), keep.begin(),
+        [=] __device__(std::size_t const& i) -> int {
+          index_t s = sources[i];
+          index_t d = destinations[i];
+          if (s < 0 || s >= n_rows || d < 0 || d >= n_columns)
+            return 0;
+          for (offset_t e = offsets[s]; e < offsets[s] + sizes[s]; ++e)
+            if (indices[e] == d)
+              return 0;
+          return 1;
+        });
+
+    auto applied = compact(batch, keep, stream);
+    std::size_t n_applied = applied.size();
+    if (n_applied == 0)
+      return applied;
+
+    // Regrow if any row runs out of free slots.
+    thrust::device_vector<offset_t> pending(n_rows, 0);
+    auto pending_counts = pending.data().get();
+    auto applied_sources = applied.sources.data().get();
+    thrust::for_each(policy, thrust::make_counting_iterator<std::size_t>(0),
+                     thrust::make_counting_iterator<std::size_t>(n_applied),
+                     [=] __device__(std::size_t const& i) {
+                       math::atomic::add(&pending_counts[applied_sources[i]],
+                                         (offset_t)1);
+                     });
+
+    auto overflows = thrust::count_if(
+        policy, thrust::make_counting_iterator<index_t>(0),
+        thrust::make_counting_iterator<index_t>(n_rows),
+        [=] __device__(index_t const& v) -> bool {
+          return sizes[v] + pending_counts[v] > offsets[v + 1] - offsets[v];
+        });
+
+    if (overflows > 0)
+      regrow(pending_counts, false, stream);
+
+    // Append (the layout may have changed).
+    offsets = row_offsets.data().get();
+    indices = column_indices.data().get();
+    auto values = nonzero_values.data().get();
+    auto applied_destinations = applied.destinations.data().get();
+    auto applied_values = applied.values.data().get();
+    thrust::for_each(
+        policy, thrust::make_counting_iterator<std::size_t>(0),
+        thrust::make_counting_iterator<std::size_t>(n_applied),
+        [=] __device__(std::size_t const& i) {
+          index_t s = applied_sources[i];
+          offset_t slot =
+              offsets[s] + math::atomic::add(&sizes[s], (offset_t)1);
+          indices[slot] = applied_destinations[i];
+          values[slot] = applied_values[i];
+        });
+
+    number_of_nonzeros += n_applied;
+    return applied;
+  }
+
+  /**
+   * @brief Delete a batch of edges, edges not in the graph are ignored (the
+   * values of the batch are ignored).
+   *
+   * @param batch Edges to delete.
+   * @param stream Stream to update on (the call is synchronous).
+   * @return edge_batch_type Edges deleted with their values, sorted by
+   * (source, destination).
+   */
+  edge_batch_type delete_edges(edge_batch_type batch,
+                               gcuda::stream_t stream = 0) {
+    auto policy = thrust::cuda::par.on(stream);
+    batch.sort_and_unique(stream);
+
+    std::size_t n_batch = batch.size();
+    auto n_rows = number_of_rows;
+
+    // One segment of the batch per row.
+    thrust::device_vector<index_t> rows(n_batch);
+    thrust::device_vector<offset_t> starts(n_batch + 1, 0);
+    auto last = thrust::reduce_by_key(
+        policy, batch.sources.begin(), batch.sources.end(),
+        thrust::make_constant_iterator<offset_t>(1), rows.begin(),
+        starts.begin());
+    std::size_t n_segments = last.first - rows.begin();
+    thrust::exclusive_scan(policy, starts.begin(),
+                           starts.begin() + n_segments + 1, starts.begin());
+
+    auto offsets = row_offsets.data().get();
+    auto sizes = row_sizes.data().get();
+    auto indices = column_indices.data().get();
+    auto values = nonzero_values.data().get();
+    auto segment_rows = rows.data().get();
+    auto segment_starts = starts.data().get();
+    auto destinations = batch.destinations.data().get();
+    auto deleted_values = batch.values.data().get();
+
+    thrust::device_vector<int> found(n_batch, 0);
+    auto deleted = found.data().get();
+
+    thrust::for_each(
+        policy, thrust::make_counting_iterator<std::size_t>(0),
+        thrust::make_counting_iterator<std::size_t>(n_segments),
+        [=] __device__(std::size_t const& k) {
+          index_t s = segment_rows[k];
+          if (s < 0 || s >= n_rows)
+            return;
+          for (auto i = segment_starts[k]; i < segment_starts[k + 1]; ++i) {
+            offset_t first = offsets[s];
+            offset_t end = first + sizes[s];
+            for (offset_t e = first; e < end; ++e) {
+              if (indices[e] != destinations[i])
+                continue;
+              deleted_values[i] = values[e];
+              indices[e] = indices[end - 1];
+              values[e] = values[end - 1];
+              indices[end - 1] = gunrock::numeric_limits<index_t>::invalid();
+              sizes[s] -= 1;
+              deleted[i] = 1;
+              break;
+            }
+          }
+        });
+
+    auto applied = compact(batch, found, stream);
+    number_of_nonzeros -= applied.size();
+    return applied;
+  }
+
+  /**
+   * @brief Relay out the slots, rows whose edges and `pending` insertions
+   * exceed their slots (or all rows) are given `slack_factor` free slots.
+   *
+   * @param pending Insertions per row (device), or nullptr.
+   * @param all_rows Regrow every row.
+   * @param stream Stream to relay out on (the call is synchronous).
+   */
+  void regrow(offset_t const* pending,
+              bool all_rows,
+              gcuda::stream_t stream = 0) {
+    auto policy = thrust::cuda::par.on(stream);
+    auto n_rows = number_of_rows;
+    auto offsets = row_offsets.data().get();
+    auto sizes = row_sizes.data().get();
+    auto slack = slack_factor;
+    auto min_slack = minimum_slack;
+
+    vector_t<offset_t, space> new_offsets(n_rows + 1, 0);
+    thrust::transform(
+        policy, thrust::make_counting_iterator<index_t>(0),
+        thrust::make_counting_iterator<index_t>(n_rows), new_offsets.begin(),
+        [=] __device__(index_t const& v) -> offset_t {
+          offset_t slots = offsets[v + 1] - offsets[v];
+          offset_t needed = sizes[v] + (pending ? pending[v] : 0);
+          if (!all_rows && needed <= slots)
+            return slots;
+          offset_t free_slots = needed * slack;
+          return needed + (free_slots > min_slack ? free_slots : min_slack);
+        });
+    thrust::exclusive_scan(policy, new_offsets.begin(), new_offsets.end(),
+                           new_offsets.begin());
+
+    offset_t n_slots = new_offsets[n_rows];
+    vector_t<index_t, space> new_indices(
+        n_slots, gunrock::numeric_limits<index_t>::invalid());
+    vector_t<value_t, space> new_values(n_slots);
+
+    auto indices = column_indices.data().get();
+    auto values = nonzero_values.data().get();
+    auto to_offsets = new_offsets.data().get();
+    auto to_indices = new_indices.data().get();
+    auto to_values = new_values.data().get();
+    thrust::for_each(policy, thrust::make_counting_iterator<index_t>(0),
+                     thrust::make_counting_iterator<index_t>(n_rows),
+                     [=] __device__(index_t const& v) {
+                       auto from = offsets[v];
+                       auto to = to_offsets[v];
+                       for (offset_t i = 0; i < sizes[v]; ++i) {
+                         to_indices[to + i] = indices[from + i];
+                         to_values[to + i] = values[from + i];
+                       }
+                     });
+
+    row_offsets.swap(new_offsets);
+    column_indices.swap(new_indices);
+    nonzero_values.swap(new_values);
+  }
+
+  /**
+   * @brief Convert to a (packed) CSR, e.g. to run the static algorithms.
+   */
+  csr_t<space, index_t, offset_t, value_t> to_csr(gcuda::stream_t stream = 0) {
+    auto policy = thrust::cuda::par.on(stream);
+    csr_t<space, index_t, offset_t, value_t> csr(
+        number_of_rows, number_of_columns, number_of_nonzeros);
+
+    thrust::exclusive_scan(policy, row_sizes.begin(), row_sizes.end(),
+                           csr.row_offsets.begin());
+    csr.row_offsets[number_of_rows] = number_of_nonzeros;
+
+    auto offsets = row_offsets.data().get();
+    auto sizes = row_sizes.data().get();
+    auto indices = column_indices.data().get();
+    auto values = nonzero_values.data().get();
+    auto to_offsets = csr.row_offsets.data().get();
+    auto to_indices = csr.column_indices.data().get();
+    auto to_values = csr.nonzero_values.data().get();
+    thrust::for_each(policy, thrust::make_counting_iterator<index_t>(0),
+                     thrust::make_counting_iterator<index_t>(number_of_rows),
+                     [=] __device__(index_t const& v) {
+                       auto from = offsets[v];
+                       auto to = to_offsets[v];
+                       for (offset_t i = 0; i < sizes[v]; ++i) {
+                         to_indices[to + i] = indices[from + i];
+                         to_values[to + i] = values[from + i];
+                       }
+                     });
+    return csr;
+  }
+
+  /**
+   * @brief Edges of the batch whose flag is set.
+   */
+  edge_batch_type compact(edge_batch_type const& batch,
+                          thrust::device_vector<int> const& flags,
+                          gcuda::stream_t stream = 0) {
+    auto policy = thrust::cuda::par.on(stream);
+    edge_batch_type applied(
+        thrust::count(policy, flags.begin(), flags.end(), 1));
+
+    auto input = thrust::make_zip_iterator(thrust::make_tuple(
+        batch.sources.begin(), batch.destinations.begin(),
+        batch.values.begin()));
+    auto output = thrust::make_zip_iterator(thrust::make_tuple(
+        applied.sources.begin(), applied.destinations.begin(),
+        applied.values.begin()));
+    thrust::copy_if(policy, input, input + batch.size(), flags.begin(), output,
+                    thrust::identity<int>());
+    return applied;
+  }
+};  // struct dynamic_csr_t
+
+}  // namespace format
+}  // namespace gunrock
@@ -0,0 +1,78 @@
+/**
+ * @file striped_csr.hxx
+ * @brief Compressed Sparse Row (CSR) format striped across multiple GPUs.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <gunrock/error.hxx>
+#include <gunrock/memory.hxx>
+#include <gunrock/virtual_memory.hxx>
+#include <gunrock/formats/formats.hxx>
+
+namespace gunrock {
+namespace format {
+
+/**
+ * @brief CSR whose arrays are striped across the memories of `devices` and
+ * mapped into a single virtual address range, such that a graph view built
+ * from it (`G.template set<csr_view_t>(striped)`) can be traversed from every
+ * device. Requires the CUDA driver API (virtual memory management).
+ *
+ * @tparam index_t
+ * @tparam offset_t
+ * @tparam value_t
+ */
+template <typename index_t, typename offset_t, typename value_t>
+struct striped_csr_t {
+  using index_type = index_t;
+  using offset_type = offset_t;
+  using value_type = value_t;
+
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;
+
+  memory::striped_array_t<offset_t> row_offsets;    // Ap
+  memory::striped_array_t<index_t> column_indices;  // Aj
+  memory::striped_array_t<value_t> nonzero_values;  // Ax
+
+  /**
+   * @brief Stripe a CSR (host or device) across `devices`.
+   *
+   * @param csr CSR to copy.
+   * @param devices devices to stripe the arrays across, @see
+   * memory::striped_array_t.
+   */
+  template <memory_space_t space>
+  striped_csr_t(csr_t<space, index_t, offset_t, value_t>& csr,
+                const std::vector<int>& devices)
+      : number_of_rows(csr.number_of_rows),
+        number_of_columns(csr.number_of_columns),
+        number_of_nonzeros(csr.number_of_nonzeros),
+        row_offsets(csr.number_of_rows + 1, devices),
+        column_indices(csr.number_of_nonzeros, devices),
+        nonzero_values(csr.number_of_nonzeros, devices) {
+    copy(row_offsets.data(), csr.row_offsets.data(), number_of_rows + 1);
+    copy(column_indices.data(), csr.column_indices.data(), number_of_nonzeros);
+    copy(nonzero_values.data(), csr.nonzero_values.data(), number_of_nonzeros);
+  }
+
+ private:
+  template <typename type_t, typename pointer_t>
+  static void copy(type_t* destination, pointer_t source, std::size_t size) {
+    error::throw_if_exception(
+        cudaMemcpy(destination, thrust::raw_pointer_cast(source),
+                   size * sizeof(type_t), cudaMemcpyDefault),
+        "Failed to copy the CSR into striped memory.");
+  }
+};  // struct striped_csr_t
+
+}  // namespace format
+}  // namespace gunrock
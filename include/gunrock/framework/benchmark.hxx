@@ -15,54 +15,258 @@
 
 #include <gunrock/cuda/cuda.hxx>
 #include <gunrock/util/math.hxx>
+#include <gunrock/framework/operators/configs.hxx>
+
+#include <cooperative_groups.h>
+#include <cooperative_groups/reduce.h>
+
+#if ESSENTIALS_COLLECT_METRICS
+#include <nvtx3/nvToolsExt.h>
+#endif
 
 namespace gunrock {
 namespace benchmark {
 
+/*!
+ * 64-bit counters, 32-bit ones overflow on large graphs (or long runs).
+ */
+using counter_t = unsigned long long;
+
+/**
+ * @brief Advance run by an operator call and the one requested, which differ
+ * for adaptive and direction-optimized advances (they pick one per call),
+ * @see LOG_ADVANCE().
+ */
+struct advance_record_t {
+  operators::advance_direction_t requested_direction;
+  operators::load_balance_t requested_load_balance;
+
+  // Forward or backward. A pull (one thread per vertex) is thread-mapped.
+  operators::advance_direction_t direction;
+  operators::load_balance_t load_balance;
+};
+
+/**
+ * @brief Record of one iteration of an enactor, @see BEGIN_ITERATION().
+ */
+struct iteration_record_t {
+  std::size_t iteration = 0;
+  std::size_t input_size = 0;   // Input frontier (elements).
+  std::size_t output_size = 0;  // Input frontier of the next iteration.
+  counter_t edges_visited = 0;
+  counter_t vertices_visited = 0;
+  float elapsed = 0;  // ms, measured with events on the enactor's stream.
+
+  // Each advance of the iteration.
+  std::vector<advance_record_t> advances;
+};
+
 class benchmark_t {
  public:
   benchmark_t()
       : edges_visited(1),
         vertices_visited(1),
         search_depth(0),
-        total_runtime() {}
+        total_runtime(),
+        start(nullptr),
+        stop(nullptr) {}
 
-  thrust::device_vector<unsigned int> edges_visited;
-  thrust::device_vector<unsigned int> vertices_visited;
+  thrust::device_vector<counter_t> edges_visited;
+  thrust::device_vector<counter_t> vertices_visited;
 
-  thrust::host_vector<unsigned int> h_edges_visited;
-  thrust::host_vector<unsigned int> h_vertices_visited;
+  thrust::host_vector<counter_t> h_edges_visited;
+  thrust::host_vector<counter_t> h_vertices_visited;
 
   std::size_t search_depth;
   double total_runtime;
+
+  // Each advance run.
+  std::vector<advance_record_t> advances;
+
+  // Per-iteration records, and the state of the iteration in flight.
+  std::vector<iteration_record_t> iterations;
+  iteration_record_t current;
+  counter_t edges_before;
+  counter_t vertices_before;
+  std::size_t advances_before;
+  cudaEvent_t start;
+  cudaEvent_t stop;
 };
 
 struct device_benchmark_t {
-  unsigned int* d_edges_visited;
-  unsigned int* d_vertices_visited;
+  counter_t* d_edges_visited;
+  counter_t* d_vertices_visited;
 };
 
 struct host_benchmark_t {
-  unsigned int edges_visited = 0;
-  unsigned int vertices_visited = 0;
+  counter_t edges_visited = 0;
+  counter_t vertices_visited = 0;
   std::size_t search_depth = 0;
   double total_runtime = 0;
+  std::vector<advance_record_t> advances;
+  std::vector<iteration_record_t> iterations;
 };
 
 benchmark_t ____;
 __managed__ device_benchmark_t BXXX;
 
+/**
+ * @brief Add to a counter once per warp: the active lanes sum their counts
+ * and the first of them issues the atomic, such that instrumented kernels
+ * are not serialized on the counter.
+ */
+__device__ __forceinline__ void LOG_AGGREGATED(counter_t* counter,
+                                               counter_t count) {
+  namespace cg = cooperative_groups;
+  auto active = cg::coalesced_threads();
+  auto total = cg::reduce(active, count, cg::plus<counter_t>());
+  if (active.thread_rank() == 0)
+    math::atomic::add(counter, total);
+}
+
 __device__ void LOG_EDGE_VISITED(size_t edges) {
-  math::atomic::add(BXXX.d_edges_visited, static_cast<unsigned int>(edges));
+  LOG_AGGREGATED(BXXX.d_edges_visited, static_cast<counter_t>(edges));
 }
 
 __device__ void LOG_VERTEX_VISITED(size_t vertices) {
-  math::atomic::add(BXXX.d_vertices_visited,
-                    static_cast<unsigned int>(vertices));
+  LOG_AGGREGATED(BXXX.d_vertices_visited, static_cast<counter_t>(vertices));
+}
+
+/**
+ * @brief Counters of a thread block, in shared memory, @see BEGIN_BLOCK_LOG().
+ */
+struct block_log_t {
+  counter_t* edges_visited;
+  counter_t* vertices_visited;
+};
+
+/**
+ * @brief Zero the counters of the block, such that its warps add to shared
+ * memory (@see LOG_EDGE_VISITED(block_log_t const&, size_t)) and the block
+ * issues a single global atomic per counter (@see END_BLOCK_LOG()). Every
+ * thread of the block must call it (it synchronizes the block).
+ */
+__device__ __forceinline__ block_log_t BEGIN_BLOCK_LOG() {
+  __shared__ counter_t counters[2];
+  if (gcuda::thread::local::id::x() == 0) {
+    counters[0] = 0;
+    counters[1] = 0;
+  }
+  __syncthreads();
+  return block_log_t{counters, counters + 1};
+}
+
+/**
+ * @brief Add the counters of the block to the global ones, every thread of the
+ * block must call it (it synchronizes the block).
+ */
+__device__ __forceinline__ void END_BLOCK_LOG(block_log_t const& log) {
+  __syncthreads();
+  if (gcuda::thread::local::id::x() == 0) {
+    if (*log.edges_visited)
+      math::atomic::add(BXXX.d_edges_visited, *log.edges_visited);
+    if (*log.vertices_visited)
+      math::atomic::add(BXXX.d_vertices_visited, *log.vertices_visited);
+  }
+}
+
+__device__ void LOG_EDGE_VISITED(block_log_t const& log, size_t edges) {
+  LOG_AGGREGATED(log.edges_visited, static_cast<counter_t>(edges));
+}
+
+__device__ void LOG_VERTEX_VISITED(block_log_t const& log, size_t vertices) {
+  LOG_AGGREGATED(log.vertices_visited, static_cast<counter_t>(vertices));
+}
+
+/**
+ * @brief Record an advance run with the given direction (forward or backward)
+ * and load-balancing technique.
+ */
+void LOG_ADVANCE(operators::advance_direction_t direction,
+                 operators::load_balance_t lb) {
+  ____.advances.push_back({direction, lb, direction, lb});
+}
+
+/**
+ * @brief Set the request of the last advance recorded, for an advance that
+ * picked the one it ran (e.g., `adaptive` or `optimized`).
+ */
+void LOG_REQUESTED_ADVANCE(operators::advance_direction_t direction,
+                           operators::load_balance_t lb) {
+  if (____.advances.empty())
+    return;
+  ____.advances.back().requested_direction = direction;
+  ____.advances.back().requested_load_balance = lb;
+}
+
+/**
+ * @brief NVTX range for the lifetime of the object (e.g. an operator call),
+ * only emitted when collecting metrics.
+ */
+struct range_t {
+  range_t(const char* name) {
+#if ESSENTIALS_COLLECT_METRICS
+    nvtxRangePushA(name);
+#endif
+  }
+  ~range_t() {
+#if ESSENTIALS_COLLECT_METRICS
+    nvtxRangePop();
+#endif
+  }
+};
+
+/**
+ * @brief Start the record of an iteration, @see END_ITERATION().
+ *
+ * @param iteration Iteration number.
+ * @param input_size Number of elements of the input frontier.
+ * @param stream Stream the iteration runs on.
+ */
+void BEGIN_ITERATION(std::size_t iteration,
+                     std::size_t input_size,
+                     gcuda::stream_t stream) {
+#if ESSENTIALS_COLLECT_METRICS
+  if (!____.start) {
+    cudaEventCreate(&____.start);
+    cudaEventCreate(&____.stop);
+  }
+  ____.current = iteration_record_t();
+  ____.current.iteration = iteration;
+  ____.current.input_size = input_size;
+  ____.edges_before = ____.edges_visited[0];
+  ____.vertices_before = ____.vertices_visited[0];
+  ____.advances_before = ____.advances.size();
+  cudaEventRecord(____.start, stream);
+#endif
+}
+
+/**
+ * @brief End the record of an iteration (synchronizes with the stream).
+ *
+ * @param output_size Number of elements of the next input frontier.
+ * @param stream Stream the iteration runs on.
+ */
+void END_ITERATION(std::size_t output_size, gcuda::stream_t stream) {
+#if ESSENTIALS_COLLECT_METRICS
+  cudaEventRecord(____.stop, stream);
+  cudaEventSynchronize(____.stop);
+  cudaEventElapsedTime(&____.current.elapsed, ____.start, ____.stop);
+
+  ____.current.output_size = output_size;
+  ____.current.edges_visited = ____.edges_visited[0] - ____.edges_before;
+  ____.current.vertices_visited =
+      ____.vertices_visited[0] - ____.vertices_before;
+  ____.current.advances.assign(____.advances.begin() + ____.advances_before,
+                               ____.advances.end());
+  ____.iterations.push_back(____.current);
+#endif
 }
 
 void INIT_BENCH() {
 #if ESSENTIALS_COLLECT_METRICS
+  ____.advances.clear();
+  ____.iterations.clear();
   thrust::fill(____.edges_visited.begin(), ____.edges_visited.end(), 0);
   thrust::fill(____.vertices_visited.begin(), ____.vertices_visited.end(), 0);
 
@@ -87,9 +291,11 @@ host_benchmark_t EXTRACT() {
   results.vertices_visited = ____.h_vertices_visited[0];
   results.search_depth = ____.search_depth;
   results.total_runtime = ____.total_runtime;
+  results.advances = ____.advances;
+  results.iterations = ____.iterations;
 #endif
   return results;
 }
 
 }  // namespace benchmark
-}  // namespace gunrock
\ No newline at end of file
+}  // namespace gunrock
@@ -9,12 +9,15 @@
  */
 
 #include <vector>
+#include <algorithm>
 
 #include <gunrock/cuda/cuda.hxx>
+#include <gunrock/memory.hxx>
 
 #include <gunrock/framework/frontier/frontier.hxx>
 #include <gunrock/framework/problem.hxx>
 #include <gunrock/framework/benchmark.hxx>
+#include <gunrock/framework/streaming.hxx>
 
 #pragma once
 
@@ -47,6 +50,47 @@ struct enactor_properties_t {
    */
   bool self_manage_frontiers{false};
 
+  /*!
+   * When greater than zero, a (vector) vertex frontier holding more than
+   * `dense_frontier_ratio * |V|` elements after an iteration is converted to a
+   * bitmap and back, which removes invalids and duplicates, and sorts it. The
+   * bitmap is then read by a pull-based advance of the next iteration instead
+   * of building its own map, @see enactor_t::get_input_bitmap(). Only valid for
+   * algorithms whose frontier stores vertex ids; 0 disables it.
+   */
+  float dense_frontier_ratio{0.0f};
+
+  /*!
+   * When enabled, `enact()` captures one iteration of `loop()` into a CUDA
+   * graph and replays it until the iteration leaves the device-side active flag
+   * unset, @see enactor_t::get_active_flag(). `loop()` must then be entirely
+   * stream-ordered on the context's stream (no host synchronization, host-side
+   * frontier sizes or frontier swaps), and must set the flag whenever another
+   * iteration is needed; `is_converged()` is not called.
+   */
+  bool capture_graph{false};
+
+  /*!
+   * `is_converged()` is only checked every `convergence_check_interval`
+   * iterations, such that checks that synchronize with the host do not stall
+   * every iteration. Only valid for algorithms for which running up to
+   * `convergence_check_interval - 1` iterations past convergence is harmless
+   * (for example, fixed-point iterations or advances of empty frontiers).
+   */
+  std::size_t convergence_check_interval{1};
+
+  /*!
+   * Graphs in managed memory are streamed to the device, in chunks of this
+   * many bytes of edges, following the frontier. @see streaming::prefetcher_t
+   */
+  std::size_t streaming_chunk_bytes{std::size_t(64) << 20};
+
+  /*!
+   * Bytes of a streamed graph's edges kept resident on the device, 0 for three
+   * quarters of the free device memory (once the frontiers are allocated).
+   */
+  std::size_t streaming_budget_bytes{0};
+
   /**
    * @brief Construct a new enactor properties t object with default values.
    */
@@ -83,8 +127,15 @@ template <typename algorithm_problem_t,
 struct enactor_t {
   using vertex_t = typename algorithm_problem_t::vertex_t;
   using edge_t = typename algorithm_problem_t::edge_t;
+  using graph_t = typename algorithm_problem_t::graph_type;
 
-  using frontier_t = frontier::frontier_t<vertex_t, edge_t, frontier_kind>;
+  using frontier_t =
+      frontier::frontier_t<vertex_t, edge_t, frontier_kind, frontier_view>;
+  using dense_frontier_t =
+      frontier::frontier_t<vertex_t,
+                           edge_t,
+                           frontier_kind,
+                           frontier::frontier_view_t::bitmap>;
 
   /*!
    * Enactor properties (frontier resizing factor, buffers, etc.)
@@ -114,7 +165,36 @@ struct enactor_t {
    * actually needs it is being run. Otherwise, it maybe a waste of memory space
    * to allocate this.
    */
-  thrust::device_vector<edge_t> scanned_work_domain;
+  pooled_vector_t<edge_t> scanned_work_domain;
+
+  /*!
+   * Bitmap used to convert dense vector frontiers, allocated on first use.
+   * @see enactor_properties_t::dense_frontier_ratio
+   */
+  dense_frontier_t dense_frontier;
+
+  /*!
+   * True while `dense_frontier` holds the input frontier, that is, from its
+   * conversion until the frontier buffers are swapped.
+   */
+  bool dense_frontier_is_input{false};
+
+  /*!
+   * Device-side convergence flag of a captured iteration, allocated on first
+   * use. @see enactor_properties_t::capture_graph
+   */
+  thrust::device_vector<int> active_flag;
+
+  /*!
+   * Captured iteration, @see enactor_properties_t::capture_graph
+   */
+  gcuda::captured_graph_t iteration_graph;
+
+  /*!
+   * Pages the edges of a managed graph onto the device before every iteration,
+   * enabled if the graph is in managed memory. @see streaming::prefetcher_t
+   */
+  streaming::prefetcher_t<graph_t> prefetcher;
 
   /*!
    * Active frontier buffer, this pointer can be obtained by
@@ -165,7 +245,10 @@ struct enactor_t {
         context(_context),
         problem(_problem),
         frontiers(properties.number_of_frontier_buffers),
-        scanned_work_domain(problem->get_graph().get_number_of_vertices() + 1),
+        scanned_work_domain(make_pooled_vector<edge_t>(
+            _context->get_context(0)->stream(),
+            problem->get_graph().get_number_of_vertices() + 1)),
+        dense_frontier(0, _context->get_context(0)->stream()),
         active_frontier(reinterpret_cast<frontier_t*>(&frontiers[0])),
         inactive_frontier(reinterpret_cast<frontier_t*>(&frontiers[1])),
         buffer_selector(0),
@@ -178,10 +261,21 @@ struct enactor_t {
      * actually may need.
      *
      */
+    // Frontier storage is allocated and freed on the context's stream.
+    auto stream = context->get_context(0)->stream();
+    for (auto& buffer : frontiers) {
+      if constexpr (frontier_view == frontier::frontier_view_t::vector)
+        buffer = frontier_t(0, 1.0f, stream);
+      else
+        buffer = frontier_t(0, stream);
+    }
+
+    auto g = problem->get_graph();
+    bool streamed = (g.memory_space() == memory::memory_space_t::managed);
     if (!(properties.self_manage_frontiers)) {
-      auto g = problem->get_graph();
+      // A streamed graph may not fit the device, neither would |E| frontiers.
       std::size_t initial_size =
-          (g.get_number_of_edges() > g.get_number_of_vertices())
+          (!streamed && (g.get_number_of_edges() > g.get_number_of_vertices()))
               ? g.get_number_of_edges()
               : g.get_number_of_vertices();
 
@@ -190,6 +284,13 @@ struct enactor_t {
         buffer.reserve((std::size_t)(initial_size));
       }
     }
+
+    if constexpr (streaming::prefetcher_t<graph_t>::is_supported) {
+      if (streamed)
+        prefetcher.init(g, context->get_context(0)->ordinal(),
+                        properties.streaming_chunk_bytes,
+                        properties.streaming_budget_bytes);
+    }
   }
 
   /**
@@ -222,11 +323,35 @@ struct enactor_t {
    */
   enactor_t* get_enactor() { return this; }
 
+  /**
+   * @brief Get the device-side flag a captured iteration sets (to any non-zero
+   * value) if another iteration is needed. The flag is cleared at the start of
+   * every iteration. @see enactor_properties_t::capture_graph
+   * @return int*
+   */
+  int* get_active_flag() {
+    if (active_flag.size() < 1)
+      active_flag.resize(1);
+    return active_flag.data().get();
+  }
+
+  /**
+   * @brief Get the bitmap of the input frontier, if the enactor converted it
+   * (@see enactor_properties_t::dense_frontier_ratio) and it was not swapped
+   * since, otherwise `nullptr`. The pull-based advance reads it as its map of
+   * the input frontier.
+   * @return unsigned int const*
+   */
+  unsigned int const* get_input_bitmap() {
+    return dense_frontier_is_input ? dense_frontier.data() : nullptr;
+  }
+
   /**
    * @brief Swap the inactive and active frontier buffers such that the inactive
    * buffer becomes the input buffer to the next operator and vice-versa.
    */
   void swap_frontier_buffers() {
+    dense_frontier_is_input = false;
     buffer_selector ^= 1;
     active_frontier =
         reinterpret_cast<frontier_t*>(&frontiers[buffer_selector]);
@@ -239,14 +364,35 @@ struct enactor_t {
    * @todo We can work on evolving this into a multi-gpu implementation.
    * @return float time took for enactor to complete (this is often used as
    * **the** time for performance measurements).
+   * @note The enactor can be enacted again (after resetting the problem), for
+   * example, once per source, without reallocating its frontiers.
    */
   float enact() {
+    iteration = 0;
+    dense_frontier_is_input = false;
+    if (properties.capture_graph)
+      return enact_captured();
+
     auto single_context = context->get_context(0);
     prepare_frontier(get_input_frontier(), *context);
     auto timer = single_context->timer();
     timer.begin();
-    while (!is_converged(*context)) {
+    std::size_t interval =
+        std::max<std::size_t>(properties.convergence_check_interval, 1);
+    while ((iteration % interval != 0) || !is_converged(*context)) {
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::range_t range("iteration");
+      benchmark::BEGIN_ITERATION(
+          iteration, get_input_frontier()->get_number_of_elements(),
+          single_context->stream());
+#endif
+      prefetch_graph(*context);
       loop(*context);
+      convert_dense_frontier(*context);
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::END_ITERATION(get_input_frontier()->get_number_of_elements(),
+                               single_context->stream());
+#endif
       ++iteration;
     }
     finalize(*context);
@@ -258,6 +404,107 @@ struct enactor_t {
     return runtime;
   }
 
+  /**
+   * @brief Run the enactor by capturing one iteration of `loop()` into a CUDA
+   * graph and replaying it, the per-iteration host overhead is a single graph
+   * launch and the readback of the active flag (captured with the iteration).
+   * @see enactor_properties_t::capture_graph
+   * @return float time took for enactor to complete.
+   */
+  float enact_captured() {
+    iteration = 0;
+    auto single_context = context->get_context(0);
+    auto stream = single_context->stream();
+    prepare_frontier(get_input_frontier(), *context);
+
+    int* d_active = get_active_flag();
+    int* h_active =
+        memory::allocate<int>(sizeof(int), memory::memory_space_t::host);
+
+    auto timer = single_context->timer();
+    timer.begin();
+
+    /// Record (without running) one iteration: clear the flag, loop and read
+    /// the flag back into pinned memory.
+    iteration_graph.begin(stream);
+    cudaMemsetAsync(d_active, 0, sizeof(int), stream);
+    loop(*context);
+    cudaMemcpyAsync(h_active, d_active, sizeof(int), cudaMemcpyDeviceToHost,
+                    stream);
+    iteration_graph.end();
+
+    do {
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::range_t range("iteration");
+      benchmark::BEGIN_ITERATION(iteration, 0, stream);
+#endif
+      iteration_graph.launch(stream);
+      single_context->synchronize();
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::END_ITERATION(0, stream);
+#endif
+      ++iteration;
+    } while (*h_active);
+
+    finalize(*context);
+    auto runtime = timer.end();
+    iteration_graph.clear();
+    memory::free(h_active, memory::memory_space_t::host);
+#if (ESSENTIALS_COLLECT_METRICS)
+    benchmark::____.search_depth = iteration;
+    benchmark::____.total_runtime = runtime;
+#endif
+    return runtime;
+  }
+
+  /**
+   * @brief Pages in the edges of the input frontier's vertices (of a graph in
+   * managed memory) before an iteration. Captured iterations are replayed
+   * without it, their edges fault in on demand.
+   * @see streaming::prefetcher_t
+   *
+   * @param context `gunrock::gcuda::multi_context_t`.
+   */
+  void prefetch_graph(gcuda::multi_context_t& context) {
+    using namespace frontier;
+    if constexpr ((frontier_view == frontier_view_t::vector) &&
+                  (frontier_kind == frontier_kind_t::vertex_frontier)) {
+      if (prefetcher.is_enabled())
+        prefetcher.prefetch(get_input_frontier(),
+                            context.get_context(0)->stream());
+    }
+  }
+
+  /**
+   * @brief Converts the active frontier, if it is dense enough, to a bitmap and
+   * back to a vector. The resultant frontier is sorted and has no invalids or
+   * duplicates, which bounds its size by |V| for the next iteration, and the
+   * bitmap is kept for a pull-based advance, @see get_input_bitmap().
+   * @see enactor_properties_t::dense_frontier_ratio
+   *
+   * @param context `gunrock::gcuda::multi_context_t`.
+   */
+  void convert_dense_frontier(gcuda::multi_context_t& context) {
+    using namespace frontier;
+    if constexpr ((frontier_view == frontier_view_t::vector) &&
+                  (frontier_kind == frontier_kind_t::vertex_frontier)) {
+      if ((properties.dense_frontier_ratio <= 0) ||
+          properties.self_manage_frontiers)
+        return;
+
+      std::size_t n_vertices = problem->get_graph().get_number_of_vertices();
+      if (active_frontier->get_number_of_elements() <=
+          (properties.dense_frontier_ratio * n_vertices))
+        return;
+
+      auto stream = context.get_context(0)->stream();
+      dense_frontier.reserve(n_vertices);
+      dense_frontier.from_vector(*active_frontier, stream);
+      dense_frontier.to_vector(*active_frontier, stream);
+      dense_frontier_is_input = true;
+    }
+  }
+
   /**
    * @brief This is the core of the implementation for any algorithm. Graph
    * algorithm developers should override this virtual function to implement
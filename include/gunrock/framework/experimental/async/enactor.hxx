@@ -1,9 +1,56 @@
 #pragma once
 #include <gunrock/container/experimental/async/queue.hxx>
+#include <gunrock/cuda/device_properties.hxx>
+
+#include <cmath>
 
 namespace gunrock {
 namespace experimental {
 namespace async {
+
+/**
+ * @brief How the queued work is executed.
+ */
+enum class mode_t {
+  asynchronous,     ///< Persistent blocks consume the queues, no barriers.
+  bulk_synchronous  ///< Rounds of work separated by a device-wide barrier.
+};
+
+/**
+ * @brief Execution policy parameters of the async engine.
+ *
+ * @par Overview
+ * The asynchronous mode avoids per-iteration global barriers, which is what
+ * latency-sensitive single-source queries want, but its queues are never
+ * recycled: the capacity bounds the number of pushes of a run. Workloads that
+ * push a vertex many times (SSSP, PPR, k-core) can therefore overflow, in which
+ * case the run is redone in the bulk-synchronous mode (if `fallback`), whose
+ * memory is bounded (a vertex is pushed at most once per round).
+ */
+struct config_t {
+  mode_t mode = mode_t::asynchronous;
+  bool fallback = true;  ///< Redo an overflowed asynchronous run in rounds.
+
+  int num_queues = 4;         ///< Queues (and streams) pushes are spread over.
+  int num_blocks = 0;         ///< Persistent blocks, 0 for the occupancy.
+  int num_threads = 256;      ///< Threads per block (at most 512).
+  uint32_t min_iter = 800;    ///< Idle polls before a warp votes to stop.
+  float sizing_factor = 1.5;  ///< Capacity of each queue, times |V|.
+};
+
+// Initial frontiers (pushed before the queues are launched).
+template <typename queue_t, typename val_t>
+__global__ void _push_one(queue_t q, val_t val) {
+  q.push(val);
+}
+
+template <typename queue_t, typename val_t>
+__global__ void _push_all(queue_t q, val_t n) {
+  val_t v = TID;
+  if (v < n)
+    q.push(v);
+}
+
 template <typename algorithm_problem_t>
 struct enactor_t {
   using vertex_t = typename algorithm_problem_t::vertex_t;
@@ -16,31 +63,42 @@ struct enactor_t {
 
   algorithm_problem_t* problem;
   std::shared_ptr<gcuda::multi_context_t> context;
+  config_t config;
 
   enactor_t(const enactor_t& rhs) = delete;
   enactor_t& operator=(const enactor_t& rhs) = delete;
 
-  // !! These parameters may be application specific, so really we want a way to
-  // pass them in as "execution policy parameters"
-  // For instance ... I don't think these parameters would work w/ async
-  // pagerank
-  int num_queue = 4;
-  int min_iter = 800;
-  int num_block = 56 * 5;
-  int num_thread = 256;
-  float sizing_factor = 1.5;
-
   enactor_t(algorithm_problem_t* _problem,
             std::shared_ptr<gcuda::multi_context_t> _context,
-            enactor_properties_t _properties = enactor_properties_t())
-      : problem(_problem), context(_context) {
+            config_t _config = config_t())
+      : problem(_problem), context(_context), config(_config) {
+    configure(config.mode);
+  }
+
+  ~enactor_t() { q.release(); }
+
+  /**
+   * @brief (Re)allocate the queues for `mode`. The launch configuration is
+   * derived from the device: the grid from the multiprocessor count and the
+   * occupancy of the queue kernels (@see Queues::launch_thread).
+   */
+  void configure(mode_t mode) {
     auto n_vertices = problem->get_graph().get_number_of_vertices();
+    auto props = context->get_context(0)->props();
+    int num_sms = gcuda::properties::multi_processor_count(props);
 
-    auto capacity = min(
+    double size = double(n_vertices) * config.sizing_factor;
+    // A round pushes up to |V| items into a queue, plus the pending round.
+    if (mode == mode_t::bulk_synchronous)
+      size = std::max(size, 2.0 * n_vertices);
+
+    auto capacity = std::min(
         single_queue_t(1 << 30),
-        max(single_queue_t(1024), single_queue_t(n_vertices * sizing_factor)));
+        std::max(single_queue_t(1024), single_queue_t(std::ceil(size))));
 
-    q.init(capacity, num_queue, num_block, num_thread, min_iter);
+    q.init(capacity, config.num_queues, config.num_blocks, config.num_threads,
+           config.min_iter, num_sms,
+           (mode == mode_t::bulk_synchronous) ? n_vertices : 0);
     q.reset();
   }
 
@@ -53,16 +111,34 @@ struct enactor_t {
 
   float enact() {
     auto single_context = context->get_context(0);
-    prepare_frontier(q, *context);
     auto timer = single_context->timer();
+
+    prepare_frontier(q, *context);
+    // The queues run on their own (non-blocking) streams.
+    cudaDeviceSynchronize();
+
     timer.begin();
     loop(*context);
-    q.sync();  // !! Best way to synchronize w/ the `context` stream?  Do we
-               // need to?
+    q.sync();
+
+    if (q.overflowed()) {
+      error::throw_if_exception(!config.fallback,
+                                "Async queue overflow, increase "
+                                "`sizing_factor` or enable `fallback`.");
+
+      // Pushes were dropped, start over in rounds.
+      q.release();
+      configure(mode_t::bulk_synchronous);
+      problem->reset();
+      prepare_frontier(q, *context);
+      cudaDeviceSynchronize();
+      loop(*context);
+      q.sync();
+    }
     return timer.end();
   }
 };
 
 }  // namespace async
 }  // namespace experimental
-}  // namespace gunrock
\ No newline at end of file
+}  // namespace gunrock
@@ -13,5 +13,6 @@
 #include <gunrock/framework/frontier/frontier.hxx>
 #include <gunrock/framework/problem.hxx>
 #include <gunrock/framework/enactor.hxx>
+#include <gunrock/framework/multi_gpu_enactor.hxx>
 
 #include <gunrock/framework/operators/operators.hxx>
\ No newline at end of file
@@ -0,0 +1,425 @@
+/**
+ * @file bitmap_frontier.hxx
+ * @brief Bitmap-based frontier implementation. Each bit of the underlying
+ * storage represents an element (vertex or edge id) of the frontier, which
+ * makes it a compact and duplicate-free representation of dense frontiers.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/framework/frontier/configs.hxx>
+
+#include <gunrock/error.hxx>
+#include <gunrock/util/math.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/container/vector.hxx>
+#include <gunrock/cuda/cuda.hxx>
+#include <gunrock/algorithms/sort/radix_sort.hxx>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/logical.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace gunrock {
+namespace frontier {
+using namespace memory;
+
+namespace detail {
+
+/**
+ * @brief Builds one 32-bit word of the bitmap per warp using `__ballot_sync`,
+ * such that no atomics (and no prior clearing) are required.
+ *
+ * @tparam word_t bitmap word type (32-bit).
+ * @tparam predicate_t predicate type, `bool(std::size_t const& i)`.
+ * @param words bitmap storage.
+ * @param number_of_bits number of valid bits in the bitmap.
+ * @param predicate sets bit `i` if `predicate(i)` is true.
+ */
+template <typename word_t, typename predicate_t>
+__global__ void ballot_kernel(word_t* words,
+                              std::size_t number_of_bits,
+                              predicate_t predicate) {
+  std::size_t i = gcuda::thread::global::id::x();
+  bool is_set = (i < number_of_bits) ? predicate(i) : false;
+
+  // Every thread of the grid participates, blocks are multiples of warps.
+  word_t word = __ballot_sync(0xffffffff, is_set);
+  if (((gcuda::thread::local::id::x() & 31) == 0) && (i < number_of_bits))
+    words[i >> 5] = word;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, frontier_kind_t _kind>
+class bitmap_frontier_t {
+ public:
+  using bitmap_frontier_type = bitmap_frontier_t<vertex_t, edge_t, _kind>;
+  using type_t = std::conditional_t<_kind == frontier_kind_t::vertex_frontier,
+                                    vertex_t,
+                                    edge_t>;
+  using word_t = unsigned int;
+
+  static constexpr std::size_t bits_per_word = sizeof(word_t) * 8;
+
+  /**
+   * @brief Default constructor, an empty frontier used on the default stream.
+   */
+  bitmap_frontier_t()
+      : number_of_bits(0), raw_ptr(nullptr), resizing_factor(1.0f) {
+    p_storage = std::make_shared<pooled_vector_t<word_t>>(
+        make_pooled_vector<word_t>(gcuda::stream_t(0)));
+  }
+
+  /**
+   * @brief Construct a new, empty bitmap frontier that can hold elements in
+   * range [0, size).
+   *
+   * @param size number of possible elements (for example, number of vertices).
+   * @param stream stream the frontier is used on, its storage is allocated and
+   * freed on it. @see memory::pool_allocator_t
+   */
+  bitmap_frontier_t(std::size_t size, gcuda::stream_t stream = 0)
+      : number_of_bits(size), resizing_factor(1.0f) {
+    p_storage = std::make_shared<pooled_vector_t<word_t>>(
+        make_pooled_vector<word_t>(
+            stream, math::divide_round_up(size, bits_per_word), 0));
+    raw_ptr = p_storage.get()->data().get();
+  }
+
+  /**
+   * @brief Destroy the bitmap frontier object.
+   */
+  ~bitmap_frontier_t() {}
+
+  /**
+   * @brief Specialized copy-constructor that allows the datastructure to work
+   * on device-side.
+   *
+   * @param rhs bitmap_frontier_t object
+   */
+  __device__ __host__ bitmap_frontier_t(const bitmap_frontier_t& rhs) {
+#ifdef __CUDA_ARCH__
+    raw_ptr = rhs.raw_ptr;
+#else
+    p_storage = rhs.p_storage;
+    raw_ptr = rhs.p_storage.get()->data().get();
+#endif
+    number_of_bits = rhs.number_of_bits;
+    resizing_factor = rhs.resizing_factor;
+  }
+
+  /**
+   * @brief Get the number of elements within the frontier, computed as the
+   * population count of the bitmap. This requires a reduction and should be
+   * avoided in the hot path when possible.
+   *
+   * @param stream GPU stream at which the reduction should occur.
+   * @return std::size_t
+   */
+  __host__ __device__ __forceinline__ std::size_t get_number_of_elements(
+      gcuda::stream_t stream = 0) const {
+    auto words = this->get();
+    auto n_words = this->get_number_of_words();
+#ifdef __CUDA_ARCH__
+    std::size_t count = 0;
+    for (std::size_t w = 0; w < n_words; ++w)
+      count += __popc(words[w]);
+    return count;
+#else
+    return thrust::transform_reduce(
+        thrust::cuda::par.on(stream),                    // sync policy
+        thrust::make_counting_iterator<std::size_t>(0),  // begin
+        thrust::make_counting_iterator<std::size_t>(n_words),  // end
+        [=] __device__(std::size_t const& w) -> std::size_t {
+          return __popc(words[w]);
+        },                            // population count
+        std::size_t(0),               // initial value
+        thrust::plus<std::size_t>());  // reduction
+#endif
+  }
+
+  /**
+   * @brief Get the capacity (number of elements possible).
+   * @return std::size_t
+   */
+  std::size_t get_capacity() const {
+    return p_storage.get()->capacity() * bits_per_word;
+  }
+
+  /**
+   * @brief Number of elements the bitmap spans, [0, size).
+   * @return std::size_t
+   */
+  __host__ __device__ __forceinline__ std::size_t get_number_of_bits() const {
+    return number_of_bits;
+  }
+
+  /**
+   * @brief Number of words of the underlying storage.
+   * @return std::size_t
+   */
+  __host__ __device__ __forceinline__ std::size_t get_number_of_words() const {
+    return math::divide_round_up(number_of_bits, bits_per_word);
+  }
+
+  /**
+   * @brief Get the resizing factor used to scale the frontier size.
+   *
+   * @return resizing factor for the frontier.
+   */
+  float get_resizing_factor() const { return resizing_factor; }
+
+  /**
+   * @brief Is the element in the frontier?
+   *
+   * @param element element (vertex or edge id) to test.
+   * @return true if the element's bit is set.
+   */
+  __device__ __forceinline__ bool contains(type_t const& element) const {
+    return (this->get()[element / bits_per_word] >>
+            (element % bits_per_word)) &
+           1;
+  }
+
+  /**
+   * @brief Get the element at the specified index. For a bitmap, the index is
+   * the element itself, so this returns `idx` if it is in the frontier and an
+   * invalid element otherwise.
+   *
+   * @param idx the index at which the element should be returned.
+   * @return type_t element to return.
+   */
+  __device__ __forceinline__ type_t
+  get_element_at(std::size_t const& idx) const noexcept {
+    return contains(idx) ? type_t(idx)
+                         : gunrock::numeric_limits<type_t>::invalid();
+  }
+
+  /**
+   * @brief Add an element to the frontier (atomically).
+   *
+   * @param element element to add to the frontier.
+   * @param idx ignored for a bitmap.
+   */
+  __device__ __forceinline__ void set_element_at(
+      type_t const& element,
+      std::size_t const& idx = 0) const noexcept {  /// XXX: This should not
+                                                    /// be const
+    if (gunrock::util::limits::is_valid(element))
+      atomicOr(this->get() + (element / bits_per_word),
+               word_t(1) << (element % bits_per_word));
+  }
+
+  /**
+   * @brief Set the resizing factor for the frontier.
+   *
+   * @param factor a float defining the resizing factor, 1.0f means no scaling.
+   */
+  void set_resizing_factor(float factor) { resizing_factor = factor; }
+
+  /**
+   * @brief The number of elements of a bitmap is always computed from the
+   * bitmap itself, this is a no-op kept for interface parity with the vector
+   * frontier.
+   *
+   * @param elements ignored.
+   */
+  void set_number_of_elements(std::size_t const& elements) {}
+
+  /**
+   * @brief Access to internal raw pointer (words), works on host and device.
+   */
+  __host__ __device__ __forceinline__ constexpr word_t* get() const {
+    return raw_ptr;
+  }
+
+  /**
+   * @brief Access to the underlying words, works only on host.
+   *
+   * @return word_t* data pointer.
+   */
+  auto data() { return raw_pointer_cast(p_storage.get()->data()); }
+
+  /**
+   * @brief Access to the first word of the frontier.
+   */
+  auto begin() { return this->data(); }
+
+  /**
+   * @brief Access to the end of the words of the frontier.
+   */
+  auto end() { return this->begin() + this->get_number_of_words(); }
+
+  /**
+   * @brief Checks if the frontier is empty, cheaper than counting the number
+   * of elements as it stops at the first non-zero word.
+   *
+   * @return true
+   * @return false
+   */
+  bool is_empty() const {
+    auto words = p_storage.get()->data();
+    return thrust::none_of(thrust::device, words,
+                           words + this->get_number_of_words(),
+                           [] __device__(word_t const& w) { return w != 0; });
+  }
+
+  /**
+   * @brief Fill the entire frontier, either clearing it (value = 0) or adding
+   * every element in [0, size) to it (value = 1).
+   *
+   * @param value 0 or 1.
+   * @param stream GPU stream at which this operation should occur.
+   */
+  void fill(type_t const value, gcuda::stream_t stream = 0) {
+    if (value != 0 && value != 1)
+      error::throw_if_exception(cudaErrorUnknown,
+                                "Bitmap only supports 1 or 0 as fill value.");
+
+    this->build(
+        [=] __host__ __device__(std::size_t const& i) -> bool {
+          return value == 1;
+        },
+        stream);
+  }
+
+  /**
+   * @brief Build the frontier from a predicate, every element `i` in [0, size)
+   * with `predicate(i) == true` is added, and every other element is removed.
+   * One word is computed per warp using a ballot (no atomics).
+   *
+   * @tparam predicate_t `bool(std::size_t const& i)` device callable.
+   * @param predicate predicate to build the frontier from.
+   * @param stream GPU stream at which this operation should occur.
+   */
+  template <typename predicate_t>
+  void build(predicate_t predicate, gcuda::stream_t stream = 0) {
+    constexpr unsigned int threads_per_block = 256;
+    std::size_t n_threads = this->get_number_of_words() * bits_per_word;
+    if (n_threads == 0)
+      return;
+
+    auto n_blocks =
+        math::divide_round_up(n_threads, (std::size_t)threads_per_block);
+    detail::ballot_kernel<<<n_blocks, threads_per_block, 0, stream>>>(
+        this->data(), number_of_bits, predicate);
+  }
+
+  /**
+   * @brief Converts a sparse (vector) frontier into this bitmap, invalid and
+   * duplicate elements are dropped.
+   *
+   * @tparam sparse_frontier_t vector frontier type.
+   * @param sparse input sparse frontier.
+   * @param stream GPU stream at which this operation should occur.
+   */
+  template <typename sparse_frontier_t>
+  void from_vector(sparse_frontier_t& sparse, gcuda::stream_t stream = 0) {
+    thrust::fill(thrust::cuda::par_nosync.on(stream), this->begin(),
+                 this->end(), word_t(0));
+
+    auto words = this->data();
+    auto sparse_data = sparse.data();
+    thrust::for_each_n(
+        thrust::cuda::par_nosync.on(stream),
+        thrust::make_counting_iterator<std::size_t>(0),
+        sparse.get_number_of_elements(),
+        [=] __device__(std::size_t const& i) {
+          type_t element = sparse_data[i];
+          if (gunrock::util::limits::is_valid(element))
+            atomicOr(words + (element / bits_per_word),
+                     word_t(1) << (element % bits_per_word));
+        });
+  }
+
+  /**
+   * @brief Converts this bitmap into a sparse (vector) frontier, the resultant
+   * frontier is sorted, and contains no invalids or duplicates.
+   *
+   * @tparam sparse_frontier_t vector frontier type.
+   * @param sparse output sparse frontier.
+   * @param stream GPU stream at which this operation should occur.
+   */
+  template <typename sparse_frontier_t>
+  void to_vector(sparse_frontier_t& sparse, gcuda::stream_t stream = 0) {
+    if (sparse.get_capacity() < number_of_bits)
+      sparse.reserve(number_of_bits);
+
+    auto words = this->data();
+    auto new_end = thrust::copy_if(
+        thrust::cuda::par.on(stream),                    // sync policy
+        thrust::make_counting_iterator<type_t>(0),       // begin
+        thrust::make_counting_iterator<type_t>(number_of_bits),  // end
+        sparse.begin(),                                  // output
+        [=] __device__(type_t const& i) -> bool {
+          return (words[i / bits_per_word] >> (i % bits_per_word)) & 1;
+        });
+
+    sparse.set_number_of_elements(thrust::distance(sparse.begin(), new_end));
+  }
+
+  /**
+   * @brief Resize the bitmap to span [0, size), new elements are not in the
+   * frontier.
+   *
+   * @param size number of possible elements.
+   * @param default_value ignored, the new bits are cleared.
+   */
+  void resize(std::size_t const& size, type_t const default_value = 0) {
+    p_storage.get()->resize(math::divide_round_up(size, bits_per_word), 0);
+    raw_ptr = p_storage.get()->data().get();
+    number_of_bits = size;
+  }
+
+  /**
+   * @brief A bitmap spans a fixed range of elements, reserving simply makes
+   * sure that the bitmap spans at least [0, size).
+   *
+   * @param size size to reserve (size is in count not bytes).
+   */
+  void reserve(std::size_t const& size) {
+    if (number_of_bits < size)
+      this->resize(size);
+  }
+
+  /**
+   * @brief Parallel sort the frontier.
+   *
+   * @param order see sort::order_t
+   * @param stream see gcuda::stream
+   */
+  void sort(sort::order_t order = sort::order_t::ascending,
+            gcuda::stream_t stream = 0) {
+    // Bitmap frontier is always sorted.
+  }
+
+  /**
+   * @brief Print the frontier to console, prints the elements in the frontier
+   * (the indices of the set bits).
+   */
+  void print() {
+    thrust::host_vector<word_t> h_words(this->begin(), this->end());
+    std::cout << "Frontier = ";
+    for (std::size_t i = 0; i < number_of_bits; ++i)
+      if ((h_words[i / bits_per_word] >> (i % bits_per_word)) & 1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+  }
+
+ private:
+  std::shared_ptr<pooled_vector_t<word_t>> p_storage;
+  word_t* raw_ptr;
+  std::size_t number_of_bits;  // elements spanned by the bitmap.
+  float resizing_factor;       // kept for interface parity.
+};
+
+}  // namespace frontier
+}  // namespace gunrock
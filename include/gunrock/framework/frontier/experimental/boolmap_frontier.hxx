@@ -10,8 +10,16 @@
 
 #pragma once
 
+#include <gunrock/framework/frontier/configs.hxx>
+
+#include <gunrock/error.hxx>
 #include <gunrock/util/type_limits.hxx>
 #include <gunrock/container/vector.hxx>
+#include <gunrock/algorithms/sort/radix_sort.hxx>
+
+#include <thrust/fill.h>
+#include <thrust/logical.h>
+#include <thrust/reduce.h>
 #include <thrust/sequence.h>
 
 namespace gunrock {
@@ -19,30 +27,43 @@ namespace experimental {
 namespace frontier {
 using namespace memory;
 
-template <typename type_t>
+using gunrock::frontier::frontier_kind_t;
+
+template <typename vertex_t, typename edge_t, frontier_kind_t _kind>
 class boolmap_frontier_t {
  public:
+  using type_t = std::conditional_t<_kind == frontier_kind_t::vertex_frontier,
+                                    vertex_t,
+                                    edge_t>;
   using pointer_t = type_t*;
 
   // Constructors
-  boolmap_frontier_t() : num_elements(0) {
+  boolmap_frontier_t() : num_elements(0), size(0) {
     p_storage = std::make_shared<vector_t<type_t, memory_space_t::device>>(
-        vector_t<type_t, memory_space_t::device>(1));
+        vector_t<type_t, memory_space_t::device>());
+    raw_ptr = nullptr;
   }
-  boolmap_frontier_t(std::size_t size) : num_elements(size) {
+  // The storage is not pooled, `stream` is not used.
+  boolmap_frontier_t(std::size_t size, gcuda::stream_t stream = 0)
+      : num_elements(0), size(size) {
     p_storage = std::make_shared<vector_t<type_t, memory_space_t::device>>(
-        vector_t<type_t, memory_space_t::device>(size));
-    raw_ptr = nullptr;
+        vector_t<type_t, memory_space_t::device>(size, 0));
+    raw_ptr = p_storage.get()->data().get();
   }
 
   // Empty Destructor, this is important on kernel-exit.
   ~boolmap_frontier_t() {}
 
   // Copy Constructor
-  boolmap_frontier_t(const boolmap_frontier_t& rhs) {
+  __device__ __host__ boolmap_frontier_t(const boolmap_frontier_t& rhs) {
+#ifdef __CUDA_ARCH__
+    raw_ptr = rhs.raw_ptr;
+#else
     p_storage = rhs.p_storage;
     raw_ptr = rhs.p_storage.get()->data().get();
+#endif
     num_elements = rhs.num_elements;
+    size = rhs.size;
   }
 
   /**
@@ -51,16 +72,15 @@ class boolmap_frontier_t {
    * @return std::size_t
    */
   __host__ __device__ __forceinline__ std::size_t get_number_of_elements(
-      gcuda::stream_t stream = 0) {
+      gcuda::stream_t stream = 0) const {
     // Compute number of elements using a reduction.
 #ifdef __CUDA_ARCH__
-    num_elements = thrust::reduce(thrust::seq, this->begin(), this->end(), 0);
+    return thrust::reduce(thrust::seq, this->get(), this->get() + size,
+                          std::size_t(0));
 #else
-    num_elements = thrust::reduce(thrust::cuda::par_nosync.on(stream),
-                                  this->begin(), this->end(), 0);
+    return thrust::reduce(thrust::cuda::par.on(stream), this->get(),
+                          this->get() + size, std::size_t(0));
 #endif
-
-    return num_elements;
   }
 
   /**
@@ -98,9 +118,18 @@ class boolmap_frontier_t {
       type_t const& element,
       std::size_t const& idx = 0  // Ignore idx for boolmap.
   ) const noexcept {              // XXX: This should not be const
-    thread::store(this->get() + element, 1);
+    if (gunrock::util::limits::is_valid(element))
+      thread::store(this->get() + element, type_t(1));
   }
 
+  /**
+   * @brief Set the resizing factor for the frontier, a boolmap spans a fixed
+   * range of elements and is never scaled.
+   *
+   * @param factor ignored.
+   */
+  void set_resizing_factor(float factor) {}
+
   /**
    * @brief Set how many number of elements the frontier contains. Note, this is
    * manually managed right now, we can look for better and cleaner options
@@ -122,18 +151,19 @@ class boolmap_frontier_t {
 
   pointer_t data() { return raw_pointer_cast(p_storage.get()->data()); }
   pointer_t begin() { return this->data(); }
-  pointer_t end() { return this->begin() + this->get_number_of_elements(); }
+  pointer_t end() { return this->begin() + size; }
 
   /**
-   * @brief Is the frontier empty or not?
-   * @todo right now, this relies on an expensive get_number_of_elements() call,
-   * we can replace this with a simple transform that checks each position and
-   * if any one of the position is active, the frontier is not empty.
+   * @brief Is the frontier empty or not? Stops at the first active position
+   * rather than counting all of them.
    *
    * @return true
    * @return false
    */
-  bool is_empty() { return (this->get_number_of_elements() == 0); }
+  bool is_empty() const {
+    return thrust::none_of(thrust::device, this->get(), this->get() + size,
+                           [] __device__(type_t const& x) { return x != 0; });
+  }
 
   /**
    * @brief Fill the entire frontier with a user-specified value.
@@ -142,7 +172,7 @@ class boolmap_frontier_t {
    * @param stream
    */
   void fill(type_t const value, gcuda::stream_t stream = 0) {
-    if (value != 0 || value != 1)
+    if (value != 0 && value != 1)
       error::throw_if_exception(cudaErrorUnknown,
                                 "Boolmap only supports 1 or 0 as fill value.");
 
@@ -159,8 +189,10 @@ class boolmap_frontier_t {
    * bytes).
    * @param default_value is 0 (meaning vertex is not active).
    */
-  void resize(std::size_t const& size, type_t const default_value = 0) {
-    p_storage.get()->resize(size, default_value);
+  void resize(std::size_t const& new_size, type_t const default_value = 0) {
+    p_storage.get()->resize(new_size, default_value);
+    raw_ptr = p_storage.get()->data().get();
+    size = new_size;
   }
 
   /**
@@ -172,7 +204,10 @@ class boolmap_frontier_t {
    *
    * @param size size to reserve (size is in count not bytes).
    */
-  void reserve(std::size_t const& size) { p_storage.get()->reserve(size); }
+  void reserve(std::size_t const& new_size) {
+    if (size < new_size)
+      this->resize(new_size);
+  }
 
   /**
    * @brief Parallel sort the frontier.
@@ -186,10 +221,11 @@ class boolmap_frontier_t {
   }
 
   void print() {
+    thrust::host_vector<type_t> h_map(this->begin(), this->end());
     std::cout << "Frontier = ";
-    thrust::copy(p_storage.get()->begin(),
-                 p_storage.get()->begin() + this->get_number_of_elements(),
-                 std::ostream_iterator<type_t>(std::cout, " "));
+    for (std::size_t i = 0; i < size; ++i)
+      if (h_map[i])
+        std::cout << i << " ";
     std::cout << std::endl;
   }
 
@@ -197,6 +233,7 @@ class boolmap_frontier_t {
   std::shared_ptr<vector_t<type_t, memory_space_t::device>> p_storage;
   pointer_t raw_ptr;
   std::size_t num_elements;  // number of elements in the frontier.
+  std::size_t size;          // number of elements spanned by the boolmap.
 };
 
 }  // namespace frontier
@@ -18,7 +18,8 @@
 
 #include <gunrock/framework/frontier/configs.hxx>
 #include <gunrock/framework/frontier/vector_frontier.hxx>
-// #include <gunrock/framework/frontier/experimental/boolmap_frontier.hxx>
+#include <gunrock/framework/frontier/bitmap_frontier.hxx>
+#include <gunrock/framework/frontier/experimental/boolmap_frontier.hxx>
 
 #include <gunrock/util/type_limits.hxx>
 
@@ -29,11 +30,28 @@ namespace gunrock {
 namespace frontier {
 using namespace memory;
 
+/**
+ * @brief Underlying data structure of the frontier for a given
+ * frontier_view_t.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          frontier_kind_t _kind,
+          frontier_view_t _view>
+using underlying_view_t = std::conditional_t<
+    _view == frontier_view_t::vector,
+    frontier::vector_frontier_t<vertex_t, edge_t, _kind>,
+    std::conditional_t<
+        _view == frontier_view_t::bitmap,
+        frontier::bitmap_frontier_t<vertex_t, edge_t, _kind>,
+        experimental::frontier::boolmap_frontier_t<vertex_t, edge_t, _kind>>>;
+
 template <typename vertex_t,
           typename edge_t,
           frontier_kind_t _kind = frontier_kind_t::vertex_frontier,
           frontier_view_t _view = frontier_view_t::vector>
-class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
+class frontier_t
+    : public frontier::underlying_view_t<vertex_t, edge_t, _kind, _view> {
  public:
   using vertex_type = vertex_t;
   using edge_type = edge_t;
@@ -45,15 +63,8 @@ class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
                                       vertex_t>;
   using frontier_type = frontier_t<vertex_t, edge_t, _kind, _view>;
 
-  /// TODO: This is a more permenant solution.
-  // We can use std::conditional to figure out what type to use.
-  // using underlying_view_t = std::conditional_t<
-  //     _view == frontier_view_t::vector,
-  //     frontier::vector_frontier_t<vertex_t, edge_t, _kind>,
-  //     experimental::frontier::boolmap_frontier_t<vertex_t, edge_t, _kind>>;
-
   using underlying_view_t =
-      frontier::vector_frontier_t<vertex_t, edge_t, _kind>;
+      frontier::underlying_view_t<vertex_t, edge_t, _kind, _view>;
 
   /**
    * @brief Default constructor.
@@ -68,16 +79,37 @@ class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
    * @tparam U
    * @param size
    * @param frontier_resizing_factor
+   * @param stream stream the frontier is used on.
    */
   template <typename U = underlying_view_t>
   frontier_t(
       std::size_t size,
       float frontier_resizing_factor = 1.0,
+      gcuda::stream_t stream = 0,
       typename std::enable_if<std::is_same<
           U,
           frontier::vector_frontier_t<vertex_t, edge_t, _kind>>::value>::type* =
           nullptr)
-      : underlying_view_t(size, frontier_resizing_factor) {}
+      : underlying_view_t(size, frontier_resizing_factor, stream) {}
+
+  /**
+   * @brief Construct a new frontier_t object that spans elements [0, size),
+   * this constructor is only available with frontier_view_t == bitmap or
+   * boolmap.
+   *
+   * @tparam U
+   * @param size number of possible elements (for example, number of vertices).
+   * @param stream stream the frontier is used on.
+   */
+  template <typename U = underlying_view_t>
+  frontier_t(
+      std::size_t size,
+      gcuda::stream_t stream = 0,
+      typename std::enable_if<!std::is_same<
+          U,
+          frontier::vector_frontier_t<vertex_t, edge_t, _kind>>::value>::type* =
+          nullptr)
+      : underlying_view_t(size, stream) {}
 
   /**
    * @brief Destroy the frontier t object. This is an empty destructor, which is
@@ -117,7 +149,7 @@ class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
    * @return std::size_t
    */
   __host__ __device__ __forceinline__ std::size_t get_number_of_elements(
-      gcuda::stream_t stream = 0) {
+      gcuda::stream_t stream = 0) const {
     return underlying_view_t::get_number_of_elements(stream);
   }
 
@@ -0,0 +1,200 @@
+/**
+ * @file near_far_frontier.hxx
+ * @brief Two-level (near/far pile) bucketed priority frontier of Davidson et
+ * al., "Work-Efficient Parallel GPU Methods for Single-Source Shortest Paths"
+ * (IPDPS'14). Elements with a priority below the current threshold are
+ * processed now (near pile), the rest are deferred (far pile) until the near
+ * pile drains and the threshold moves up by `delta`.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/framework/frontier/frontier.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/cuda/context.hxx>
+
+#include <thrust/copy.h>
+#include <thrust/remove.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/functional.h>
+
+namespace gunrock {
+namespace frontier {
+
+/**
+ * @brief Bucketed priority frontier with a near pile (the caller's frontier)
+ * and a far pile (owned by this structure).
+ *
+ * @par Overview
+ * The near pile is the frontier an algorithm iterates over, elements whose
+ * priority is at or above the threshold are moved from it into the far pile by
+ * `split()`. Once the near pile is empty, `refill()` raises the threshold to
+ * the first non-empty bucket and moves that bucket back to the near pile.
+ *
+ * @note Priorities may only decrease (for example, tentative distances), and
+ * an element whose priority decreases must be re-inserted into the near pile
+ * by the algorithm (for example, as the output of an advance). Far pile copies
+ * whose priority has since dropped below the threshold are therefore stale, and
+ * are dropped by `refill()`.
+ *
+ * @tparam vertex_t Vertex type.
+ * @tparam edge_t Edge type.
+ * @tparam priority_t Priority type (for example, the weight type for SSSP).
+ */
+template <typename vertex_t, typename edge_t, typename priority_t>
+class near_far_frontier_t {
+ public:
+  using frontier_type = frontier_t<vertex_t, edge_t>;
+  using type_t = typename frontier_type::type_t;
+
+  /**
+   * @brief Construct a new near/far frontier.
+   *
+   * @param _delta width of a bucket.
+   * @param stream stream the frontier is used on, the far pile is allocated
+   * and freed on it.
+   */
+  near_far_frontier_t(priority_t _delta = priority_t(1),
+                      gcuda::stream_t stream = 0)
+      : far(make_pooled_vector<type_t>(stream)),
+        delta(_delta),
+        threshold(_delta) {}
+
+  /**
+   * @brief Clear the far pile and set the threshold of the first bucket.
+   *
+   * @param _threshold priorities below this value are in the near pile.
+   */
+  void reset(priority_t _threshold) {
+    far.clear();
+    threshold = _threshold;
+  }
+
+  /**
+   * @brief Width of a bucket.
+   */
+  priority_t get_delta() const { return delta; }
+
+  /**
+   * @brief Current threshold, priorities below it are in the near pile.
+   */
+  priority_t get_threshold() const { return threshold; }
+
+  /**
+   * @brief Number of elements deferred to the far pile.
+   */
+  std::size_t get_number_of_far_elements() const { return far.size(); }
+
+  /**
+   * @brief True if no element is deferred.
+   */
+  bool is_empty() const { return far.empty(); }
+
+  /**
+   * @brief Split the near pile in-place, moving its valid elements with a
+   * priority at or above the threshold into the far pile. Invalid elements
+   * are removed as well.
+   *
+   * @tparam priority_op_t `priority_t(type_t const& element)` device callable.
+   * @param near near pile (for example, the output of an advance).
+   * @param priority priority of an element.
+   * @param context CUDA context.
+   */
+  template <typename priority_op_t>
+  void split(frontier_type& near,
+             priority_op_t priority,
+             gcuda::standard_context_t& context) {
+    auto policy = context.execution_policy();
+    auto current = threshold;
+
+    auto is_far = [=] __device__(type_t const& x) -> bool {
+      return gunrock::util::limits::is_valid(x) && !(priority(x) < current);
+    };
+
+    auto is_not_near = [=] __device__(type_t const& x) -> bool {
+      return !gunrock::util::limits::is_valid(x) || !(priority(x) < current);
+    };
+
+    std::size_t far_size = far.size();
+    far.resize(far_size + near.get_number_of_elements());
+    auto far_end = thrust::copy_if(policy, near.begin(), near.end(),
+                                   far.begin() + far_size, is_far);
+    far.resize(thrust::distance(far.begin(), far_end));
+
+    auto near_end =
+        thrust::remove_if(policy, near.begin(), near.end(), is_not_near);
+    near.set_number_of_elements(thrust::distance(near.begin(), near_end));
+  }
+
+  /**
+   * @brief Once the near pile is empty, drops stale far pile elements, moves
+   * the threshold to the first non-empty bucket (skipping empty ones) and
+   * moves that bucket into the near pile.
+   *
+   * @tparam priority_op_t `priority_t(type_t const& element)` device callable.
+   * @param near near pile to refill.
+   * @param priority priority of an element.
+   * @param context CUDA context.
+   * @return true if the near pile was refilled, false if the far pile is
+   * exhausted.
+   */
+  template <typename priority_op_t>
+  bool refill(frontier_type& near,
+              priority_op_t priority,
+              gcuda::standard_context_t& context) {
+    auto policy = context.execution_policy();
+
+    /// 1. Drop the elements settled in earlier buckets.
+    auto settled = threshold;
+    auto is_stale = [=] __device__(type_t const& x) -> bool {
+      return priority(x) < settled;
+    };
+    far.erase(thrust::remove_if(policy, far.begin(), far.end(), is_stale),
+              far.end());
+
+    if (far.empty()) {
+      near.set_number_of_elements(0);
+      return false;
+    }
+
+    /// 2. Move the threshold past the smallest remaining priority.
+    priority_t smallest = thrust::transform_reduce(
+        policy, far.begin(), far.end(),
+        [=] __device__(type_t const& x) -> priority_t { return priority(x); },
+        std::numeric_limits<priority_t>::max(),
+        thrust::minimum<priority_t>());
+
+    std::size_t buckets = static_cast<std::size_t>((smallest - threshold) /
+                                                   delta) + 1;
+    threshold += static_cast<priority_t>(buckets) * delta;
+
+    /// 3. Move the new bucket into the near pile.
+    auto current = threshold;
+    auto is_near = [=] __device__(type_t const& x) -> bool {
+      return priority(x) < current;
+    };
+
+    if (near.get_capacity() < far.size())
+      near.reserve(far.size());
+
+    auto near_end =
+        thrust::copy_if(policy, far.begin(), far.end(), near.begin(), is_near);
+    near.set_number_of_elements(thrust::distance(near.begin(), near_end));
+
+    far.erase(thrust::remove_if(policy, far.begin(), far.end(), is_near),
+              far.end());
+    return true;
+  }
+
+ private:
+  pooled_vector_t<type_t> far;  // deferred elements.
+  priority_t delta;              // width of a bucket.
+  priority_t threshold;          // upper bound of the near bucket.
+};
+
+}  // namespace frontier
+}  // namespace gunrock
@@ -33,14 +33,14 @@ class vector_frontier_t {
                                     edge_t>;
 
   /**
-   * @brief Default constructor.
+   * @brief Default constructor, an empty frontier used on the default stream.
    */
   vector_frontier_t()
       : num_elements(0), raw_ptr(nullptr), resizing_factor(1.0f) {
     /// TODO: we are using a vector of size 1 to avoid the overhead of setting
     /// it up later. Check if this is valid to do.
-    p_storage = std::make_shared<vector_t<type_t, memory_space_t::device>>(
-        vector_t<type_t, memory_space_t::device>());
+    p_storage = std::make_shared<pooled_vector_t<type_t>>(
+        make_pooled_vector<type_t>(gcuda::stream_t(0)));
   }
 
   /**
@@ -49,11 +49,15 @@ class vector_frontier_t {
    *
    * @param size
    * @param frontier_resizing_factor
+   * @param stream stream the frontier is used on, its storage is allocated and
+   * freed on it. @see memory::pool_allocator_t
    */
-  vector_frontier_t(std::size_t size, float frontier_resizing_factor = 1.0f)
+  vector_frontier_t(std::size_t size,
+                    float frontier_resizing_factor = 1.0f,
+                    gcuda::stream_t stream = 0)
       : num_elements(size), resizing_factor(frontier_resizing_factor) {
-    p_storage = std::make_shared<vector_t<type_t, memory_space_t::device>>(
-        vector_t<type_t, memory_space_t::device>(size));
+    p_storage = std::make_shared<pooled_vector_t<type_t>>(
+        make_pooled_vector<type_t>(stream, size));
     raw_ptr = p_storage.get()->data().get();
   }
 
@@ -291,7 +295,7 @@ class vector_frontier_t {
   }
 
  private:
-  std::shared_ptr<vector_t<type_t, memory_space_t::device>> p_storage;
+  std::shared_ptr<pooled_vector_t<type_t>> p_storage;
   type_t* raw_ptr;
   std::size_t num_elements;  // number of elements in the frontier.
   float resizing_factor;     // reserve size * factor.
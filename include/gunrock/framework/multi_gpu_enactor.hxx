@@ -0,0 +1,408 @@
+/**
+ * @file multi_gpu_enactor.hxx
+ * @brief Multi-GPU enactor, partitions the vertices across the devices of a
+ * `gcuda::multi_context_t`, runs every iteration on all devices in parallel and
+ * exchanges the output frontiers between iterations.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <exception>
+
+#include <gunrock/cuda/cuda.hxx>
+#include <gunrock/util/math.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+#include <gunrock/framework/frontier/frontier.hxx>
+#include <gunrock/framework/problem.hxx>
+#include <gunrock/framework/enactor.hxx>
+#include <gunrock/framework/benchmark.hxx>
+
+#include <thrust/copy.h>
+
+namespace gunrock {
+
+/**
+ * @brief Contiguous (block) partitioning of the vertices over the devices,
+ * device `d` owns the vertices `[begin(d), end(d))`. Matches the layout of
+ * per-vertex arrays striped across the devices (@see
+ * memory::striped_array_t).
+ *
+ * @tparam vertex_t Vertex type.
+ */
+template <typename vertex_t>
+struct vertex_partition_t {
+  vertex_t number_of_vertices;
+  vertex_t vertices_per_device;
+
+  vertex_partition_t(vertex_t n_vertices, std::size_t n_devices)
+      : number_of_vertices(n_vertices),
+        vertices_per_device(math::divide_round_up(
+            n_vertices > 0 ? n_vertices : vertex_t(1), (vertex_t)n_devices)) {}
+
+  __host__ __device__ __forceinline__ int owner(vertex_t const& v) const {
+    return v / vertices_per_device;
+  }
+
+  __host__ __device__ __forceinline__ vertex_t begin(int device) const {
+    vertex_t first = device * vertices_per_device;
+    return (first < number_of_vertices) ? first : number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ vertex_t end(int device) const {
+    return begin(device + 1);
+  }
+};
+
+/**
+ * @brief Multi-GPU counterpart of `gunrock::enactor_t`. The methods `loop()`
+ * and `prepare_frontier()` are overriden per device by the application writer.
+ *
+ * @par Overview
+ * Every device owns a slice (@see device_slice_t) with its own frontiers,
+ * work segments and a single-device view of the context, which is itself a
+ * valid enactor for the operators' enactor interface. An iteration runs
+ * `loop()` on every device in parallel (one host thread per device), and then
+ * exchanges the frontiers: each device gathers the valid vertices it owns from
+ * the output frontiers of all devices, and settles them (@see receive())
+ * against its partition of the per-vertex state (@see
+ * make_partitioned_vector()). The state of a vertex is therefore only updated
+ * by its owner, with local atomics. The graph must be accessible from all
+ * devices, for example, striped across the devices (@see
+ * format::striped_csr_t); peer access is enabled for all devices.
+ *
+ * @tparam algorithm_problem_t algorithm specific problem type.
+ */
+template <typename algorithm_problem_t>
+struct multi_gpu_enactor_t {
+  using vertex_t = typename algorithm_problem_t::vertex_t;
+  using edge_t = typename algorithm_problem_t::edge_t;
+  using frontier_t = frontier::frontier_t<vertex_t, edge_t>;
+  using type_t = typename frontier_t::type_t;
+
+  /**
+   * @brief Data of one device, provides the enactor interface of the
+   * operators (input/output frontiers, their swap and the work segments).
+   */
+  struct device_slice_t {
+    std::shared_ptr<gcuda::multi_context_t> context;
+    frontier_t frontiers[2];
+    int buffer_selector{0};
+    pooled_vector_t<edge_t> scanned_work_domain{
+        make_pooled_vector<edge_t>(gcuda::stream_t(0))};
+
+    frontier_t* get_input_frontier() { return &frontiers[buffer_selector]; }
+    frontier_t* get_output_frontier() {
+      return &frontiers[buffer_selector ^ 1];
+    }
+    void swap_frontier_buffers() { buffer_selector ^= 1; }
+
+    /**
+     * @brief Slices keep no dense (bitmap) frontier, a pull advance builds
+     * its own map of the input frontier.
+     */
+    unsigned int const* get_input_bitmap() const { return nullptr; }
+  };
+
+  /**
+   * @brief Per-vertex array partitioned over the devices, `parts[d]` is in the
+   * memory of device `d` and holds the values of the vertices it owns, at
+   * `v - partition.begin(d)`.
+   */
+  template <typename type_t>
+  using partitioned_vector_t = std::vector<pooled_vector_t<type_t>>;
+
+  /*!
+   * Enactor properties (frontier resizing factor).
+   */
+  enactor_properties_t properties;
+
+  /*!
+   * Multi-GPU context, one device per partition.
+   */
+  std::shared_ptr<gcuda::multi_context_t> context;
+
+  /*!
+   * Algorithm's problem structure.
+   */
+  algorithm_problem_t* problem;
+
+  /*!
+   * Vertex to device mapping.
+   */
+  vertex_partition_t<vertex_t> partition;
+
+  /*!
+   * Per-device slices.
+   */
+  std::vector<device_slice_t> slices;
+
+  /*!
+   * Number of iterations for the `loop` method. Increments per loop-iteration.
+   */
+  int iteration;
+
+  multi_gpu_enactor_t(const multi_gpu_enactor_t& rhs) = delete;
+  multi_gpu_enactor_t& operator=(const multi_gpu_enactor_t& rhs) = delete;
+
+  /**
+   * @brief Construct a new multi-GPU enactor.
+   *
+   * @param _problem algorithm's problem data structure.
+   * @param _context multi-GPU context, every device gets a partition.
+   * @param _properties `gunrock::enactor_properties_t`.
+   */
+  multi_gpu_enactor_t(algorithm_problem_t* _problem,
+                      std::shared_ptr<gcuda::multi_context_t> _context,
+                      enactor_properties_t _properties = enactor_properties_t())
+      : properties(_properties),
+        context(_context),
+        problem(_problem),
+        partition(_problem->get_graph().get_number_of_vertices(),
+                  _context->size()),
+        slices(_context->size()),
+        iteration(0) {
+    context->enable_peer_access();
+
+    auto G = problem->get_graph();
+    for (std::size_t device = 0; device < slices.size(); ++device) {
+      auto device_context = context->get_context(device);
+      gcuda::device::set(device_context->ordinal());
+
+      auto& slice = slices[device];
+      slice.context =
+          std::make_shared<gcuda::multi_context_t>(device_context);
+
+      // The slice's buffers are allocated and freed on its device's stream.
+      auto stream = device_context->stream();
+      slice.scanned_work_domain = make_pooled_vector<edge_t>(
+          stream, G.get_number_of_vertices() + 1);
+
+      for (auto& buffer : slice.frontiers) {
+        buffer = frontier_t(0, 1.0f, stream);
+        buffer.set_resizing_factor(properties.frontier_sizing_factor);
+        buffer.reserve((std::size_t)(partition.vertices_per_device));
+      }
+    }
+
+    gcuda::device::set(context->get_context(0)->ordinal());
+  }
+
+  algorithm_problem_t* get_problem() { return problem; }
+
+  /**
+   * @brief Get the slice (enactor interface of the operators) of a device.
+   */
+  device_slice_t* get_slice(int device) { return &slices[device]; }
+
+  frontier_t* get_input_frontier(int device) {
+    return slices[device].get_input_frontier();
+  }
+
+  frontier_t* get_output_frontier(int device) {
+    return slices[device].get_output_frontier();
+  }
+
+  /**
+   * @brief Allocate a per-vertex array partitioned over the devices, @see
+   * partitioned_vector_t. The parts are allocated and freed on the streams of
+   * their devices.
+   *
+   * @param value initial value of every vertex.
+   */
+  template <typename type_t>
+  partitioned_vector_t<type_t> make_partitioned_vector(type_t value) {
+    partitioned_vector_t<type_t> parts;
+    for (std::size_t device = 0; device < slices.size(); ++device) {
+      auto device_context = context->get_context(device);
+      gcuda::device::set(device_context->ordinal());
+      std::size_t size = partition.end(device) - partition.begin(device);
+      parts.emplace_back(
+          make_pooled_vector<type_t>(device_context->stream(), size, value));
+    }
+
+    gcuda::device::set(context->get_context(0)->ordinal());
+    return parts;
+  }
+
+  /**
+   * @brief Copy the part of `device` into its range of `output`, a per-vertex
+   * array (of all the vertices) on any device.
+   */
+  template <typename type_t>
+  void gather(partitioned_vector_t<type_t>& parts,
+              int device,
+              type_t* output) {
+    auto& part = parts[device];
+    error::throw_if_exception(
+        cudaMemcpyAsync(output + partition.begin(device),
+                        part.data().get(), part.size() * sizeof(type_t),
+                        cudaMemcpyDefault,
+                        context->get_context(device)->stream()),
+        "Failed to gather a partitioned vector.");
+  }
+
+  /**
+   * @brief Run `f(device)` on every device in parallel, one host thread per
+   * device (with the device set), and rethrow the first exception raised.
+   */
+  template <typename function_t>
+  void for_each_device(function_t f) {
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(slices.size());
+
+    for (std::size_t device = 0; device < slices.size(); ++device) {
+      threads.emplace_back([&, device]() {
+        try {
+          gcuda::device::set(context->get_context(device)->ordinal());
+          f((int)device);
+        } catch (...) {
+          errors[device] = std::current_exception();
+        }
+      });
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+
+    for (auto& error : errors)
+      if (error)
+        std::rethrow_exception(error);
+  }
+
+  /**
+   * @brief Gather the valid vertices owned by `device` from the active
+   * frontiers of all devices (peer reads) into the inactive frontier of
+   * `device`.
+   */
+  void exchange_frontiers(int device) {
+    auto& slice = slices[device];
+    auto output = slice.get_output_frontier();
+
+    std::size_t total = 0;
+    for (auto& peer : slices)
+      total += peer.get_input_frontier()->get_number_of_elements();
+
+    if (output->get_capacity() < total)
+      output->reserve(total);
+
+    auto part = partition;
+    auto is_owned = [=] __device__(type_t const& v) -> bool {
+      return gunrock::util::limits::is_valid(v) && (part.owner(v) == device);
+    };
+
+    auto policy = slice.context->get_context(0)->execution_policy();
+    std::size_t size = 0;
+    for (auto& peer : slices) {
+      auto input = peer.get_input_frontier();
+      auto last = thrust::copy_if(policy, input->begin(), input->end(),
+                                  output->begin() + size, is_owned);
+      size = thrust::distance(output->begin(), last);
+    }
+
+    output->set_number_of_elements(size);
+  }
+
+  /**
+   * @brief Run the enactor with the given problem and the loop on all devices.
+   * @return float time took for enactor to complete.
+   */
+  float enact() {
+    for_each_device([&](int device) {
+      prepare_frontier(device, get_input_frontier(device),
+                       *(slices[device].context));
+    });
+
+    auto single_context = context->get_context(0);
+    gcuda::device::set(single_context->ordinal());
+    auto timer = single_context->timer();
+    timer.begin();
+
+    while (!is_converged(*context)) {
+      for_each_device([&](int device) {
+        loop(device, *(slices[device].context));
+        slices[device].context->get_context(0)->synchronize();
+      });
+
+      for_each_device([&](int device) { exchange_frontiers(device); });
+      for (auto& slice : slices)
+        slice.swap_frontier_buffers();
+
+      for_each_device([&](int device) {
+        receive(device, *(slices[device].context));
+        slices[device].context->get_context(0)->synchronize();
+      });
+
+      ++iteration;
+    }
+
+    for_each_device([&](int device) {
+      finalize(device, *(slices[device].context));
+      slices[device].context->get_context(0)->synchronize();
+    });
+
+    gcuda::device::set(single_context->ordinal());
+    auto runtime = timer.end();
+#if (ESSENTIALS_COLLECT_METRICS)
+    benchmark::____.search_depth = iteration;
+    benchmark::____.total_runtime = runtime;
+#endif
+    return runtime;
+  }
+
+  /**
+   * @brief One iteration of the algorithm on `device`, runs concurrently with
+   * the other devices. The operators are called with `get_slice(device)` as
+   * the enactor and `context` (a single-device view) as the context; the
+   * resultant frontier must be the input frontier of the slice.
+   *
+   * @param device index of the device in the multi-GPU context.
+   * @param context single-device context of `device`.
+   */
+  virtual void loop(int device, gcuda::multi_context_t& context) = 0;
+
+  /**
+   * @brief Settle the vertices `device` received from the exchange (the input
+   * frontier of its slice, every vertex owned by `device`, possibly more than
+   * once), for example, filter them against the device's partition of the
+   * per-vertex state. Runs within the same iteration as `loop()`, before the
+   * convergence check. The default keeps every vertex.
+   *
+   * @param device index of the device in the multi-GPU context.
+   * @param context single-device context of `device`.
+   */
+  virtual void receive(int device, gcuda::multi_context_t& context) {}
+
+  /**
+   * @brief Prepare the initial frontier of `device`, it should only hold the
+   * vertices owned by `device` (@see vertex_partition_t::owner()).
+   */
+  virtual void prepare_frontier(int device,
+                                frontier_t* f,
+                                gcuda::multi_context_t& context) {}
+
+  /**
+   * @brief Converged once the frontiers of all devices are empty.
+   */
+  virtual bool is_converged(gcuda::multi_context_t& context) {
+    for (auto& slice : slices)
+      if (!slice.get_input_frontier()->is_empty())
+        return false;
+    return true;
+  }
+
+  /**
+   * @brief Runs once per device, after the algorithm has converged (for
+   * example, to gather the partitioned state into the result, @see gather()).
+   */
+  virtual void finalize(int device, gcuda::multi_context_t& context) {}
+
+};  // struct multi_gpu_enactor_t
+
+}  // namespace gunrock
@@ -0,0 +1,94 @@
+/**
+ * @file adaptive.hxx
+ * @brief Runtime selection of the load-balancing technique of an advance, based
+ * on the size and the degree distribution of the current input frontier.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/cuda/context.hxx>
+
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/advance/helpers.hxx>
+#include <gunrock/framework/benchmark.hxx>
+
+namespace gunrock {
+namespace operators {
+namespace advance {
+namespace adaptive {
+
+/**
+ * @brief Thresholds used to select a load-balancing technique.
+ *
+ * @par Overview
+ * With `avg` the average and `max` the largest degree of the input frontier:
+ *  1. `max > skew_ratio * avg` and `max >= warp_degree` (severe imbalance, for
+ * example, a hub of a power-law graph): merge-path.
+ *  2. `max < warp_degree` (every neighbor list fits a warp): thread-mapped.
+ *  3. `avg >= warp_degree` (long, uniform lists): warp-mapped.
+ *  4. otherwise: block-mapped.
+ */
+struct thresholds_t {
+  /*!
+   * Degrees shorter than a warp are cheaply serialized by a thread.
+   */
+  std::size_t warp_degree{32};
+
+  /*!
+   * Ratio of the largest to the average degree considered skewed.
+   */
+  float skew_ratio{64.0f};
+};
+
+/**
+ * @brief Selects the load-balancing technique for the next advance. Costs a
+ * single reduction over the input frontier (the output length is a by-product
+ * the selected advance would compute anyway).
+ *
+ * @tparam input_type Input type of the advance.
+ * @param G Graph.
+ * @param input Input frontier.
+ * @param context CUDA context.
+ * @param thresholds Selection thresholds.
+ * @return load_balance_t thread-, warp-, block-mapped, or merge-path.
+ */
+template <advance_io_type_t input_type, typename graph_t, typename frontier_t>
+load_balance_t select(graph_t& G,
+                      frontier_t& input,
+                      gcuda::standard_context_t& context,
+                      thresholds_t const& thresholds = thresholds_t()) {
+  std::size_t num_elements = (input_type == advance_io_type_t::graph)
+                                 ? G.get_number_of_vertices()
+                                 : input.get_number_of_elements();
+  if (num_elements == 0)
+    return load_balance_t::block_mapped;
+
+  auto statistics = compute_output_statistics(
+      G, input, context, (input_type == advance_io_type_t::graph));
+  std::size_t total_degree = statistics.first;
+  std::size_t max_degree = statistics.second;
+
+  float avg_degree = (float)total_degree / num_elements;
+
+  load_balance_t lb;
+  if ((max_degree >= thresholds.warp_degree) &&
+      (max_degree > thresholds.skew_ratio * avg_degree))
+    lb = load_balance_t::merge_path;
+  else if (max_degree < thresholds.warp_degree)
+    lb = load_balance_t::thread_mapped;
+  else if (avg_degree >= thresholds.warp_degree)
+    lb = load_balance_t::warp_mapped;
+  else
+    lb = load_balance_t::block_mapped;
+
+  return lb;
+}
+
+}  // namespace adaptive
+}  // namespace advance
+}  // namespace operators
+}  // namespace gunrock
@@ -15,13 +15,18 @@
 #include <gunrock/util/type_limits.hxx>
 
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/benchmark.hxx>
 
 #include <gunrock/framework/operators/advance/helpers.hxx>
 #include <gunrock/framework/operators/advance/merge_path.hxx>
 #include <gunrock/framework/operators/advance/thread_mapped.hxx>
 #include <gunrock/framework/operators/advance/block_mapped.hxx>
+#include <gunrock/framework/operators/advance/warp_mapped.hxx>
+#include <gunrock/framework/operators/advance/work_stealing.hxx>
 #include <gunrock/framework/operators/advance/bucketing.hxx>
 #include <gunrock/framework/operators/advance/merge_path_v2.hxx>
+#include <gunrock/framework/operators/advance/pull.hxx>
+#include <gunrock/framework/operators/advance/adaptive.hxx>
 
 namespace gunrock {
 namespace operators {
@@ -86,6 +91,10 @@ namespace advance {
  * @param segments storaged space for scanned items (segment offsets).
  * @param context a `cuda::multi_context_t` that contains GPU contexts for the
  * available CUDA devices. Used to launch the advance kernels.
+ * @param params thresholds and options of the pull-based and
+ * direction-optimized advance (ignored for `advance_direction_t::forward`).
+ * @param candidate predicate on the vertices, only those for which it returns
+ * true scan their in-neighbors when pulling (ignored when pushing).
  */
 template <load_balance_t lb,
           advance_direction_t direction,
@@ -94,17 +103,78 @@ template <load_balance_t lb,
           typename graph_t,
           typename operator_t,
           typename frontier_t,
-          typename work_tiles_t>
+          typename work_tiles_t,
+          typename candidate_t = pull::all_vertices_t>
 void execute(graph_t& G,
              operator_t op,
              frontier_t* input,
              frontier_t* output,
              work_tiles_t& segments,
-             gcuda::multi_context_t& context) {
+             gcuda::multi_context_t& context,
+             direction_optimized_params_t const& params =
+                 direction_optimized_params_t(),
+             candidate_t candidate = candidate_t()) {
+  benchmark::range_t range("advance");
   if (context.size() == 1) {
     auto context0 = context.get_context(0);
 
-    if (lb == load_balance_t::merge_path) {
+#if (ESSENTIALS_COLLECT_METRICS)
+    // Adaptive and direction-optimized advances log the advance they run, and
+    // then their request.
+    if (direction == advance_direction_t::forward &&
+        lb != load_balance_t::adaptive)
+      benchmark::LOG_ADVANCE(direction, lb);
+#endif
+
+    /*!
+     * Direction-optimized advance picks push (`lb`-balanced, forward) or pull
+     * (backward, over CSC) for this call, and then runs it.
+     */
+    if (direction == advance_direction_t::optimized) {
+      if (pull::is_preferred<input_type>(G, *input, *context0, params)) {
+        pull::execute<advance_direction_t::backward, input_type, output_type>(
+            G, op, *input, *output, segments, *context0, params, candidate);
+#if (ESSENTIALS_COLLECT_METRICS)
+        benchmark::LOG_ADVANCE(advance_direction_t::backward,
+                               load_balance_t::thread_mapped);
+#endif
+      } else {
+        execute<lb, advance_direction_t::forward, input_type, output_type>(
+            G, op, input, output, segments, context, params);
+      }
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::LOG_REQUESTED_ADVANCE(direction, lb);
+#endif
+    } else if (direction == advance_direction_t::backward) {
+      pull::execute<direction, input_type, output_type>(
+          G, op, *input, *output, segments, *context0, params, candidate);
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::LOG_ADVANCE(direction, load_balance_t::thread_mapped);
+      benchmark::LOG_REQUESTED_ADVANCE(direction, lb);
+#endif
+    } else if (lb == load_balance_t::adaptive) {
+      /*!
+       * Adaptive advance picks the load-balancing technique for this call from
+       * the input frontier's degree statistics, and then runs it.
+       */
+      constexpr auto forward = advance_direction_t::forward;
+      auto selected = adaptive::select<input_type>(G, *input, *context0);
+      if (selected == load_balance_t::merge_path)
+        execute<load_balance_t::merge_path, forward, input_type, output_type>(
+            G, op, input, output, segments, context, params);
+      else if (selected == load_balance_t::thread_mapped)
+        execute<load_balance_t::thread_mapped, forward, input_type,
+                output_type>(G, op, input, output, segments, context, params);
+      else if (selected == load_balance_t::warp_mapped)
+        execute<load_balance_t::warp_mapped, forward, input_type, output_type>(
+            G, op, input, output, segments, context, params);
+      else
+        execute<load_balance_t::block_mapped, forward, input_type,
+                output_type>(G, op, input, output, segments, context, params);
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::LOG_REQUESTED_ADVANCE(direction, lb);
+#endif
+    } else if (lb == load_balance_t::merge_path) {
       merge_path::execute<direction, input_type, output_type>(
           G, op, input, output, segments, *context0);
     } else if (lb == load_balance_t::merge_path_v2) {
@@ -116,6 +186,16 @@ void execute(graph_t& G,
     } else if (lb == load_balance_t::block_mapped) {
       block_mapped::execute<direction, input_type, output_type>(
           G, op, *input, *output, *context0);
+    } else if (lb == load_balance_t::warp_mapped) {
+      warp_mapped::execute<direction, input_type, output_type>(
+          G, op, *input, *output, segments, *context0);
+    } else if (lb == load_balance_t::work_stealing) {
+      work_stealing::execute<direction, input_type, output_type>(
+          G, op, *input, *output, segments, *context0);
+    } else if (lb == load_balance_t::bucketing) {
+      error::throw_if_exception(cudaErrorUnknown,
+                                "Bucketing advance requires a priority and a "
+                                "near/far frontier, see bucketing::execute.");
     } else {
       error::throw_if_exception(cudaErrorUnknown,
                                 "Advance type not supported.");
@@ -187,6 +267,10 @@ void execute(graph_t& G,
  * @param swap_buffers (default = `true`), swap input and output buffers of the
  * enactor, such that the input buffer gets reused as the output buffer in the
  * next iteration. Use `false` to disable the swap behavior.
+ * @param params thresholds and options of the pull-based and
+ * direction-optimized advance (ignored for `advance_direction_t::forward`).
+ * @param candidate predicate on the vertices, only those for which it returns
+ * true scan their in-neighbors when pulling (ignored when pushing).
  */
 template <load_balance_t lb = load_balance_t::merge_path,
           advance_direction_t direction = advance_direction_t::forward,
@@ -194,19 +278,35 @@ template <load_balance_t lb = load_balance_t::merge_path,
           advance_io_type_t output_type = advance_io_type_t::vertices,
           typename graph_t,
           typename enactor_type,
-          typename operator_type>
+          typename operator_type,
+          typename candidate_t = pull::all_vertices_t>
 void execute(graph_t& G,
              enactor_type* E,
              operator_type op,
              gcuda::multi_context_t& context,
-             bool swap_buffers = true) {
+             bool swap_buffers = true,
+             direction_optimized_params_t const& params =
+                 direction_optimized_params_t(),
+             candidate_t candidate = candidate_t()) {
+  /*!
+   * A pull reads the enactor's bitmap of the input frontier, if it holds one
+   * (@see enactor_properties_t::dense_frontier_ratio).
+   */
+  auto pull_params = params;
+  if constexpr (direction != advance_direction_t::forward) {
+    if (!pull_params.input_bitmap)
+      pull_params.input_bitmap = E->get_input_bitmap();
+  }
+
   execute<lb, direction, input_type, output_type>(
       G,                         // graph
       op,                        // advance operator
       E->get_input_frontier(),   // input frontier
       E->get_output_frontier(),  // output frontier
       E->scanned_work_domain,    // work segments
-      context                    // gpu context
+      context,                   // gpu context
+      pull_params,               // push-pull parameters
+      candidate                  // pulled vertices
   );
 
   /*!
@@ -48,6 +48,10 @@ __global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
   // TODO: accept gunrock::frontier_t instead of typename frontier_t::type_t.
   using type_t = frontier_t;
 
+#if (ESSENTIALS_COLLECT_METRICS)
+  auto block_log = benchmark::BEGIN_BLOCK_LOG();
+#endif
+
   // Specialize Block Scan for 1D block of THREADS_PER_BLOCK.
   using block_scan_t = cub::BlockScan<edge_t, THREADS_PER_BLOCK>;
 
@@ -138,8 +142,8 @@ __global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
     auto w = G.get_edge_weight(e);
 
 #if (ESSENTIALS_COLLECT_METRICS)
-    benchmark::LOG_EDGE_VISITED(1);
-    benchmark::LOG_VERTEX_VISITED(2);
+    benchmark::LOG_EDGE_VISITED(block_log, 1);
+    benchmark::LOG_VERTEX_VISITED(block_log, 2);
 #endif
 
     // Use-defined advance condition.
@@ -151,6 +155,10 @@ __global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
           cond ? n : gunrock::numeric_limits<vertex_t>::invalid();
     }
   }
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  benchmark::END_BLOCK_LOG(block_log);
+#endif
 }
 
 template <advance_direction_t direction,
@@ -204,7 +212,8 @@ void execute(graph_t& G,
 
   /// @todo Is there a better place to create block_offsets? This is always a
   /// one element array.
-  thrust::device_vector<typename frontier_t::offset_t> block_offsets(1);
+  auto block_offsets = make_pooled_vector<typename frontier_t::offset_t>(
+      context.stream(), 1);
   launch_box.calculate_grid_dimensions_strided(num_elements);
   launch_box.launch(context, kernel, G, op, input.data(), output.data(),
                     num_elements, block_offsets.data().get());
@@ -1,7 +1,10 @@
 /**
  * @file bucketing.hxx
  * @author Muhammad Osama (mosama@ucdavis.edu)
- * @brief
+ * @brief Bucketing advance (Davidson et al., near-far pile), advances the
+ * input frontier and splits the resultant neighbors into the near pile (output
+ * frontier) and the far pile of a `frontier::near_far_frontier_t`, based on a
+ * user-defined priority.
  * @date 2021-12-16
  *
  * @copyright Copyright (c) 2021
@@ -14,27 +17,90 @@
 #include <gunrock/cuda/cuda.hxx>
 
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/advance/helpers.hxx>
+#include <gunrock/framework/operators/advance/block_mapped.hxx>
+#include <gunrock/framework/frontier/near_far_frontier.hxx>
+#include <gunrock/framework/benchmark.hxx>
 
 namespace gunrock {
 namespace operators {
 namespace advance {
 namespace bucketing {
 
+/**
+ * @brief Bucketing advance, visits the neighbors of the input frontier (using
+ * the block-mapped advance) with the user-defined operator `op`, and then
+ * splits the neighbors for which `op` returned true: those with `priority(n) <
+ * buckets.get_threshold()` form the output frontier (near pile), and the rest
+ * are deferred to `buckets` (far pile). Invalids are removed from the output.
+ *
+ * @tparam direction Only `advance_direction_t::forward` is supported.
+ * @tparam input_type Input type of the advance.
+ * @tparam output_type Must not be `advance_io_type_t::none`.
+ * @param G Graph.
+ * @param op Advance operator.
+ * @param priority `priority_t(vertex_t const& v)` priority of a neighbor.
+ * @param input Input frontier.
+ * @param output Output frontier (near pile).
+ * @param buckets Near/far frontier, holding the far pile and the threshold.
+ * @param context CUDA context.
+ */
 template <advance_direction_t direction,
           advance_io_type_t input_type,
           advance_io_type_t output_type,
           typename graph_t,
           typename operator_t,
+          typename priority_op_t,
           typename frontier_t,
-          typename work_tiles_t>
+          typename buckets_t>
 void execute(graph_t& G,
              operator_t op,
+             priority_op_t priority,
              frontier_t* input,
              frontier_t* output,
-             work_tiles_t& segments,
-             gcuda::standard_context_t& context) {}
-}  // namespace bucketing
+             buckets_t& buckets,
+             gcuda::standard_context_t& context) {
+  static_assert(output_type != advance_io_type_t::none,
+                "Bucketing advance requires an output frontier.");
+#if (ESSENTIALS_COLLECT_METRICS)
+  benchmark::LOG_ADVANCE(direction, load_balance_t::bucketing);
+#endif
+
+  block_mapped::execute<direction, input_type, output_type>(
+      G, op, *input, *output, context);
+  buckets.split(*output, priority, context);
+}
+
+/**
+ * @brief Bucketing advance using the enactor's frontiers, @see the overload
+ * above. The input and output frontier buffers are swapped after the advance
+ * (unless `swap_buffers == false`), such that the near pile becomes the input
+ * of the next operator.
+ */
+template <advance_direction_t direction = advance_direction_t::forward,
+          advance_io_type_t input_type = advance_io_type_t::vertices,
+          advance_io_type_t output_type = advance_io_type_t::vertices,
+          typename graph_t,
+          typename enactor_type,
+          typename operator_t,
+          typename priority_op_t,
+          typename buckets_t>
+void execute(graph_t& G,
+             enactor_type* E,
+             operator_t op,
+             priority_op_t priority,
+             buckets_t& buckets,
+             gcuda::multi_context_t& context,
+             bool swap_buffers = true) {
+  execute<direction, input_type, output_type>(
+      G, op, priority, E->get_input_frontier(), E->get_output_frontier(),
+      buckets, *(context.get_context(0)));
+
+  if (swap_buffers)
+    E->swap_frontier_buffers();
+}
 
+}  // namespace bucketing
 }  // namespace advance
 }  // namespace operators
-}  // namespace gunrock
\ No newline at end of file
+}  // namespace gunrock
@@ -14,6 +14,7 @@
 #include <gunrock/cuda/context.hxx>
 #include <thrust/transform_scan.h>
 #include <thrust/transform_reduce.h>
+#include <thrust/pair.h>
 
 namespace gunrock {
 namespace operators {
@@ -144,6 +145,60 @@ std::size_t compute_output_length(graph_t& G,
   return new_length;
 }
 
+/**
+ * @brief Computes both the number of total elements in the output frontier and
+ * the largest degree of the input frontier in a single pass, used to choose a
+ * load-balancing technique for the advance.
+ *
+ * @tparam graph_t Graph type
+ * @tparam frontier_t Frontier type
+ * @param G Graph object
+ * @param input Input frontier
+ * @param context CUDA context
+ * @param graph_as_frontier if true, entire graph is used instead of the
+ * frontier.
+ * @return thrust::pair<std::size_t, std::size_t> (number of total elements in
+ * the output frontier, largest number of neighbors of an input element).
+ */
+template <typename graph_t, typename frontier_t>
+thrust::pair<std::size_t, std::size_t> compute_output_statistics(
+    graph_t& G,
+    frontier_t& input,
+    gcuda::standard_context_t& context,
+    bool graph_as_frontier = false) {
+  using vertex_t = typename graph_t::vertex_type;
+  using stats_t = thrust::pair<std::size_t, std::size_t>;
+
+  auto input_data = input.data();
+  auto total_elems = graph_as_frontier ? G.get_number_of_vertices()
+                                       : input.get_number_of_elements();
+
+  auto segment_sizes = [=] __host__ __device__(std::size_t const& i) {
+    auto v = graph_as_frontier ? vertex_t(i) : input_data[i];
+    // if item is invalid, segment size is 0.
+    std::size_t degree = gunrock::util::limits::is_valid(v)
+                             ? (std::size_t)G.get_number_of_neighbors(v)
+                             : 0;
+    return stats_t(degree, degree);
+  };
+
+  auto sum_and_max = [] __host__ __device__(stats_t const& a,
+                                            stats_t const& b) {
+    return stats_t(a.first + b.first,
+                   (a.second > b.second) ? a.second : b.second);
+  };
+
+  return thrust::transform_reduce(
+      context.execution_policy(),                      // execution policy
+      thrust::make_counting_iterator<std::size_t>(0),  // input iterator: first
+      thrust::make_counting_iterator<std::size_t>(
+          total_elems),  // input iterator: last
+      segment_sizes,     // unary operation
+      stats_t(0, 0),     // initial value
+      sum_and_max        // binary operation
+  );
+}
+
 }  // namespace advance
 }  // namespace operators
 }  // namespace gunrock
\ No newline at end of file
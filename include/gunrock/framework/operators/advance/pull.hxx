@@ -0,0 +1,361 @@
+/**
+ * @file pull.hxx
+ * @brief Pull-based (backward) advance over the CSC view of the graph, and the
+ * push-pull switching heuristic used by the direction-optimized advance.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/cuda/cuda.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/graph/graph.hxx>
+
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/advance/helpers.hxx>
+#include <gunrock/framework/benchmark.hxx>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+
+#include <cub/block/block_scan.cuh>
+
+namespace gunrock {
+namespace operators {
+namespace advance {
+
+/**
+ * @brief Thresholds and options for the pull-based and the direction-optimized
+ * (push-pull) advance.
+ *
+ * @par Overview
+ * The direction-optimized advance follows Beamer et al. (SC'12): an iteration
+ * pulls when the edges to be checked from the input frontier exceed `|E| /
+ * alpha`, and the input frontier has at least `|V| / beta` vertices; it pushes
+ * otherwise. Without per-traversal state, |E| stands in for the edges of the
+ * unvisited vertices, which makes the switch to pull conservative.
+ */
+struct direction_optimized_params_t {
+  /*!
+   * Pull if the input frontier's edges > |E| / alpha.
+   */
+  float alpha{15.0f};
+
+  /*!
+   * Push if the input frontier's size < |V| / beta.
+   */
+  float beta{18.0f};
+
+  /*!
+   * Stop scanning a vertex's in-neighbors as soon as the user-defined operator
+   * returns true. Operators that must observe every parent in the input
+   * frontier (for example, shortest-path counting in BC) must disable this.
+   */
+  bool early_exit{true};
+
+  /*!
+   * Bitmap of the input frontier (one bit per vertex), if the caller already
+   * holds one. The pull-based advance then reads it instead of building its
+   * own map of the input frontier. @see enactor_t::get_input_bitmap()
+   */
+  unsigned int const* input_bitmap{nullptr};
+};
+
+namespace pull {
+
+/**
+ * @brief True if the graph type carries a CSC view, required by the pull-based
+ * advance to visit the in-neighbors of a vertex.
+ */
+template <typename graph_t>
+constexpr bool has_csc_view_v =
+    graph::has_representation_v<graph_t, typename graph_t::graph_csc_view_t>;
+
+/**
+ * @brief Default candidate predicate of the pull-based advance: every vertex
+ * not in the input frontier scans its in-neighbors.
+ */
+struct all_vertices_t {
+  template <typename vertex_t>
+  __host__ __device__ __forceinline__ constexpr bool operator()(
+      vertex_t const& v) const {
+    return true;
+  }
+};
+
+/**
+ * @brief Input frontier membership read from a map of markers (one per
+ * vertex).
+ */
+template <typename marker_t>
+struct marker_map_t {
+  marker_t const* markers;
+  __device__ __forceinline__ bool operator()(std::size_t const& v) const {
+    return markers[v] != marker_t(0);
+  }
+};
+
+/**
+ * @brief Input frontier membership read from a bitmap (one bit per vertex).
+ */
+struct bitmap_map_t {
+  unsigned int const* words;
+  __device__ __forceinline__ bool operator()(std::size_t const& v) const {
+    return (words[v / 32] >> (v % 32)) & 1u;
+  }
+};
+
+template <unsigned int THREADS_PER_BLOCK,
+          advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename type_t,
+          typename membership_t,
+          typename offset_counter_t,
+          typename operator_t,
+          typename candidate_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    pull_kernel(graph_t const G,
+                operator_t op,
+                candidate_t candidate,
+                membership_t in_frontier,
+                type_t* output,
+                offset_counter_t* output_length,
+                bool early_exit) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using csc_view_t = typename graph_t::graph_csc_view_t;
+
+  // Specialize Block Scan for 1D block of THREADS_PER_BLOCK.
+  using block_scan_t = cub::BlockScan<int, THREADS_PER_BLOCK>;
+  __shared__ typename block_scan_t::TempStorage scan;
+  __shared__ offset_counter_t offset[1];
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  auto block_log = benchmark::BEGIN_BLOCK_LOG();
+#endif
+
+  vertex_t v = gcuda::thread::global::id::x();
+  int found = 0;
+
+  /// 1. Each thread owns one vertex and looks for a parent in the input
+  /// frontier among its in-neighbors. Vertices already in the input frontier
+  /// are visited, and are therefore not pulled again, neither are the vertices
+  /// rejected by the candidate predicate (for example, visited in an earlier
+  /// iteration), whose in-edges are then never read.
+  if ((v < G.get_number_of_vertices()) &&
+      ((input_type == advance_io_type_t::graph) || !in_frontier(v)) &&
+      candidate(v)) {
+    edge_t starting_edge = G.template get_starting_edge<csc_view_t>(v);
+    edge_t total_edges = G.template get_number_of_neighbors<csc_view_t>(v);
+
+    for (edge_t i = 0; i < total_edges; ++i) {
+      auto e = starting_edge + i;
+      auto u = G.template get_source_vertex<csc_view_t>(e);
+
+      if ((input_type != advance_io_type_t::graph) && !in_frontier(u))
+        continue;
+
+      auto w = G.template get_edge_weight<csc_view_t>(e);
+
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::LOG_EDGE_VISITED(block_log, 1);
+      benchmark::LOG_VERTEX_VISITED(block_log, 2);
+#endif
+
+      // User-defined advance condition, called with the frontier vertex as
+      // the source, such that the same operator works for push and pull.
+      if (op(u, v, e, w)) {
+        found = 1;
+        if (early_exit)
+          break;
+      }
+    }
+  }
+
+  /// 2. Compact the discovered vertices into the output frontier, one global
+  /// atomic per block.
+  if constexpr (output_type != advance_io_type_t::none) {
+    int rank, aggregate;
+    block_scan_t(scan).ExclusiveSum(found, rank, aggregate);
+
+    if (gcuda::thread::local::id::x() == 0)
+      offset[0] =
+          math::atomic::add(&output_length[0], (offset_counter_t)aggregate);
+    __syncthreads();
+
+    if (found)
+      output[offset[0] + rank] = v;
+  }
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  benchmark::END_BLOCK_LOG(block_log);
+#endif
+}
+
+template <advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t,
+          typename work_tiles_t,
+          typename candidate_t>
+void execute_csc(graph_t& G,
+                 operator_t op,
+                 frontier_t& input,
+                 frontier_t& output,
+                 work_tiles_t& segments,
+                 gcuda::standard_context_t& context,
+                 direction_optimized_params_t const& params,
+                 candidate_t candidate) {
+  using type_t = typename frontier_t::type_t;
+  using offset_t = typename frontier_t::offset_t;
+  using marker_t = typename work_tiles_t::value_type;
+
+  std::size_t n_vertices = G.get_number_of_vertices();
+
+  // At most every vertex is discovered.
+  if constexpr (output_type != advance_io_type_t::none) {
+    if (output.get_capacity() < n_vertices)
+      output.reserve(n_vertices);
+  }
+
+  // Set-up and launch pull advance.
+  using namespace gcuda::launch_box;
+  using launch_t =
+      launch_box_t<launch_params_dynamic_grid_t<fallback, dim3_t<256>>>;
+
+  launch_t launch_box;
+  launch_box.calculate_grid_dimensions_strided(n_vertices);
+  auto output_length = make_pooled_vector<offset_t>(context.stream(), 1, 0);
+
+  auto launch = [&](auto in_frontier) {
+    auto kernel = pull_kernel<          // kernel
+        launch_box.block_dimensions.x,  // threads per block
+        input_type, output_type,        // i/o parameters
+        graph_t,                        // graph type
+        type_t,                         // frontier value type
+        decltype(in_frontier),          // frontier membership type
+        offset_t,                       // output length type
+        operator_t,                     // lambda type
+        candidate_t                     // candidate predicate type
+        >;
+    launch_box.launch(context, kernel, G, op, candidate, in_frontier,
+                      output.data(), output_length.data().get(),
+                      params.early_exit);
+  };
+
+  if ((input_type != advance_io_type_t::graph) && params.input_bitmap) {
+    launch(bitmap_map_t{params.input_bitmap});
+  } else {
+    /// Reuse the scanned work domain (unused by a pull traversal) as a map of
+    /// the vertices in the input frontier.
+    if (segments.size() < n_vertices)
+      segments.resize(n_vertices);
+    auto markers = segments.data().get();
+
+    if (input_type != advance_io_type_t::graph) {
+      thrust::fill_n(context.execution_policy(), segments.begin(), n_vertices,
+                     marker_t(0));
+
+      auto input_data = input.data();
+      auto mark = [=] __device__(std::size_t const& i) {
+        auto u = input_data[i];
+        if (gunrock::util::limits::is_valid(u))
+          markers[u] = marker_t(1);
+      };
+
+      thrust::for_each_n(context.execution_policy(),
+                         thrust::make_counting_iterator<std::size_t>(0),
+                         input.get_number_of_elements(), mark);
+    }
+    launch(marker_map_t<marker_t>{markers});
+  }
+  context.synchronize();
+
+  if constexpr (output_type != advance_io_type_t::none) {
+    thrust::host_vector<offset_t> size_of_output = output_length;
+    output.set_number_of_elements(size_of_output[0]);
+  }
+}
+
+/**
+ * @brief Pull-based (backward) advance. Every vertex not in the input frontier
+ * scans its in-neighbors (using the CSC view) and calls the user-defined
+ * operator `op(source, neighbor, edge, weight)` for each in-neighbor `source`
+ * in the input frontier. A vertex is written once to the output frontier if any
+ * of those calls returned true. Vertices for which `candidate(vertex)` returns
+ * false (for example, the visited vertices of a traversal) are skipped before
+ * their in-edges are scanned.
+ *
+ * @note `edge` and `weight` are those of the CSC view. The output frontier is
+ * compacted (no invalids, no duplicates) but unordered.
+ */
+template <advance_direction_t direction,
+          advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t,
+          typename work_tiles_t,
+          typename candidate_t = all_vertices_t>
+void execute(graph_t& G,
+             operator_t op,
+             frontier_t& input,
+             frontier_t& output,
+             work_tiles_t& segments,
+             gcuda::standard_context_t& context,
+             direction_optimized_params_t const& params =
+                 direction_optimized_params_t(),
+             candidate_t candidate = candidate_t()) {
+  if constexpr (has_csc_view_v<graph_t>) {
+    execute_csc<input_type, output_type>(G, op, input, output, segments,
+                                         context, params, candidate);
+  } else {
+    error::throw_if_exception(cudaErrorUnknown,
+                              "CSC sparse-matrix representation required for "
+                              "pull-based (backward) advance.");
+  }
+}
+
+/**
+ * @brief Decides whether the next direction-optimized advance should pull
+ * (true) or push (false), @see direction_optimized_params_t.
+ *
+ * @param G Graph.
+ * @param input Input frontier.
+ * @param context CUDA context.
+ * @param params Switching thresholds.
+ * @return true if pull is expected to touch fewer edges.
+ */
+template <advance_io_type_t input_type, typename graph_t, typename frontier_t>
+bool is_preferred(graph_t& G,
+                  frontier_t& input,
+                  gcuda::standard_context_t& context,
+                  direction_optimized_params_t const& params) {
+  if constexpr (!has_csc_view_v<graph_t>)
+    return false;
+
+  // The entire graph as a frontier always touches all the edges.
+  if (input_type == advance_io_type_t::graph)
+    return false;
+
+  std::size_t n_vertices = G.get_number_of_vertices();
+  std::size_t n_edges = G.get_number_of_edges();
+  std::size_t frontier_size = input.get_number_of_elements();
+
+  if (frontier_size < (n_vertices / params.beta))
+    return false;
+
+  std::size_t frontier_edges = compute_output_length(G, input, context);
+  return frontier_edges > (n_edges / params.alpha);
+}
+
+}  // namespace pull
+}  // namespace advance
+}  // namespace operators
+}  // namespace gunrock
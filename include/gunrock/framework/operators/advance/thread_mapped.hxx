@@ -37,7 +37,9 @@ void execute(graph_t& G,
   using type_t = typename frontier_t::type_t;
 
   if (output_type != advance_io_type_t::none) {
-    auto size_of_output = compute_output_offsets(G, &input, segments, context);
+    auto size_of_output = compute_output_offsets(
+        G, &input, segments, context,
+        (input_type == advance_io_type_t::graph) ? true : false);
 
     // If output frontier is empty, resize and return.
     if (size_of_output <= 0) {
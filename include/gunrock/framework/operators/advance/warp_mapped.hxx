@@ -0,0 +1,176 @@
+/**
+ * @file warp_mapped.hxx
+ * @brief Advance operator where the neighbors of each element of the input
+ * frontier are processed cooperatively by a warp.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/cuda/cuda.hxx>
+
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/advance/helpers.hxx>
+#include <gunrock/framework/benchmark.hxx>
+
+namespace gunrock {
+namespace operators {
+namespace advance {
+namespace warp_mapped {
+
+/**
+ * @brief Each warp loads 32 elements of the input frontier (one per lane), and
+ * then walks through them one at a time, with all the lanes of the warp
+ * striding over the neighbor list of the current element. Warps never diverge
+ * on the degree of a vertex, and no search is required to map an edge to its
+ * source, at the cost of idle lanes for vertices with less than 32 neighbors.
+ */
+template <unsigned int THREADS_PER_BLOCK,
+          advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename type_t,
+          typename offset_t,
+          typename operator_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    warp_mapped_kernel(graph_t const G,
+                       operator_t op,
+                       type_t* input,
+                       type_t* output,
+                       offset_t* segments,
+                       std::size_t input_size) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+
+  constexpr unsigned int warp_size = 32;
+  constexpr unsigned int full_mask = 0xffffffff;
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  auto block_log = benchmark::BEGIN_BLOCK_LOG();
+#endif
+
+  std::size_t lane = gcuda::thread::local::id::x() & (warp_size - 1);
+  std::size_t warp_id = gcuda::thread::global::id::x() / warp_size;
+  std::size_t total_warps =
+      (gcuda::block::size::x() * gcuda::grid::size::x()) / warp_size;
+
+  // The loop bound is uniform across the warp, all lanes stay converged.
+  for (std::size_t base = warp_id * warp_size; base < input_size;
+       base += total_warps * warp_size) {
+    /// 1. One element of the input frontier per lane.
+    std::size_t idx = base + lane;
+    vertex_t v = gunrock::numeric_limits<vertex_t>::invalid();
+    edge_t starting_edge = 0;
+    edge_t total_edges = 0;
+    offset_t offset = 0;
+
+    if (idx < input_size) {
+      v = (input_type == advance_io_type_t::graph) ? vertex_t(idx)
+                                                   : input[idx];
+      if (gunrock::util::limits::is_valid(v)) {
+        starting_edge = G.get_starting_edge(v);
+        total_edges = G.get_number_of_neighbors(v);
+      }
+      if constexpr (output_type != advance_io_type_t::none)
+        offset = segments[idx];
+    }
+
+    /// 2. The whole warp processes the neighbors of each of the lanes'
+    /// elements in turn.
+    for (unsigned int j = 0; j < warp_size; ++j) {
+      vertex_t u = __shfl_sync(full_mask, v, j);
+      edge_t u_edges = __shfl_sync(full_mask, total_edges, j);
+      edge_t u_starting_edge = __shfl_sync(full_mask, starting_edge, j);
+      offset_t u_offset = __shfl_sync(full_mask, offset, j);
+
+      for (edge_t i = lane; i < u_edges; i += warp_size) {
+        auto e = u_starting_edge + i;          // edge id
+        auto n = G.get_destination_vertex(e);  // neighbor id
+        auto w = G.get_edge_weight(e);         // weight
+
+#if (ESSENTIALS_COLLECT_METRICS)
+        benchmark::LOG_EDGE_VISITED(block_log, 1);
+        benchmark::LOG_VERTEX_VISITED(block_log, 2);
+#endif
+
+        // User-defined advance condition.
+        bool cond = op(u, n, e, w);
+
+        // Store [neighbor] into the output frontier.
+        if constexpr (output_type != advance_io_type_t::none) {
+          output[u_offset + i] =
+              cond ? n : gunrock::numeric_limits<type_t>::invalid();
+        }
+      }
+    }
+  }
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  benchmark::END_BLOCK_LOG(block_log);
+#endif
+}
+
+template <advance_direction_t direction,
+          advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t,
+          typename work_tiles_t>
+void execute(graph_t& G,
+             operator_t op,
+             frontier_t& input,
+             frontier_t& output,
+             work_tiles_t& segments,
+             gcuda::standard_context_t& context) {
+  if constexpr (output_type != advance_io_type_t::none) {
+    auto size_of_output = compute_output_offsets(
+        G, &input, segments, context,
+        (input_type == advance_io_type_t::graph) ? true : false);
+
+    // If output frontier is empty, resize and return.
+    if (size_of_output <= 0) {
+      output.set_number_of_elements(0);
+      return;
+    }
+
+    /// Resize the output (inactive) buffer to the new size.
+    /// @todo Can be hidden within the frontier struct.
+    if (output.get_capacity() < size_of_output)
+      output.reserve(size_of_output);
+    output.set_number_of_elements(size_of_output);
+  }
+
+  std::size_t num_elements = (input_type == advance_io_type_t::graph)
+                                 ? G.get_number_of_vertices()
+                                 : input.get_number_of_elements();
+
+  // Set-up and launch warp-mapped advance, one warp per 32 input elements.
+  using namespace gcuda::launch_box;
+  using launch_t =
+      launch_box_t<launch_params_dynamic_grid_t<fallback, dim3_t<256>>>;
+
+  launch_t launch_box;
+  auto kernel = warp_mapped_kernel<   // kernel
+      launch_box.block_dimensions.x,  // threads per block
+      input_type, output_type,        // i/o parameters
+      graph_t,                        // graph type
+      typename frontier_t::type_t,    // frontier value type
+      typename work_tiles_t::value_type,  // segments value type
+      operator_t                          // lambda type
+      >;
+
+  launch_box.calculate_grid_dimensions_strided(num_elements);
+  launch_box.launch(context, kernel, G, op, input.data(), output.data(),
+                    segments.data().get(), num_elements);
+  context.synchronize();
+}
+
+}  // namespace warp_mapped
+}  // namespace advance
+}  // namespace operators
+}  // namespace gunrock
@@ -0,0 +1,211 @@
+/**
+ * @file work_stealing.hxx
+ * @brief Advance operator with persistent warps that dynamically dequeue
+ * fixed-size tiles of edges from a shared work queue, such that idle warps take
+ * over the remaining work of the frontier.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/cuda/cuda.hxx>
+#include <gunrock/error.hxx>
+
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/advance/helpers.hxx>
+#include <gunrock/framework/benchmark.hxx>
+
+#include <thrust/binary_search.h>
+
+namespace gunrock {
+namespace operators {
+namespace advance {
+namespace work_stealing {
+
+/**
+ * @brief Persistent warps repeatedly claim the next `TILE_SIZE` edges of the
+ * scanned work domain with a single atomic, until the work is exhausted. Lane 0
+ * locates the range of input elements spanning the tile once per tile, which
+ * bounds the per-edge search to that (usually small) range.
+ */
+template <unsigned int THREADS_PER_BLOCK,
+          unsigned int TILE_SIZE,
+          advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename type_t,
+          typename offset_t,
+          typename operator_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    work_stealing_kernel(graph_t const G,
+                         operator_t op,
+                         type_t* input,
+                         type_t* output,
+                         offset_t* segments,
+                         std::size_t input_size,
+                         offset_t total_work,
+                         offset_t* queue_counter) {
+  using vertex_t = typename graph_t::vertex_type;
+
+  constexpr unsigned int warp_size = 32;
+  constexpr unsigned int full_mask = 0xffffffff;
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  auto block_log = benchmark::BEGIN_BLOCK_LOG();
+#endif
+
+  unsigned int lane = gcuda::thread::local::id::x() & (warp_size - 1);
+
+  while (true) {
+    /// 1. Dequeue the next tile of edges [tile_begin, tile_end).
+    offset_t tile_begin = 0;
+    if (lane == 0)
+      tile_begin = math::atomic::add(&queue_counter[0], (offset_t)TILE_SIZE);
+    tile_begin = __shfl_sync(full_mask, tile_begin, 0);
+
+    if (tile_begin >= total_work)
+      break;
+
+    offset_t tile_end = (tile_begin + TILE_SIZE < total_work)
+                            ? tile_begin + TILE_SIZE
+                            : total_work;
+
+    /// 2. Find the input elements spanning this tile.
+    std::size_t first = 0, last = 0;
+    if (lane == 0) {
+      first = thrust::distance(
+                  segments, thrust::upper_bound(thrust::seq, segments,
+                                                segments + input_size,
+                                                tile_begin)) -
+              1;
+      last = thrust::distance(
+          segments, thrust::upper_bound(thrust::seq, segments + first,
+                                        segments + input_size, tile_end - 1));
+    }
+    first = __shfl_sync(full_mask, first, 0);
+    last = __shfl_sync(full_mask, last, 0);
+
+    /// 3. Process the edges of the tile, one per lane.
+    for (offset_t i = tile_begin + lane; i < tile_end; i += warp_size) {
+      auto it = thrust::upper_bound(thrust::seq, segments + first,
+                                    segments + last, i);
+      std::size_t idx = thrust::distance(segments, it) - 1;
+
+      vertex_t v = (input_type == advance_io_type_t::graph) ? vertex_t(idx)
+                                                            : input[idx];
+
+      auto e = G.get_starting_edge(v) + (i - segments[idx]);  // edge id
+      auto n = G.get_destination_vertex(e);                   // neighbor id
+      auto w = G.get_edge_weight(e);                          // weight
+
+#if (ESSENTIALS_COLLECT_METRICS)
+      benchmark::LOG_EDGE_VISITED(block_log, 1);
+      benchmark::LOG_VERTEX_VISITED(block_log, 2);
+#endif
+
+      // User-defined advance condition.
+      bool cond = op(v, n, e, w);
+
+      // Store [neighbor] into the output frontier.
+      if constexpr (output_type != advance_io_type_t::none) {
+        output[i] = cond ? n : gunrock::numeric_limits<type_t>::invalid();
+      }
+    }
+  }
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  benchmark::END_BLOCK_LOG(block_log);
+#endif
+}
+
+template <advance_direction_t direction,
+          advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t,
+          typename work_tiles_t>
+void execute(graph_t& G,
+             operator_t op,
+             frontier_t& input,
+             frontier_t& output,
+             work_tiles_t& segments,
+             gcuda::standard_context_t& context) {
+  using offset_t = typename work_tiles_t::value_type;
+
+  // The scanned work domain is required to map edges to elements, even when
+  // there is no output frontier.
+  std::size_t total_work = compute_output_offsets(
+      G, &input, segments, context,
+      (input_type == advance_io_type_t::graph) ? true : false);
+
+  if constexpr (output_type != advance_io_type_t::none) {
+    // If output frontier is empty, resize and return.
+    if (total_work <= 0) {
+      output.set_number_of_elements(0);
+      return;
+    }
+
+    /// Resize the output (inactive) buffer to the new size.
+    /// @todo Can be hidden within the frontier struct.
+    if (output.get_capacity() < total_work)
+      output.reserve(total_work);
+    output.set_number_of_elements(total_work);
+  }
+
+  if (total_work <= 0)
+    return;
+
+  std::size_t num_elements = (input_type == advance_io_type_t::graph)
+                                 ? G.get_number_of_vertices()
+                                 : input.get_number_of_elements();
+
+  // Set-up and launch work-stealing advance.
+  using namespace gcuda::launch_box;
+  using launch_t =
+      launch_box_t<launch_params_dynamic_grid_t<fallback, dim3_t<256>>>;
+
+  constexpr unsigned int tile_size = 256;
+
+  launch_t launch_box;
+  auto kernel = work_stealing_kernel<  // kernel
+      launch_box.block_dimensions.x,   // threads per block
+      tile_size,                       // edges per dequeue
+      input_type, output_type,         // i/o parameters
+      graph_t,                         // graph type
+      typename frontier_t::type_t,     // frontier value type
+      offset_t,                        // segments value type
+      operator_t                       // lambda type
+      >;
+
+  // Persistent grid: as many blocks as can be resident at once, but no more
+  // than there are tiles of work.
+  int blocks_per_sm = 0;
+  error::throw_if_exception(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &blocks_per_sm, kernel, launch_box.block_dimensions.x, 0));
+
+  std::size_t warps_per_block = launch_box.block_dimensions.x / 32;
+  std::size_t resident_blocks =
+      (std::size_t)context.props().multiProcessorCount * blocks_per_sm;
+  std::size_t required_blocks = math::divide_round_up(
+      math::divide_round_up(total_work, (std::size_t)tile_size),
+      warps_per_block);
+
+  launch_box.grid_dimensions = gcuda::launch_box::dimensions_t(
+      std::max<std::size_t>(1, std::min(resident_blocks, required_blocks)));
+
+  auto queue_counter = make_pooled_vector<offset_t>(context.stream(), 1, 0);
+  launch_box.launch(context, kernel, G, op, input.data(), output.data(),
+                    segments.data().get(), num_elements, (offset_t)total_work,
+                    queue_counter.data().get());
+  context.synchronize();
+}
+
+}  // namespace work_stealing
+}  // namespace advance
+}  // namespace operators
+}  // namespace gunrock
@@ -0,0 +1,268 @@
+/**
+ * @file advance_filter.hxx
+ * @brief Fused advance and filter operator, visits the neighbors of the input
+ * frontier and writes only the neighbors that pass both the advance condition
+ * and the filter predicate to a compacted output frontier, without
+ * materializing the intermediate (up to |E|) advance output.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/cuda/cuda.hxx>
+
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/advance/helpers.hxx>
+#include <gunrock/framework/benchmark.hxx>
+
+#include <cub/block/block_scan.cuh>
+
+namespace gunrock {
+namespace operators {
+namespace advance_filter {
+
+template <unsigned int THREADS_PER_BLOCK,
+          advance_io_type_t input_type,
+          typename graph_t,
+          typename type_t,
+          typename offset_counter_t,
+          typename operator_t,
+          typename predicate_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    advance_filter_kernel(graph_t const G,
+                          operator_t op,
+                          predicate_t predicate,
+                          type_t* input,
+                          type_t* output,
+                          std::size_t input_size,
+                          offset_counter_t* output_length) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+
+  // Specialize Block Scans for 1D block of THREADS_PER_BLOCK, one over the
+  // degrees (work items) and one over the survivors (output items).
+  using degree_scan_t = cub::BlockScan<edge_t, THREADS_PER_BLOCK>;
+  using keep_scan_t = cub::BlockScan<int, THREADS_PER_BLOCK>;
+
+  auto global_idx = gcuda::thread::global::id::x();
+  auto local_idx = gcuda::thread::local::id::x();
+
+  thrust::counting_iterator<type_t> all_vertices(0);
+  __shared__ typename degree_scan_t::TempStorage degree_scan;
+  __shared__ typename keep_scan_t::TempStorage keep_scan;
+  __shared__ offset_counter_t offset[1];
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  auto block_log = benchmark::BEGIN_BLOCK_LOG();
+#endif
+
+  /// 1. Load input data to shared/register memory.
+  __shared__ vertex_t vertices[THREADS_PER_BLOCK];
+  __shared__ edge_t degrees[THREADS_PER_BLOCK];
+  __shared__ edge_t sedges[THREADS_PER_BLOCK];
+  edge_t th_deg = 0;
+
+  if (global_idx < input_size) {
+    vertex_t v = (input_type == advance_io_type_t::graph)
+                     ? all_vertices[global_idx]
+                     : input[global_idx];
+    vertices[local_idx] = v;
+    if (gunrock::util::limits::is_valid(v)) {
+      sedges[local_idx] = G.get_starting_edge(v);
+      th_deg = G.get_number_of_neighbors(v);
+    }
+  } else {
+    vertices[local_idx] = gunrock::numeric_limits<vertex_t>::invalid();
+  }
+  __syncthreads();
+
+  /// 2. Exclusive sum of degrees to find total work items per block.
+  edge_t aggregate_degree_per_block;
+  degree_scan_t(degree_scan)
+      .ExclusiveSum(th_deg, th_deg, aggregate_degree_per_block);
+
+  // Store back to shared memory (to later use in the binary search).
+  degrees[local_idx] = th_deg;
+  __syncthreads();
+
+  auto length = global_idx - local_idx + gcuda::block::size::x();
+
+  if (input_size < length)
+    length = input_size;
+
+  length -= global_idx - local_idx;
+
+  /// 3. Compute. The block visits its edges in rounds of blockDim.x, every
+  /// thread of the block takes part in each round (the loop bound is uniform
+  /// within the block) such that the survivors of a round can be compacted
+  /// with a block-wide scan and a single global atomic.
+  for (edge_t base = 0;                    // first edge of the round
+       base < aggregate_degree_per_block;  // total degree to process
+       base += gcuda::block::size::x()     // increment by blockDim.x
+  ) {
+    edge_t i = base + local_idx;
+    vertex_t n = gunrock::numeric_limits<vertex_t>::invalid();
+    int keep = 0;
+
+    if (i < aggregate_degree_per_block) {
+      // Binary search to find which vertex id to work on.
+      auto it = thrust::upper_bound(thrust::seq, degrees, degrees + length, i);
+      vertex_t id = thrust::distance(degrees, it) - 1;
+
+      vertex_t v = (id < length) ? vertices[id]
+                                 : gunrock::numeric_limits<vertex_t>::invalid();
+
+      if (gunrock::util::limits::is_valid(v)) {
+        auto e = sedges[id] + i - degrees[id];
+        n = G.get_destination_vertex(e);
+        auto w = G.get_edge_weight(e);
+
+#if (ESSENTIALS_COLLECT_METRICS)
+        benchmark::LOG_EDGE_VISITED(block_log, 1);
+        benchmark::LOG_VERTEX_VISITED(block_log, 2);
+#endif
+
+        // User-defined advance condition, followed by the user-defined filter
+        // predicate on the surviving neighbor.
+        keep = (op(v, n, e, w) && predicate(n)) ? 1 : 0;
+      }
+    }
+
+    /// 4. Compact the survivors of this round into the output frontier.
+    int rank, survivors;
+    keep_scan_t(keep_scan).ExclusiveSum(keep, rank, survivors);
+
+    if ((local_idx == 0) && (survivors > 0))
+      offset[0] =
+          math::atomic::add(&output_length[0], (offset_counter_t)survivors);
+    __syncthreads();
+
+    if (keep)
+      output[offset[0] + rank] = n;
+
+    // Scan storage and the offset are reused next round.
+    __syncthreads();
+  }
+
+#if (ESSENTIALS_COLLECT_METRICS)
+  benchmark::END_BLOCK_LOG(block_log);
+#endif
+}
+
+/**
+ * @brief Fused advance and filter. Visits the neighbors of the input frontier
+ * (block-mapped) with the user-defined advance operator `op`, and writes a
+ * neighbor `n` to the output frontier only if `op` returned true and the
+ * user-defined filter predicate `predicate(n)` returned true.
+ *
+ * @par Overview
+ * Equivalent to `advance::execute<block_mapped>` followed by a filter with
+ * `predicate`, but the advance output never reaches global memory: survivors
+ * are compacted per block (one global atomic per blockDim.x edges). Saves one
+ * kernel launch and one frontier-sized write and read per iteration.
+ *
+ * @note The output frontier contains no invalids, but is unordered and may
+ * contain duplicates unless `predicate` removes them.
+ *
+ * @tparam input_type Input type of the advance (vertices or graph).
+ * @param G Graph.
+ * @param op Advance operator, `bool(source, neighbor, edge, weight)`.
+ * @param predicate Filter predicate, `bool(vertex_t const& neighbor)`.
+ * @param input Input frontier.
+ * @param output Output frontier.
+ * @param context CUDA context.
+ */
+template <advance_io_type_t input_type = advance_io_type_t::vertices,
+          typename graph_t,
+          typename operator_t,
+          typename predicate_t,
+          typename frontier_t>
+void execute(graph_t& G,
+             operator_t op,
+             predicate_t predicate,
+             frontier_t* input,
+             frontier_t* output,
+             gcuda::standard_context_t& context) {
+  using type_t = typename frontier_t::type_t;
+  using offset_t = typename frontier_t::offset_t;
+  benchmark::range_t range("advance_filter");
+#if (ESSENTIALS_COLLECT_METRICS)
+  benchmark::LOG_ADVANCE(advance_direction_t::forward,
+                         load_balance_t::block_mapped);
+#endif
+
+  static_assert(input_type != advance_io_type_t::none,
+                "Fused advance and filter requires an input.");
+
+  // Upper bound of the output, the sum of the degrees of the input.
+  auto size_of_output = advance::compute_output_length(
+      G, *input, context, (input_type == advance_io_type_t::graph));
+
+  if (size_of_output <= 0) {
+    output->set_number_of_elements(0);
+    return;
+  }
+
+  if (output->get_capacity() < size_of_output)
+    output->reserve(size_of_output);
+
+  std::size_t num_elements = (input_type == advance_io_type_t::graph)
+                                 ? G.get_number_of_vertices()
+                                 : input->get_number_of_elements();
+
+  // Set-up and launch fused advance and filter.
+  using namespace gcuda::launch_box;
+  using launch_t =
+      launch_box_t<launch_params_dynamic_grid_t<fallback, dim3_t<256>>>;
+
+  launch_t launch_box;
+  auto kernel = advance_filter_kernel<  // kernel
+      launch_box.block_dimensions.x,    // threads per block
+      input_type,                       // input type
+      graph_t,                          // graph type
+      type_t,                           // frontier value type
+      offset_t,                         // output length type
+      operator_t,                       // advance lambda type
+      predicate_t                       // filter lambda type
+      >;
+
+  auto output_length = make_pooled_vector<offset_t>(context.stream(), 1, 0);
+  launch_box.calculate_grid_dimensions_strided(num_elements);
+  launch_box.launch(context, kernel, G, op, predicate, input->data(),
+                    output->data(), num_elements, output_length.data().get());
+  context.synchronize();
+
+  thrust::host_vector<offset_t> compacted_size = output_length;
+  output->set_number_of_elements(compacted_size[0]);
+}
+
+/**
+ * @brief Fused advance and filter using the enactor's frontiers, @see the
+ * overload above. The input and output frontier buffers are swapped after the
+ * operator (unless `swap_buffers == false`).
+ */
+template <advance_io_type_t input_type = advance_io_type_t::vertices,
+          typename graph_t,
+          typename enactor_type,
+          typename operator_t,
+          typename predicate_t>
+void execute(graph_t& G,
+             enactor_type* E,
+             operator_t op,
+             predicate_t predicate,
+             gcuda::multi_context_t& context,
+             bool swap_buffers = true) {
+  execute<input_type>(G, op, predicate, E->get_input_frontier(),
+                      E->get_output_frontier(), *(context.get_context(0)));
+
+  if (swap_buffers)
+    E->swap_frontier_buffers();
+}
+
+}  // namespace advance_filter
+}  // namespace operators
+}  // namespace gunrock
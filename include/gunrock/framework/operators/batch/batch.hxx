@@ -16,8 +16,13 @@
 #include <thrust/host_vector.h>
 #include <thrust/reduce.h>
 
-#include <thread>
+#include <atomic>
 #include <chrono>
+#include <exception>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 namespace gunrock {
 namespace operators {
@@ -57,6 +62,9 @@ namespace batch {
  * @param total_elapsed pointer to an array of size 1, that stores the time
  * taken to execute all the batches.
  * @param args variadic arguments to be passed to the function (wip).
+ * @note Every job runs on its own thread, the jobs share no context, and their
+ * problems and enactors are rebuilt per job; prefer `pool_t` (below) for
+ * batches of many small jobs.
  */
 template <typename function_t, typename... args_t>
 void execute(function_t f,
@@ -77,10 +85,188 @@ void execute(function_t f,
   auto t_stop = high_resolution_clock::now();
   auto batch_elapsed = duration_cast<microseconds>(t_stop - t_start).count();
   total_elapsed[0] = (float)batch_elapsed / 1000;
+}
+
+/**
+ * @brief Per-job and aggregate timings of a batch, @see pool_t::execute().
+ */
+struct batch_stats_t {
+  /*!
+   * Host wall-clock time (ms) of every job, from the moment a worker picks the
+   * job up to the completion of its work on the worker's stream.
+   */
+  std::vector<float> latencies;
+
+  /*!
+   * Time (ms) returned by every job (for example, `enact()`'s runtime).
+   */
+  std::vector<float> elapsed;
+
+  /*!
+   * Host wall-clock time (ms) of the whole batch.
+   */
+  float total_elapsed{0};
+
+  std::size_t get_number_of_jobs() const { return latencies.size(); }
+
+  float get_average_latency() const {
+    if (latencies.empty())
+      return 0;
+    return std::accumulate(latencies.begin(), latencies.end(), 0.0f) /
+           latencies.size();
+  }
+
+  /**
+   * @brief Jobs completed per second.
+   */
+  float get_throughput() const {
+    if (total_elapsed <= 0)
+      return 0;
+    return get_number_of_jobs() / (total_elapsed / 1000);
+  }
+};
+
+/**
+ * @brief Fixed pool of workers, each bound to its own context (and therefore
+ * its own non-blocking stream), that execute a batch of jobs concurrently.
+ *
+ * @par Overview
+ * A worker is constructed once per pool as `worker_t(context, args...)` and
+ * typically holds an algorithm's `problem_t` and `enactor_t`, built over the
+ * worker's context. Its `float operator()(std::size_t job)` updates the
+ * problem's parameters for the job, `reset()`s the problem and `enact()`s the
+ * enactor, such that no memory is allocated per job and jobs of different
+ * workers overlap on the device. Jobs are handed out dynamically (the next
+ * free worker takes the next job), and the pool (workers and contexts) can
+ * execute any number of batches on the same shared graph.
+ *
+ * @par Example
+ * \code {.cpp}
+ * struct worker_t {
+ *   ... problem;  // e.g. bfs::problem_t<...>
+ *   ... enactor;  // e.g. bfs::enactor_t<...>
+ *   worker_t(std::shared_ptr<gcuda::multi_context_t> context, graph_t& G);
+ *   float operator()(std::size_t job) {
+ *     problem.param.single_source = sources[job];
+ *     problem.reset();
+ *     return enactor.enact();
+ *   }
+ * };
+ *
+ * operators::batch::pool_t<worker_t> pool(4, 0, G);  // 4 streams on GPU 0.
+ * auto stats = pool.execute(n_queries);
+ * \endcode
+ *
+ * @tparam worker_t Worker type.
+ */
+template <typename worker_t>
+class pool_t {
+ public:
+  /**
+   * @brief Construct the contexts and the workers of the pool.
+   *
+   * @param number_of_workers Number of workers (streams).
+   * @param device Device the workers run on.
+   * @param args Arguments (e.g. the graph) passed to every worker's
+   * constructor, after its context.
+   */
+  template <typename... args_t>
+  pool_t(std::size_t number_of_workers,
+         gcuda::device_id_t device,
+         args_t&&... args) {
+    error::throw_if_exception(number_of_workers == 0,
+                              "A batch pool needs at least one worker.");
+    for (std::size_t w = 0; w < number_of_workers; ++w) {
+      contexts.push_back(std::make_shared<gcuda::multi_context_t>(device));
+      workers.push_back(std::make_unique<worker_t>(contexts.back(), args...));
+    }
+  }
+
+  std::size_t size() const { return workers.size(); }
+
+  worker_t& get_worker(std::size_t w) { return *workers[w]; }
+
+  std::shared_ptr<gcuda::multi_context_t> get_context(std::size_t w) {
+    return contexts[w];
+  }
+
+  /**
+   * @brief Execute jobs `[0, number_of_jobs)` on the workers of the pool. The
+   * first exception thrown by a job stops the batch and is rethrown.
+   *
+   * @param number_of_jobs Number of jobs.
+   * @return batch_stats_t Per-job latencies and aggregate throughput.
+   */
+  batch_stats_t execute(std::size_t number_of_jobs) {
+    batch_stats_t stats;
+    stats.latencies.resize(number_of_jobs);
+    stats.elapsed.resize(number_of_jobs);
+
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(size());
 
-  // average_time[0] =
-  //     thrust::reduce(thrust::host, elapsed.begin(), elapsed.end(),
-  //                    (float)0.0f, thrust::plus<float>());
+    using namespace std::chrono;
+    auto t_start = high_resolution_clock::now();
+    for (std::size_t w = 0; w < size(); ++w) {
+      threads.emplace_back([&, w]() {
+        try {
+          auto context = contexts[w]->get_context(0);
+          gcuda::device::set(context->ordinal());
+          for (auto j = next++; j < number_of_jobs; j = next++) {
+            auto t_job = high_resolution_clock::now();
+            stats.elapsed[j] = (*workers[w])(j);
+            context->synchronize();
+            auto latency = duration_cast<microseconds>(
+                high_resolution_clock::now() - t_job);
+            stats.latencies[j] = (float)latency.count() / 1000;
+          }
+        } catch (...) {
+          errors[w] = std::current_exception();
+          next = number_of_jobs;
+        }
+      });
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+
+    auto batch_elapsed =
+        duration_cast<microseconds>(high_resolution_clock::now() - t_start);
+    stats.total_elapsed = (float)batch_elapsed.count() / 1000;
+
+    for (auto& error : errors)
+      if (error)
+        std::rethrow_exception(error);
+
+    return stats;
+  }
+
+ private:
+  std::vector<std::shared_ptr<gcuda::multi_context_t>> contexts;
+  std::vector<std::unique_ptr<worker_t>> workers;
+};  // class pool_t
+
+/**
+ * @brief Execute a batch of jobs on a (temporary) pool of workers, @see
+ * pool_t. Use `pool_t` directly to reuse the workers across batches.
+ *
+ * @tparam worker_t Worker type.
+ * @param number_of_jobs Number of jobs.
+ * @param number_of_workers Number of workers (streams) to execute them on.
+ * @param args Arguments passed to every worker's constructor.
+ * @return batch_stats_t Per-job latencies and aggregate throughput.
+ */
+template <typename worker_t, typename... args_t>
+batch_stats_t execute(std::size_t number_of_jobs,
+                      std::size_t number_of_workers,
+                      args_t&&... args) {
+  gcuda::device_id_t device;
+  cudaGetDevice(&device);
+  pool_t<worker_t> pool(std::max<std::size_t>(
+                            1, std::min(number_of_workers, number_of_jobs)),
+                        device, std::forward<args_t>(args)...);
+  return pool.execute(number_of_jobs);
 }
 
 }  // namespace batch
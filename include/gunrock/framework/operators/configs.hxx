@@ -51,14 +51,25 @@ namespace operators {
  */
 enum load_balance_t {
   thread_mapped,  ///< 1 element per thread
-  warp_mapped,    ///< (wip) Equal # of elements per warp
+  warp_mapped,    ///< Equal # of elements per warp
   block_mapped,   ///< Equal # of elements per block
-  bucketing,      ///< (wip) Davidson et al. (SSSP)
+  bucketing,      ///< Davidson et al. (SSSP), @see bucketing::execute
   merge_path,     ///< Merrill & Garland (SpMV):: ModernGPU
   merge_path_v2,  ///< Merrill & Garland (SpMV):: CUSTOM
-  work_stealing,  ///< (wip) <cite>
+  work_stealing,  ///< Persistent warps dequeue equal # of edges
+  adaptive,       ///< Selected per advance, @see adaptive::select
 };
 
+/**
+ * @brief Name of a load-balancing technique (for logging and reporting).
+ */
+inline constexpr const char* load_balance_name(load_balance_t lb) {
+  constexpr const char* names[] = {
+      "thread_mapped", "warp_mapped",   "block_mapped", "bucketing",
+      "merge_path",    "merge_path_v2", "work_stealing", "adaptive"};
+  return names[lb];
+}
+
 /**
  * @brief Type of the input and output for advance. E.g. none imples that there
  * will be no output for the advance.
@@ -81,6 +92,15 @@ enum advance_direction_t {
   optimized  ///< Push-pull optimized
 };
 
+/**
+ * @brief Name of an advance direction (for logging and reporting).
+ */
+inline constexpr const char* advance_direction_name(
+    advance_direction_t direction) {
+  constexpr const char* names[] = {"forward", "backward", "optimized"};
+  return names[direction];
+}
+
 /**
  * @brief Underlying filter algorithm to use.
  *
@@ -100,8 +120,12 @@ enum filter_algorithm_t {
 enum uniquify_algorithm_t {
   unique,  ///< Keep only the unique item for each consecutive group. Sort for
            ///< 100% uniqueness.
-  unique_copy  ///< Copy the unique items for each consecutive group. Sort for
-               ///< 100% uniqueness.
+  unique_copy,  ///< Copy the unique items for each consecutive group. Sort for
+                ///< 100% uniqueness.
+  bitmap,       ///< Copy the first copy of each item using an atomic bitmap.
+                ///< Exact, no sort.
+  cull          ///< Copy the items, culling duplicates with a per-block hash
+                ///< table. Best-effort, no sort.
 };
 
 enum parallel_for_each_t {
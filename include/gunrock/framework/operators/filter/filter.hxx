@@ -12,6 +12,7 @@
 
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/benchmark.hxx>
 #include <gunrock/util/type_limits.hxx>
 #include <gunrock/util/type_traits.hxx>
 
@@ -77,6 +78,7 @@ void execute(graph_t& G,
              frontier_t* input,
              frontier_t* output,
              gcuda::multi_context_t& context) {
+  benchmark::range_t range("filter");
   if (context.size() == 1) {
     auto single_context = context.get_context(0);
 
@@ -4,6 +4,7 @@
 
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/benchmark.hxx>
 
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -29,6 +30,7 @@ template <parallel_for_each_t type, typename func_t, typename frontier_t>
 std::enable_if_t<type == parallel_for_each_t::element>
 execute(frontier_t& f, func_t op, gcuda::multi_context_t& context) {
   static_assert(type == parallel_for_each_t::element);
+  benchmark::range_t range("parallel_for");
   using type_t = typename frontier_t::type_t;
   auto single_context = context.get_context(0);
   /// TODO: use get and set frontier elements instead.
@@ -63,6 +65,7 @@ execute(graph_t& G, func_t op, gcuda::multi_context_t& context) {
   static_assert((type == parallel_for_each_t::weight) ||
                 (type == parallel_for_each_t::edge) ||
                 (type == parallel_for_each_t::vertex));
+  benchmark::range_t range("parallel_for");
   using index_t = std::conditional_t<type == parallel_for_each_t::vertex,
                                      typename graph_t::vertex_type,
                                      typename graph_t::edge_type>;
@@ -15,6 +15,8 @@
 #include <gunrock/util/type_limits.hxx>
 
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/benchmark.hxx>
+#include <gunrock/framework/operators/neighborreduce/row_kernels.hxx>
 
 #include <moderngpu/kernel_segreduce.hxx>
 
@@ -34,7 +36,8 @@ namespace neighborreduce {
  * Neighbor reduce operator, built on top of segmented reduction. This is
  * a very limited approach to neighbor reduce, and only gives you the edge per
  * advance. It's only implemented on the entire graph (frontiers not yet
- * supported).
+ * supported). @see neighborreduce::make_plan() for the row-wise reduction
+ * kernels specialized to the graph's row lengths (and value types).
  *
  * @tparam input_t advance input type (advance_io_type_t::graph supported)
  * @tparam graph_t graph type.
@@ -64,6 +67,7 @@ void execute(graph_t& G,
              arithmetic_t arithmetic_op,
              output_t init_value,
              gcuda::multi_context_t& context) {
+  benchmark::range_t range("neighborreduce");
   if (context.size() == 1) {
     auto context0 = context.get_context(0);
 
@@ -0,0 +1,556 @@
+/**
+ * @file row_kernels.hxx
+ * @brief Row-wise (segmented) reduction kernels of neighborreduce,
+ * specialized at compile time and chosen by the row length statistics of the
+ * graph: CSR-vector, CSR-adaptive and merge-based.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/cuda/context.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/container/vector.hxx>
+#include <gunrock/framework/benchmark.hxx>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/unique.h>
+
+#include <cooperative_groups.h>
+#include <cub/block/block_reduce.cuh>
+#include <cub/block/block_scan.cuh>
+#include <cub/util_type.cuh>
+
+#include <algorithm>
+
+namespace gunrock {
+namespace operators {
+namespace neighborreduce {
+
+/**
+ * @brief Row-wise reduction kernel, @see make_plan().
+ */
+enum class kernel_t {
+  automatic,     ///< Chosen by the row length statistics.
+  csr_vector,    ///< A group of 2-32 threads per row (regular rows).
+  csr_adaptive,  ///< Rows binned into blocks of similar work (some skew).
+  merge_path     ///< Equal shares of rows + nonzeros per thread (any skew).
+};
+
+namespace row_kernels {
+
+namespace cg = cooperative_groups;
+
+constexpr int block_size = 256;
+/// Nonzeros a CSR-adaptive block stages in shared memory (rows are binned
+/// into blocks starting within one `chunk_size` range, twice is the worst).
+constexpr int chunk_size = 4 * block_size;
+/// Merge-path items (rows and nonzeros) consumed per thread.
+constexpr int items_per_thread = 8;
+
+template <int threads_per_row,
+          typename accumulate_t,
+          typename index_t,
+          typename offset_t,
+          typename operator_t,
+          typename arithmetic_t,
+          typename store_t>
+__global__ void __launch_bounds__(block_size)
+    csr_vector(offset_t const* offsets,
+               index_t rows,
+               operator_t op,
+               arithmetic_t arithmetic_op,
+               accumulate_t init_value,
+               store_t store) {
+  auto tile = cg::tiled_partition<threads_per_row>(cg::this_thread_block());
+  std::size_t groups = std::size_t(gridDim.x) * (block_size / threads_per_row);
+  for (std::size_t row =
+           (std::size_t(blockIdx.x) * block_size + threadIdx.x) /
+           threads_per_row;
+       row < rows; row += groups) {
+    accumulate_t sum = init_value;
+    offset_t end = offsets[row + 1];
+    for (offset_t e = offsets[row] + tile.thread_rank(); e < end;
+         e += threads_per_row)
+      sum = arithmetic_op(sum, accumulate_t(op(e)));
+
+    for (int offset = threads_per_row / 2; offset > 0; offset /= 2)
+      sum = arithmetic_op(sum, tile.shfl_down(sum, offset));
+
+    if (tile.thread_rank() == 0)
+      store(index_t(row), sum);
+  }
+}
+
+template <typename accumulate_t,
+          typename index_t,
+          typename offset_t,
+          typename operator_t,
+          typename arithmetic_t,
+          typename store_t>
+__global__ void __launch_bounds__(block_size)
+    csr_adaptive(offset_t const* offsets,
+                 index_t const* row_blocks,
+                 operator_t op,
+                 arithmetic_t arithmetic_op,
+                 accumulate_t init_value,
+                 store_t store) {
+  using block_reduce_t = cub::BlockReduce<accumulate_t, block_size>;
+  __shared__ accumulate_t cache[2 * chunk_size];
+  __shared__ typename block_reduce_t::TempStorage temp_storage;
+
+  index_t first = row_blocks[blockIdx.x];
+  index_t last = row_blocks[blockIdx.x + 1];
+  offset_t begin = offsets[first];
+  offset_t end = offsets[last];
+
+  if ((last - first > 1) && (end - begin <= 2 * chunk_size)) {
+    // CSR-stream: stage the block's nonzeros, then a thread per row.
+    for (offset_t e = begin + threadIdx.x; e < end; e += block_size)
+      cache[e - begin] = accumulate_t(op(e));
+    __syncthreads();
+
+    for (index_t row = first + threadIdx.x; row < last; row += block_size) {
+      accumulate_t sum = init_value;
+      for (offset_t e = offsets[row]; e < offsets[row + 1]; ++e)
+        sum = arithmetic_op(sum, cache[e - begin]);
+      store(row, sum);
+    }
+  } else {
+    // Long row(s): the whole block reduces each row.
+    for (index_t row = first; row < last; ++row) {
+      accumulate_t sum = init_value;
+      for (offset_t e = offsets[row] + threadIdx.x; e < offsets[row + 1];
+           e += block_size)
+        sum = arithmetic_op(sum, accumulate_t(op(e)));
+      sum = block_reduce_t(temp_storage).Reduce(sum, arithmetic_op);
+      if (threadIdx.x == 0)
+        store(row, sum);
+      __syncthreads();
+    }
+  }
+}
+
+/// Rows (merged with the nonzeros) consumed before `diagonal` of the merge
+/// path of the row end offsets and the nonzero indices.
+template <typename index_t, typename offset_t>
+__device__ __forceinline__ index_t merge_path_search(offset_t const* row_ends,
+                                                     index_t rows,
+                                                     offset_t nonzeros,
+                                                     std::size_t diagonal) {
+  std::size_t low = (diagonal > std::size_t(nonzeros)) ? diagonal - nonzeros
+                                                       : 0;
+  std::size_t high = std::min<std::size_t>(diagonal, rows);
+  while (low < high) {
+    std::size_t pivot = (low + high) / 2;
+    if (std::size_t(row_ends[pivot]) <= diagonal - pivot - 1)
+      low = pivot + 1;
+    else
+      high = pivot;
+  }
+  return index_t(low);
+}
+
+/**
+ * @brief Segmented reduction of (row, value) pairs whose rows are sorted: a
+ * pair continues the reduction of the previous one if it has the same row.
+ */
+template <typename arithmetic_t>
+struct reduce_by_row_t {
+  arithmetic_t arithmetic_op;
+
+  template <typename pair_t>
+  __device__ __forceinline__ pair_t operator()(pair_t const& a,
+                                               pair_t const& b) const {
+    return (a.key == b.key) ? pair_t(b.key, arithmetic_op(a.value, b.value))
+                            : b;
+  }
+};
+
+/**
+ * @brief Merge-based reduction. Every thread consumes `items_per_thread`
+ * items of the merge path of the rows and the nonzeros, and writes the part of
+ * each row ending in its share to `partials`. The thread's carry (the row its
+ * share stops in) is then reduced by row within the block (as in Merrill and
+ * Garland, "Merge-based Parallel Sparse Matrix-Vector Multiplication",
+ * SC'16): the carries of a row ending in the block are folded into its
+ * partial, the one reaching the block's end is the block's carry.
+ */
+template <typename accumulate_t,
+          typename index_t,
+          typename offset_t,
+          typename operator_t,
+          typename arithmetic_t>
+__global__ void __launch_bounds__(block_size)
+    merge_path(offset_t const* offsets,
+               index_t rows,
+               offset_t nonzeros,
+               operator_t op,
+               arithmetic_t arithmetic_op,
+               accumulate_t init_value,
+               accumulate_t* partials,
+               index_t* carry_rows,
+               accumulate_t* carry_values) {
+  using pair_t = cub::KeyValuePair<index_t, accumulate_t>;
+  using block_scan_t = cub::BlockScan<pair_t, block_size>;
+  __shared__ typename block_scan_t::TempStorage scan;
+  __shared__ index_t block_rows[block_size];
+
+  std::size_t thread = std::size_t(blockIdx.x) * block_size + threadIdx.x;
+  std::size_t total = std::size_t(rows) + nonzeros;
+  std::size_t diagonal = std::min(thread * items_per_thread, total);
+  std::size_t diagonal_end = std::min(diagonal + items_per_thread, total);
+
+  // Threads past the end carry nothing (row `rows`).
+  index_t row = merge_path_search(offsets + 1, rows, nonzeros, diagonal);
+  index_t row_end =
+      merge_path_search(offsets + 1, rows, nonzeros, diagonal_end);
+  std::size_t e = diagonal - row;
+  std::size_t e_end = diagonal_end - row_end;
+
+  // Rows ending in this thread's share hold its part of the row.
+  accumulate_t sum = init_value;
+  for (; row < row_end; ++row) {
+    for (; e < std::size_t(offsets[row + 1]); ++e)
+      sum = arithmetic_op(sum, accumulate_t(op(offset_t(e))));
+    partials[row] = sum;
+    sum = init_value;
+  }
+  for (; e < e_end; ++e)
+    sum = arithmetic_op(sum, accumulate_t(op(offset_t(e))));
+
+  // The row this share stops in, continued by the next thread(s).
+  pair_t carry(row_end, sum);
+  block_rows[threadIdx.x] = row_end;
+  reduce_by_row_t<arithmetic_t> reduce_by_row{arithmetic_op};
+  block_scan_t(scan).InclusiveScan(carry, carry, reduce_by_row);
+  __syncthreads();
+
+  // The last carry of a row (its reduction over the block's carries) folds
+  // into the row's partial, written by the next thread, or is the block's.
+  if (threadIdx.x == block_size - 1) {
+    carry_rows[blockIdx.x] = carry.key;
+    carry_values[blockIdx.x] = carry.value;
+  } else if ((block_rows[threadIdx.x + 1] != carry.key) &&
+             (carry.key < rows)) {
+    partials[carry.key] = arithmetic_op(partials[carry.key], carry.value);
+  }
+}
+
+/**
+ * @brief Fold the blocks' carries of `merge_path` into the partials, by a
+ * single block reducing them by row, `block_size` carries at a time.
+ */
+template <typename accumulate_t, typename index_t, typename arithmetic_t>
+__global__ void __launch_bounds__(block_size)
+    merge_path_fixup(index_t rows,
+                     std::size_t carries,
+                     index_t const* carry_rows,
+                     accumulate_t const* carry_values,
+                     arithmetic_t arithmetic_op,
+                     accumulate_t init_value,
+                     accumulate_t* partials) {
+  using pair_t = cub::KeyValuePair<index_t, accumulate_t>;
+  using block_scan_t = cub::BlockScan<pair_t, block_size>;
+  __shared__ typename block_scan_t::TempStorage scan;
+
+  reduce_by_row_t<arithmetic_t> reduce_by_row{arithmetic_op};
+  pair_t running(rows, init_value);  // reduction of the previous carries.
+  for (std::size_t first = 0; first < carries; first += block_size) {
+    std::size_t i = first + threadIdx.x;
+    pair_t carry = (i < carries) ? pair_t(carry_rows[i], carry_values[i])
+                                 : pair_t(rows, init_value);
+    pair_t aggregate;
+    block_scan_t(scan).InclusiveScan(carry, carry, reduce_by_row, aggregate);
+    carry = reduce_by_row(running, carry);
+    running = reduce_by_row(running, aggregate);
+
+    bool last_of_row = (i < carries) && ((i + 1 == carries) ||
+                                          (carry_rows[i + 1] != carry.key));
+    if (last_of_row && (carry.key < rows))
+      partials[carry.key] = arithmetic_op(partials[carry.key], carry.value);
+    __syncthreads();  // `scan` is reused.
+  }
+}
+
+template <typename accumulate_t, typename index_t, typename store_t>
+__global__ void store_rows(index_t rows,
+                           accumulate_t const* partials,
+                           store_t store) {
+  std::size_t stride = std::size_t(gridDim.x) * blockDim.x;
+  for (std::size_t row = std::size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+       row < rows; row += stride)
+    store(index_t(row), partials[row]);
+}
+
+}  // namespace row_kernels
+
+/**
+ * @brief Kernel selection (and its precomputed data) for the row-wise
+ * reduction of a CSR-like graph, @see make_plan().
+ *
+ * @tparam index_t row (vertex) type.
+ * @tparam offset_t row offset (edge) type.
+ * @tparam accumulate_t type the reduction is computed in.
+ */
+template <typename index_t, typename offset_t, typename accumulate_t>
+struct plan_t {
+  kernel_t kernel = kernel_t::csr_vector;
+
+  offset_t const* offsets = nullptr;
+  index_t number_of_rows = 0;
+  offset_t number_of_nonzeros = 0;
+  offset_t max_row_length = 0;
+
+  /*!
+   * CSR-vector threads per row (a power of two, 2 to 32).
+   */
+  int threads_per_row = 32;
+
+  /*!
+   * CSR-adaptive row blocks (first row of each block, and the number of rows).
+   */
+  thrust::device_vector<index_t> row_blocks;
+
+  /*!
+   * Merge-path blocks, the partial of every row and the carry of every block.
+   * Allocated with the plan (and overwritten by every reduction), such that a
+   * reduction captured in a CUDA graph is replayed on the same memory.
+   */
+  std::size_t merge_path_blocks = 0;
+  thrust::device_vector<accumulate_t> partials;
+  thrust::device_vector<index_t> carry_rows;
+  thrust::device_vector<accumulate_t> carry_values;
+};
+
+/**
+ * @brief Choose (if `kernel` is `kernel_t::automatic`) and prepare a row-wise
+ * reduction kernel for the rows delimited by `offsets`.
+ *
+ * @par Overview
+ * Regular rows (the longest row is at most about twice the mean) are reduced
+ * by CSR-vector, with the group of threads per row sized to the mean row
+ * length. Skewed rows are binned by CSR-adaptive into blocks of about
+ * `4 * 256` nonzeros, or a single long row. Rows longer than 32 blocks of
+ * work would serialize a CSR-adaptive block, they go to the merge-based
+ * kernel, which splits rows and nonzeros evenly over all threads.
+ *
+ * @tparam accumulate_t type the reduction is computed in, @see execute().
+ * @param offsets row offsets (on the device), `rows + 1` elements.
+ * @param rows number of rows.
+ * @param nonzeros number of nonzeros (`offsets[rows]`).
+ * @param context device context (@see gcuda::multi_context_t).
+ * @param kernel kernel to use (`kernel_t::automatic` to choose).
+ * @return plan_t<index_t, offset_t, accumulate_t> plan, reusable for any
+ * values, operator and output on the same rows.
+ */
+template <typename accumulate_t, typename index_t, typename offset_t>
+plan_t<index_t, offset_t, accumulate_t> make_plan(
+    offset_t const* offsets,
+    index_t rows,
+    offset_t nonzeros,
+    gcuda::multi_context_t& context,
+    kernel_t kernel = kernel_t::automatic) {
+  plan_t<index_t, offset_t, accumulate_t> plan;
+  plan.offsets = offsets;
+  plan.number_of_rows = rows;
+  plan.number_of_nonzeros = nonzeros;
+  if (rows == 0)
+    return plan;
+
+  auto policy = context.get_context(0)->execution_policy();
+  plan.max_row_length = thrust::transform_reduce(
+      policy, thrust::counting_iterator<index_t>(0),
+      thrust::counting_iterator<index_t>(rows),
+      [=] __host__ __device__(index_t const& row) -> offset_t {
+        return offsets[row + 1] - offsets[row];
+      },
+      offset_t(0), thrust::maximum<offset_t>());
+
+  double mean = double(nonzeros) / double(rows);
+  if (kernel == kernel_t::automatic) {
+    if (plan.max_row_length <= 2 * mean + 32)
+      kernel = kernel_t::csr_vector;
+    else if (plan.max_row_length <= 32 * row_kernels::chunk_size)
+      kernel = kernel_t::csr_adaptive;
+    else
+      kernel = kernel_t::merge_path;
+  }
+  plan.kernel = kernel;
+
+  plan.threads_per_row = 2;
+  while ((plan.threads_per_row < 32) && (plan.threads_per_row < mean))
+    plan.threads_per_row *= 2;
+
+  if (kernel == kernel_t::csr_adaptive) {
+    // Blocks start at the first row starting in each chunk of nonzeros, and
+    // around every row longer than a chunk.
+    std::size_t chunks =
+        (std::size_t(nonzeros) + row_kernels::chunk_size - 1) /
+        row_kernels::chunk_size;
+    thrust::device_vector<index_t> long_rows(rows);
+    auto long_end = thrust::copy_if(
+        policy, thrust::counting_iterator<index_t>(0),
+        thrust::counting_iterator<index_t>(rows), long_rows.begin(),
+        [=] __host__ __device__(index_t const& row) {
+          return (offsets[row + 1] - offsets[row]) > row_kernels::chunk_size;
+        });
+    std::size_t n_long = long_end - long_rows.begin();
+
+    auto& blocks = plan.row_blocks;
+    blocks.resize(chunks + 2 * n_long + 2);
+    auto chunk_starts = thrust::make_transform_iterator(
+        thrust::counting_iterator<offset_t>(0),
+        [] __host__ __device__(offset_t const& chunk) -> offset_t {
+          return chunk * row_kernels::chunk_size;
+        });
+    thrust::lower_bound(policy, offsets, offsets + rows + 1, chunk_starts,
+                        chunk_starts + chunks, blocks.begin());
+    thrust::copy(policy, long_rows.begin(), long_end, blocks.begin() + chunks);
+    thrust::transform(policy, long_rows.begin(), long_end,
+                      blocks.begin() + chunks + n_long,
+                      [] __host__ __device__(index_t const& row) -> index_t {
+                        return row + 1;
+                      });
+    blocks[chunks + 2 * n_long] = 0;
+    blocks[chunks + 2 * n_long + 1] = rows;
+
+    thrust::sort(policy, blocks.begin(), blocks.end());
+    auto blocks_end = thrust::unique(policy, blocks.begin(), blocks.end());
+    // Rows past the last nonzero (empty) map to `rows`, the end.
+    blocks.resize(blocks_end - blocks.begin());
+  } else if (kernel == kernel_t::merge_path) {
+    std::size_t total = std::size_t(rows) + nonzeros;
+    std::size_t threads =
+        (total + row_kernels::items_per_thread - 1) /
+        row_kernels::items_per_thread;
+    plan.merge_path_blocks =
+        (threads + row_kernels::block_size - 1) / row_kernels::block_size;
+    plan.partials.resize(rows);
+    plan.carry_rows.resize(plan.merge_path_blocks);
+    plan.carry_values.resize(plan.merge_path_blocks);
+  }
+  return plan;
+}
+
+/**
+ * @brief Choose and prepare a row-wise reduction kernel for the CSR
+ * representation of a graph, @see make_plan().
+ */
+template <typename accumulate_t, typename graph_t>
+auto make_plan(graph_t& G,
+               gcuda::multi_context_t& context,
+               kernel_t kernel = kernel_t::automatic) {
+  using find_csr_t = typename graph_t::graph_csr_view_t;
+  if (!(G.template contains_representation<find_csr_t>())) {
+    error::throw_if_exception(cudaErrorUnknown,
+                              "CSR sparse-matrix representation "
+                              "required for neighborreduce operator.");
+  }
+  return make_plan<accumulate_t>(G.get_row_offsets(),
+                                 G.get_number_of_vertices(),
+                                 G.get_number_of_edges(), context, kernel);
+}
+
+/**
+ * @brief Reduce every row of a plan, `store(row, arithmetic_op(op(e)...))`
+ * over the row's edges (nonzeros) `e`, with the kernel chosen by the plan.
+ *
+ * @par Overview
+ * Specialized neighbor reduce, for bandwidth-bound uses such as SpMV: the
+ * values `op(e)` are converted to and reduced in `accumulate_t` (for example,
+ * fp32 for fp16 or bf16 nonzero values), and the result of every row is passed
+ * to `store` (which may, for example, convert it to the output's type or
+ * accumulate it into the output). `init_value` must be the identity of
+ * `arithmetic_op`, which must be associative and commutative (rows are split
+ * over threads).
+ *
+ * @tparam accumulate_t type the reduction is computed in.
+ * @param plan kernel and rows to reduce, @see make_plan().
+ * @param op user-defined device function, `accumulate_t op(offset_t e)`.
+ * @param arithmetic_op binary reduction operator.
+ * @param init_value identity of `arithmetic_op`.
+ * @param store user-defined device function, `store(index_t row, sum)`.
+ * @param context device context (@see gcuda::multi_context_t).
+ */
+template <typename accumulate_t,
+          typename index_t,
+          typename offset_t,
+          typename operator_t,
+          typename arithmetic_t,
+          typename store_t>
+void execute(plan_t<index_t, offset_t, accumulate_t>& plan,
+             operator_t op,
+             arithmetic_t arithmetic_op,
+             accumulate_t init_value,
+             store_t store,
+             gcuda::multi_context_t& context) {
+  benchmark::range_t range("neighborreduce");
+  using namespace row_kernels;
+
+  index_t rows = plan.number_of_rows;
+  if (rows == 0)
+    return;
+  auto stream = context.get_context(0)->stream();
+  auto offsets = plan.offsets;
+
+  if (plan.kernel == kernel_t::csr_adaptive) {
+    std::size_t blocks = plan.row_blocks.size() - 1;
+    csr_adaptive<<<blocks, block_size, 0, stream>>>(
+        offsets, plan.row_blocks.data().get(), op, arithmetic_op, init_value,
+        store);
+  } else if (plan.kernel == kernel_t::merge_path) {
+    std::size_t blocks = plan.merge_path_blocks;
+    auto partials = plan.partials.data().get();
+    auto carry_rows = plan.carry_rows.data().get();
+    auto carry_values = plan.carry_values.data().get();
+
+    merge_path<<<blocks, block_size, 0, stream>>>(
+        offsets, rows, plan.number_of_nonzeros, op, arithmetic_op, init_value,
+        partials, carry_rows, carry_values);
+    merge_path_fixup<<<1, block_size, 0, stream>>>(
+        rows, blocks, carry_rows, carry_values, arithmetic_op, init_value,
+        partials);
+    store_rows<<<(rows + block_size - 1) / block_size, block_size, 0,
+                 stream>>>(rows, partials, store);
+  } else {
+    std::size_t blocks =
+        (std::size_t(rows) * plan.threads_per_row + block_size - 1) /
+        block_size;
+    auto launch = [&](auto threads_per_row) {
+      csr_vector<decltype(threads_per_row)::value>
+          <<<blocks, block_size, 0, stream>>>(offsets, rows, op, arithmetic_op,
+                                              init_value, store);
+    };
+    switch (plan.threads_per_row) {
+      case 2:
+        launch(std::integral_constant<int, 2>());
+        break;
+      case 4:
+        launch(std::integral_constant<int, 4>());
+        break;
+      case 8:
+        launch(std::integral_constant<int, 8>());
+        break;
+      case 16:
+        launch(std::integral_constant<int, 16>());
+        break;
+      default:
+        launch(std::integral_constant<int, 32>());
+    }
+  }
+}
+
+}  // namespace neighborreduce
+}  // namespace operators
+}  // namespace gunrock
@@ -18,6 +18,7 @@ namespace operators {}  // namespace operators
 
 #include <gunrock/framework/operators/advance/advance.hxx>
 #include <gunrock/framework/operators/filter/filter.hxx>
+#include <gunrock/framework/operators/advance_filter/advance_filter.hxx>
 #include <gunrock/framework/operators/for/for.hxx>
 #include <gunrock/framework/operators/uniquify/uniquify.hxx>
 #include <gunrock/framework/operators/batch/batch.hxx>
@@ -0,0 +1,188 @@
+/**
+ * @file bitmap.hxx
+ * @brief Exact, sort-free uniquify using an atomic bitmap, the first copy of
+ * each element claims its bit and every later copy is culled.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/cuda/cuda.hxx>
+
+#include <gunrock/framework/operators/configs.hxx>
+
+#include <thrust/transform_reduce.h>
+#include <thrust/functional.h>
+
+#include <cub/block/block_scan.cuh>
+
+namespace gunrock {
+namespace operators {
+namespace uniquify {
+namespace bitmap {
+
+/**
+ * @brief Device predicate that returns true for the first visit of an element
+ * (atomically setting its bit in `words`) and false for every later visit.
+ * Usable as the predicate of a filter or of a fused advance and filter (@see
+ * operators::advance_filter) to deduplicate in the advance epilogue.
+ *
+ * @tparam type_t Element type (vertex or edge ids).
+ */
+template <typename type_t>
+struct first_visit_t {
+  using word_t = unsigned int;
+  static constexpr std::size_t bits_per_word = sizeof(word_t) * 8;
+
+  word_t* words;
+
+  __device__ __forceinline__ bool operator()(type_t const& x) const {
+    if (!gunrock::util::limits::is_valid(x))
+      return false;
+
+    word_t mask = word_t(1) << (x % bits_per_word);
+    word_t old = atomicOr(words + (x / bits_per_word), mask);
+    return !(old & mask);
+  }
+};
+
+/**
+ * @brief Bitmap of the visited elements, clear it (O(n / 32)) before reuse.
+ *
+ * @tparam type_t Element type (vertex or edge ids).
+ */
+template <typename type_t>
+class visited_t {
+ public:
+  using predicate_t = first_visit_t<type_t>;
+  using word_t = typename predicate_t::word_t;
+
+  /**
+   * @brief Construct a bitmap covering the elements in `[0, n)`, used on
+   * `stream`.
+   */
+  visited_t(std::size_t n, cudaStream_t stream)
+      : words(make_pooled_vector<word_t>(stream)) {
+    resize(n);
+  }
+
+  void resize(std::size_t n) {
+    words.resize(math::divide_round_up(n, predicate_t::bits_per_word));
+  }
+
+  void clear(gcuda::standard_context_t& context) {
+    thrust::fill(context.execution_policy(), words.begin(), words.end(),
+                 word_t(0));
+  }
+
+  /**
+   * @brief Device predicate, valid as long as this bitmap is not resized.
+   */
+  predicate_t get_predicate() { return predicate_t{words.data().get()}; }
+
+ private:
+  pooled_vector_t<word_t> words;
+};
+
+template <unsigned int THREADS_PER_BLOCK,
+          typename type_t,
+          typename offset_counter_t,
+          typename predicate_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    bitmap_kernel(type_t const* input,
+                  type_t* output,
+                  std::size_t input_size,
+                  predicate_t first_visit,
+                  offset_counter_t* output_length) {
+  using block_scan_t = cub::BlockScan<int, THREADS_PER_BLOCK>;
+  __shared__ typename block_scan_t::TempStorage scan;
+  __shared__ offset_counter_t offset[1];
+
+  auto idx = gcuda::thread::global::id::x();
+  type_t x = gunrock::numeric_limits<type_t>::invalid();
+  int keep = 0;
+
+  if (idx < input_size) {
+    x = input[idx];
+    keep = first_visit(x) ? 1 : 0;
+  }
+
+  // Compact the first visits into the output, one global atomic per block.
+  int rank, aggregate;
+  block_scan_t(scan).ExclusiveSum(keep, rank, aggregate);
+
+  if ((gcuda::thread::local::id::x() == 0) && (aggregate > 0))
+    offset[0] =
+        math::atomic::add(&output_length[0], (offset_counter_t)aggregate);
+  __syncthreads();
+
+  if (keep)
+    output[offset[0] + rank] = x;
+}
+
+/**
+ * @brief Copies the unique valid elements of the input to the output frontier
+ * in O(input) without sorting. The output is unordered.
+ *
+ * @param input Input frontier.
+ * @param output Output frontier (must differ from the input).
+ * @param context CUDA context.
+ */
+template <typename frontier_t>
+void execute(frontier_t* input,
+             frontier_t* output,
+             gcuda::standard_context_t& context) {
+  using type_t = typename frontier_t::type_t;
+  using offset_t = typename frontier_t::offset_t;
+
+  std::size_t input_size = input->get_number_of_elements();
+  if (input_size == 0) {
+    output->set_number_of_elements(0);
+    return;
+  }
+
+  // The bitmap only needs to cover the largest valid element.
+  auto largest = thrust::transform_reduce(
+      context.execution_policy(), input->begin(), input->end(),
+      [] __device__(type_t const& x) -> std::size_t {
+        return gunrock::util::limits::is_valid(x) ? std::size_t(x) + 1 : 0;
+      },
+      std::size_t(0), thrust::maximum<std::size_t>());
+
+  visited_t<type_t> visited(largest, context.stream());
+  visited.clear(context);
+
+  if (output->get_capacity() < input_size)
+    output->reserve(input_size);
+
+  using namespace gcuda::launch_box;
+  using launch_t =
+      launch_box_t<launch_params_dynamic_grid_t<fallback, dim3_t<256>>>;
+
+  launch_t launch_box;
+  auto kernel = bitmap_kernel<        // kernel
+      launch_box.block_dimensions.x,  // threads per block
+      type_t,                         // frontier value type
+      offset_t,                       // output length type
+      typename visited_t<type_t>::predicate_t  // predicate type
+      >;
+
+  auto output_length = make_pooled_vector<offset_t>(context.stream(), 1, 0);
+  launch_box.calculate_grid_dimensions_strided(input_size);
+  launch_box.launch(context, kernel, input->data(), output->data(), input_size,
+                    visited.get_predicate(), output_length.data().get());
+  context.synchronize();
+
+  thrust::host_vector<offset_t> size_of_output = output_length;
+  output->set_number_of_elements(size_of_output[0]);
+}
+
+}  // namespace bitmap
+}  // namespace uniquify
+}  // namespace operators
+}  // namespace gunrock
@@ -0,0 +1,142 @@
+/**
+ * @file cull.hxx
+ * @brief Best-effort, sort-free uniquify using a per-block hash table in shared
+ * memory (in the spirit of the warp culling of Merrill et al., "Scalable GPU
+ * Graph Traversal", PPoPP'12).
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/cuda/cuda.hxx>
+
+#include <gunrock/framework/operators/configs.hxx>
+
+#include <cub/block/block_scan.cuh>
+
+namespace gunrock {
+namespace operators {
+namespace uniquify {
+namespace cull {
+
+/**
+ * @brief Culls duplicates that hash to the same slot of the block's table, and
+ * removes invalids.
+ *
+ * @par Overview
+ * Every thread writes its element into the table slot `element % HASH_SIZE`
+ * and reads it back. The threads that read back their own element race to tag
+ * the slot with their thread id, and all but the winner are duplicates. An
+ * element is only culled if another thread of the same block holds the same
+ * element, so no element is ever lost, but duplicates across blocks or evicted
+ * from the table survive.
+ */
+template <unsigned int THREADS_PER_BLOCK,
+          unsigned int HASH_SIZE,
+          typename type_t,
+          typename offset_counter_t>
+__global__ void __launch_bounds__(THREADS_PER_BLOCK, 2)
+    cull_kernel(type_t const* input,
+                type_t* output,
+                std::size_t input_size,
+                offset_counter_t* output_length) {
+  using block_scan_t = cub::BlockScan<int, THREADS_PER_BLOCK>;
+  __shared__ typename block_scan_t::TempStorage scan;
+  __shared__ offset_counter_t offset[1];
+  __shared__ type_t table[HASH_SIZE];
+  __shared__ unsigned int tags[HASH_SIZE];
+
+  auto idx = gcuda::thread::global::id::x();
+  auto local_idx = gcuda::thread::local::id::x();
+
+  type_t x = gunrock::numeric_limits<type_t>::invalid();
+  if (idx < input_size)
+    x = input[idx];
+
+  bool valid = gunrock::util::limits::is_valid(x);
+  auto slot = valid ? (std::size_t(x) % HASH_SIZE) : 0;
+
+  /// 1. Hash the element into the table.
+  if (valid)
+    table[slot] = x;
+  __syncthreads();
+
+  /// 2. The owners of a slot race to tag it.
+  bool owner = valid && (table[slot] == x);
+  if (owner)
+    tags[slot] = local_idx;
+  __syncthreads();
+
+  int keep = (valid && (!owner || (tags[slot] == local_idx))) ? 1 : 0;
+
+  /// 3. Compact the survivors into the output, one global atomic per block.
+  int rank, aggregate;
+  block_scan_t(scan).ExclusiveSum(keep, rank, aggregate);
+
+  if ((local_idx == 0) && (aggregate > 0))
+    offset[0] =
+        math::atomic::add(&output_length[0], (offset_counter_t)aggregate);
+  __syncthreads();
+
+  if (keep)
+    output[offset[0] + rank] = x;
+}
+
+/**
+ * @brief Copies the valid elements of the input to the output frontier in
+ * O(input) without sorting, culling most duplicates that are close to each
+ * other in the input (for example, neighbors written by the same block of an
+ * advance). The output is unordered and may contain duplicates, @see
+ * uniquify::bitmap for an exact alternative.
+ *
+ * @param input Input frontier.
+ * @param output Output frontier (must differ from the input).
+ * @param context CUDA context.
+ */
+template <typename frontier_t>
+void execute(frontier_t* input,
+             frontier_t* output,
+             gcuda::standard_context_t& context) {
+  using type_t = typename frontier_t::type_t;
+  using offset_t = typename frontier_t::offset_t;
+
+  std::size_t input_size = input->get_number_of_elements();
+  if (input_size == 0) {
+    output->set_number_of_elements(0);
+    return;
+  }
+
+  if (output->get_capacity() < input_size)
+    output->reserve(input_size);
+
+  using namespace gcuda::launch_box;
+  using launch_t =
+      launch_box_t<launch_params_dynamic_grid_t<fallback, dim3_t<256>>>;
+
+  launch_t launch_box;
+  auto kernel = cull_kernel<          // kernel
+      launch_box.block_dimensions.x,  // threads per block
+      1024,                           // hash table size
+      type_t,                         // frontier value type
+      offset_t                        // output length type
+      >;
+
+  auto output_length = make_pooled_vector<offset_t>(context.stream(), 1, 0);
+  launch_box.calculate_grid_dimensions_strided(input_size);
+  launch_box.launch(context, kernel, input->data(), output->data(), input_size,
+                    output_length.data().get());
+  context.synchronize();
+
+  thrust::host_vector<offset_t> size_of_output = output_length;
+  output->set_number_of_elements(size_of_output[0]);
+}
+
+}  // namespace cull
+}  // namespace uniquify
+}  // namespace operators
+}  // namespace gunrock
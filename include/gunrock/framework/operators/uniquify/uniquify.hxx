@@ -2,11 +2,14 @@
 
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/benchmark.hxx>
 #include <gunrock/util/type_limits.hxx>
 #include <gunrock/util/type_traits.hxx>
 
 #include <gunrock/framework/operators/uniquify/unique.hxx>
 #include <gunrock/framework/operators/uniquify/unique_copy.hxx>
+#include <gunrock/framework/operators/uniquify/bitmap.hxx>
+#include <gunrock/framework/operators/uniquify/cull.hxx>
 
 namespace gunrock {
 namespace operators {
@@ -18,6 +21,7 @@ void execute(frontier_t* input,
              gcuda::multi_context_t& context,
              bool best_effort_uniquification = false,
              const float uniquification_percent = 100) {
+  benchmark::range_t range("uniquify");
   if (context.size() == 1) {
     auto single_context = context.get_context(0);
 
@@ -29,6 +33,11 @@ void execute(frontier_t* input,
       if (!best_effort_uniquification && (uniquification_percent == 100))
         input->sort(sort::order_t::ascending, single_context->stream());
       unique_copy::execute(input, output, *single_context);
+    } else if (type == uniquify_algorithm_t::bitmap) {
+      // Exact without sorting, the uniquification options do not apply.
+      bitmap::execute(input, output, *single_context);
+    } else if (type == uniquify_algorithm_t::cull) {
+      cull::execute(input, output, *single_context);
     } else {
       error::throw_if_exception(cudaErrorUnknown, "Unqiue type not supported.");
     }
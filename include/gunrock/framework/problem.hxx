@@ -27,6 +27,7 @@ namespace gunrock {
  */
 template <typename graph_t>
 struct problem_t {
+  using graph_type = graph_t;
   using vertex_t = typename graph_t::vertex_type;
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
@@ -0,0 +1,317 @@
+/**
+ * @file streaming.hxx
+ * @brief Out-of-core execution of graphs in managed (unified) memory, whose
+ * edges are paged onto the device in chunks, following the active frontier.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include <gunrock/cuda/cuda.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/memory.hxx>
+#include <gunrock/graph/csr.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+#include <thrust/device_vector.h>
+
+namespace gunrock {
+namespace streaming {
+
+/**
+ * @brief Flags the edge chunks holding the neighbor lists of the vertices of a
+ * (vector) frontier, invalid vertices are skipped.
+ */
+template <typename vertex_t, typename edge_t>
+__global__ void mark_chunks(vertex_t const* vertices,
+                            std::size_t size,
+                            edge_t const* offsets,
+                            edge_t edges_per_chunk,
+                            int* touched) {
+  std::size_t stride = std::size_t(gridDim.x) * blockDim.x;
+  for (std::size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < size;
+       i += stride) {
+    vertex_t v = vertices[i];
+    if (!gunrock::util::limits::is_valid(v))
+      continue;
+    edge_t begin = offsets[v];
+    edge_t end = offsets[v + 1];
+    if (begin == end)
+      continue;
+    for (edge_t c = begin / edges_per_chunk; c <= (end - 1) / edges_per_chunk;
+         ++c)
+      touched[c] = 1;
+  }
+}
+
+/**
+ * @brief Pages the edges (column indices and values) of a managed CSR graph
+ * onto the device in fixed-size chunks, following the frontier.
+ *
+ * @par Overview
+ * The edge arrays are advised to live on the host and to be mapped by the
+ * device (`cudaMemAdviseSetPreferredLocation` the CPU and
+ * `cudaMemAdviseSetAccessedBy` the device), such that edges which are not
+ * resident are read over the interconnect instead of faulting and thrashing;
+ * this is what whole-graph iterations (for example, PageRank) run on. The row
+ * offsets (|V| + 1 elements) are read for every frontier vertex and are made
+ * resident once (`cudaMemAdviseSetReadMostly`).
+ *
+ * Before every iteration, `prefetch()` flags the chunks holding the neighbor
+ * lists of the input frontier and migrates the ones that are not resident with
+ * `cudaMemPrefetchAsync()` on its own copy stream (adjacent chunks are
+ * coalesced into one request). The iteration is **not** ordered after the
+ * copies: it starts on the chunks already resident while the others are in
+ * flight. When the resident chunks would exceed the budget, the least
+ * recently used ones are migrated back to the host first.
+ *
+ * @tparam graph_t graph type, with a managed CSR view.
+ */
+template <typename graph_t>
+struct prefetcher_t {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using csr_view_t = graph::
+      graph_csr_t<memory::memory_space_t::managed, vertex_t, edge_t, weight_t>;
+
+  /*!
+   * True if the graph's edges can be streamed (a managed CSR view).
+   */
+  static constexpr bool is_supported = std::is_base_of_v<csr_view_t, graph_t>;
+
+  prefetcher_t() = default;
+  prefetcher_t(const prefetcher_t& rhs) = delete;
+  prefetcher_t& operator=(const prefetcher_t& rhs) = delete;
+
+  ~prefetcher_t() { release(); }
+
+  /**
+   * @brief True once `init()` has been called on a non-empty graph.
+   */
+  bool is_enabled() const { return number_of_chunks > 0; }
+
+  /**
+   * @brief Advise the graph's memory and size the chunks.
+   *
+   * @param G graph, with a managed CSR view.
+   * @param _device device the graph is streamed to.
+   * @param chunk_bytes bytes of edge data (indices and values) per chunk.
+   * @param budget_bytes bytes of edge data kept resident on the device, 0 for
+   * three quarters of the device's free memory.
+   */
+  void init(graph_t& G,
+            gcuda::device_id_t _device,
+            std::size_t chunk_bytes,
+            std::size_t budget_bytes = 0) {
+    static_assert(is_supported,
+                  "Streaming requires a graph with a managed CSR view.");
+    release();
+
+    csr_view_t const& view = G;
+    device = _device;
+    offsets = view.get_row_offsets();
+    indices = view.get_column_indices();
+    values = view.get_nonzero_values();
+    number_of_edges = view.get_number_of_edges();
+    std::size_t number_of_vertices = view.get_number_of_vertices();
+
+    if (number_of_edges == 0)
+      return;
+
+    std::size_t edge_bytes = sizeof(vertex_t) + (values ? sizeof(weight_t) : 0);
+    edges_per_chunk = std::max<edge_t>(1, chunk_bytes / edge_bytes);
+    number_of_chunks =
+        (number_of_edges + edges_per_chunk - 1) / edges_per_chunk;
+
+    if (budget_bytes == 0) {
+      std::size_t free_bytes, total_bytes;
+      error::throw_if_exception(cudaMemGetInfo(&free_bytes, &total_bytes));
+      budget_bytes = (free_bytes / 4) * 3;
+    }
+    budget = std::max<std::size_t>(
+        1, budget_bytes / (std::size_t(edges_per_chunk) * edge_bytes));
+
+    advise(indices, number_of_edges);
+    if (values)
+      advise(values, number_of_edges);
+
+    auto offsets_bytes = (number_of_vertices + 1) * sizeof(edge_t);
+    error::throw_if_exception(cudaMemAdvise(
+        offsets, offsets_bytes, cudaMemAdviseSetReadMostly, device));
+    error::throw_if_exception(
+        cudaMemPrefetchAsync(offsets, offsets_bytes, device, 0));
+
+    error::throw_if_exception(
+        cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+    touched.resize(number_of_chunks);
+    h_touched = memory::allocate<int>(number_of_chunks * sizeof(int),
+                                      memory::memory_space_t::host);
+    last_used.assign(number_of_chunks, 0);
+    resident = 0;
+    clock = 0;
+  }
+
+  /**
+   * @brief Page in the chunks of the frontier's neighbor lists, the copies
+   * overlap the work submitted to the (compute) stream afterwards.
+   *
+   * @tparam frontier_t vector frontier of vertices.
+   * @param f input frontier of the next iteration.
+   * @param compute stream the iteration runs on (synchronized here, to read
+   * which chunks are touched).
+   */
+  template <typename frontier_t>
+  void prefetch(frontier_t* f, gcuda::stream_t compute) {
+    std::size_t size = f->get_number_of_elements();
+    if (!is_enabled() || size == 0)
+      return;
+    ++clock;
+
+    int* d_touched = touched.data().get();
+    error::throw_if_exception(cudaMemsetAsync(
+        d_touched, 0, number_of_chunks * sizeof(int), compute));
+    std::size_t blocks = std::min<std::size_t>((size + 255) / 256, 4096);
+    mark_chunks<<<blocks, 256, 0, compute>>>(f->data(), size, offsets,
+                                             edges_per_chunk, d_touched);
+    error::throw_if_exception(
+        cudaMemcpyAsync(h_touched, d_touched, number_of_chunks * sizeof(int),
+                        cudaMemcpyDeviceToHost, compute));
+    error::throw_if_exception(cudaStreamSynchronize(compute));
+
+    // Touched chunks that are resident stay, the others are wanted.
+    std::vector<std::size_t> missing;
+    for (std::size_t c = 0; c < number_of_chunks; ++c) {
+      if (!h_touched[c])
+        continue;
+      if (last_used[c])
+        last_used[c] = clock;
+      else
+        missing.push_back(c);
+    }
+
+    // The chunks of the frontier already resident cannot be evicted, only as
+    // many chunks as then fit the budget are paged in.
+    std::size_t wanted = std::min(missing.size(), budget);
+    if (resident + wanted > budget)
+      evict(resident + wanted - budget);
+    wanted = std::min(wanted, budget - std::min(resident, budget));
+
+    // Chunks past the budget are left to be read remotely.
+    for (std::size_t i = 0; i < wanted;) {
+      std::size_t first = missing[i];
+      std::size_t last = first;
+      do {
+        last_used[last++] = clock;
+        ++i;
+      } while (i < wanted && missing[i] == last);
+      move(first, last, device);
+      resident += last - first;
+    }
+  }
+
+  /**
+   * @brief Number of chunks currently resident on the device.
+   */
+  std::size_t get_number_of_resident_chunks() const { return resident; }
+
+  /**
+   * @brief Number of chunks the edges are partitioned into.
+   */
+  std::size_t get_number_of_chunks() const { return number_of_chunks; }
+
+  /**
+   * @brief Wait for the outstanding copies.
+   */
+  void synchronize() {
+    if (stream)
+      error::throw_if_exception(cudaStreamSynchronize(stream));
+  }
+
+  void release() {
+    if (stream) {
+      cudaStreamSynchronize(stream);
+      cudaStreamDestroy(stream);
+      stream = 0;
+    }
+    memory::free(h_touched, memory::memory_space_t::host);
+    h_touched = nullptr;
+    number_of_chunks = 0;
+  }
+
+ private:
+  template <typename type_t>
+  void advise(type_t* pointer, std::size_t count) {
+    auto bytes = count * sizeof(type_t);
+    error::throw_if_exception(cudaMemAdvise(
+        pointer, bytes, cudaMemAdviseSetPreferredLocation, cudaCpuDeviceId));
+    error::throw_if_exception(
+        cudaMemAdvise(pointer, bytes, cudaMemAdviseSetAccessedBy, device));
+  }
+
+  /// Migrate the edges of chunks [first, last) to `location`.
+  void move(std::size_t first, std::size_t last, int location) {
+    std::size_t begin = first * edges_per_chunk;
+    std::size_t end =
+        std::min<std::size_t>(last * edges_per_chunk, number_of_edges);
+    error::throw_if_exception(
+        cudaMemPrefetchAsync(indices + begin, (end - begin) * sizeof(vertex_t),
+                             location, stream));
+    if (values)
+      error::throw_if_exception(
+          cudaMemPrefetchAsync(values + begin, (end - begin) * sizeof(weight_t),
+                               location, stream));
+  }
+
+  /// Migrate up to `count` resident chunks (least recently used first, never
+  /// the ones of the current frontier) back to the host, returns the number
+  /// of chunks evicted.
+  std::size_t evict(std::size_t count) {
+    std::vector<std::size_t> candidates;
+    for (std::size_t c = 0; c < number_of_chunks; ++c)
+      if (last_used[c] && last_used[c] != clock)
+        candidates.push_back(c);
+
+    count = std::min(count, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + count,
+                      candidates.end(), [&](std::size_t a, std::size_t b) {
+                        return last_used[a] < last_used[b];
+                      });
+    for (std::size_t i = 0; i < count; ++i) {
+      move(candidates[i], candidates[i] + 1, cudaCpuDeviceId);
+      last_used[candidates[i]] = 0;
+    }
+    resident -= count;
+    return count;
+  }
+
+  gcuda::device_id_t device = 0;
+  gcuda::stream_t stream = 0;
+
+  edge_t const* offsets = nullptr;
+  vertex_t* indices = nullptr;
+  weight_t* values = nullptr;
+  std::size_t number_of_edges = 0;
+
+  edge_t edges_per_chunk = 1;
+  std::size_t number_of_chunks = 0;
+  std::size_t budget = 0;  ///< Resident chunks.
+
+  thrust::device_vector<int> touched;
+  int* h_touched = nullptr;
+
+  /// Iteration a resident chunk was last touched in, 0 if not resident.
+  std::vector<std::size_t> last_used;
+  std::size_t resident = 0;
+  std::size_t clock = 0;
+};
+
+}  // namespace streaming
+}  // namespace gunrock
@@ -35,6 +35,49 @@ auto build(graph::graph_properties_t properties,
   return detail::builder<space>(properties, csr);
 }
 
+/**
+ * @brief Builds a graph using a compressed CSR object (bit-packed column
+ * indices), @see graph::graph_compressed_csr_t.
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties.
+ * @param csr compressed_csr_t format with graph's data.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(graph::graph_properties_t properties,
+           format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& csr) {
+  return detail::builder<space>(properties, csr);
+}
+
+/**
+ * @brief Builds a graph using a dynamic (gapped) CSR object, @see
+ * graph::graph_dynamic_csr_t. The graph must be rebuilt after every update of
+ * the format.
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties.
+ * @param csr dynamic_csr_t format with graph's data.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(graph::graph_properties_t properties,
+           format::dynamic_csr_t<space, vertex_t, edge_t, weight_t>& csr) {
+  return detail::builder<space>(properties, csr);
+}
+
 /**
  * @brief Builds a graph using COO object.
  *
@@ -0,0 +1,241 @@
+/**
+ * @file compressed_csr.hxx
+ * @brief Graph view over a compressed CSR (bit-packed column indices), @see
+ * format::compressed_csr_t. The column indices are decoded on access.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/util/load_store.hxx>
+#include <gunrock/graph/vertex_pair.hxx>
+#include <gunrock/algorithms/search/binary_search.hxx>
+#include <gunrock/formats/formats.hxx>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/swap.h>
+
+namespace gunrock {
+namespace graph {
+
+using namespace memory;
+
+/**
+ * @brief Decodes the column index of an edge, indexable like the column indices
+ * array of a CSR (`decoder[e]`).
+ */
+template <typename vertex_t, typename edge_t>
+struct packed_indices_t {
+  using word_t = std::uint32_t;
+  static constexpr std::size_t block_size = 32;
+
+  vertex_t const* bases;
+  edge_t const* words;
+  word_t const* packed;
+
+  __host__ __device__ __forceinline__ vertex_t
+  operator[](edge_t const& e) const {
+    auto b = e / block_size;
+    auto first = thread::load(&words[b]);
+    auto w = thread::load(&words[b + 1]) - first;
+    auto base = thread::load(&bases[b]);
+    if (w == 0)
+      return base;
+
+    std::size_t bit = (e % block_size) * w;
+    std::size_t word = first + bit / 32;
+    std::size_t shift = bit % 32;
+
+    std::uint64_t x = thread::load(&packed[word]);
+    if (shift + w > 32)
+      x |= std::uint64_t(thread::load(&packed[word + 1])) << 32;
+
+    std::uint64_t mask = (std::uint64_t(1) << w) - 1;
+    return base + vertex_t((x >> shift) & mask);
+  }
+};
+
+/**
+ * @brief Compressed Sparse Row graph view with bit-packed column indices (@see
+ * format::compressed_csr_t), a drop-in replacement of `graph_csr_t` for
+ * traversals: `get_destination_vertex()` decodes the neighbor in place, while
+ * row offsets and edge weights are read as in `graph_csr_t`. The neighbors of a
+ * vertex are sorted.
+ */
+template <memory_space_t space,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+class graph_compressed_csr_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  using vertex_pair_type = vertex_pair_t<vertex_type>;
+  using indices_type = packed_indices_t<vertex_type, edge_type>;
+
+ public:
+  __host__ __device__ graph_compressed_csr_t()
+      : offsets(nullptr), indices{nullptr, nullptr, nullptr}, values(nullptr) {}
+
+  __host__ __device__ __forceinline__ edge_type
+  get_number_of_neighbors(vertex_type const& v) const {
+    return (get_starting_edge(v + 1) - get_starting_edge(v));
+  }
+
+  __host__ __device__ __forceinline__ vertex_type
+  get_source_vertex(edge_type const& e) const {
+    auto keys = get_row_offsets();
+    auto key = e;
+
+    // returns `it` such that everything to the left is <= e.
+    // This will be one element to the right of the node id.
+    auto it = thrust::lower_bound(
+        thrust::seq, thrust::counting_iterator<edge_t>(0),
+        thrust::counting_iterator<edge_t>(this->number_of_vertices), key,
+        [keys] __host__ __device__(const edge_t& pivot, const edge_t& key) {
+          return keys[pivot] <= key;
+        });
+
+    return (*it) - 1;
+  }
+
+  __host__ __device__ __forceinline__ vertex_type
+  get_destination_vertex(edge_type const& e) const {
+    return indices[e];
+  }
+
+  __host__ __device__ __forceinline__ edge_type
+  get_starting_edge(vertex_type const& v) const {
+    return thread::load(&offsets[v]);
+  }
+
+  __host__ __device__ __forceinline__ vertex_pair_type
+  get_source_and_destination_vertices(const edge_type& e) const {
+    return {get_source_vertex(e), get_destination_vertex(e)};
+  }
+
+  // Same (1-based) convention as `graph_csr_t::get_edge()`.
+  __host__ __device__ __forceinline__ edge_type
+  get_edge(const vertex_type& source, const vertex_type& destination) const {
+    return (edge_type)search::binary::execute(
+        indices, destination, get_starting_edge(source),
+        get_starting_edge(source + 1) - 1);
+  }
+
+  /**
+   * @brief Count the number of vertices belonging to the set intersection
+   * between the source and destination vertices adjacency lists. Executes a
+   * function on each intersection. This function does not handle self-loops.
+   *
+   * @param source Index of the source vertex
+   * @param destination Index of the destination
+   * @param on_intersection Lambda function executed at each intersection
+   * @return Number of shared vertices between source and destination
+   */
+  template <typename operator_type>
+  __host__ __device__ __forceinline__ vertex_type
+  get_intersection_count(const vertex_type& source,
+                         const vertex_type& destination,
+                         operator_type on_intersection) const {
+    vertex_type intersection_count = 0;
+
+    auto e = get_starting_edge(source);
+    auto e_end = get_starting_edge(source + 1);
+    auto f = get_starting_edge(destination);
+    auto f_end = get_starting_edge(destination + 1);
+
+    while (e < e_end && f < f_end) {
+      auto u = indices[e];
+      auto w = indices[f];
+      if (u == w) {
+        intersection_count++;
+        e++;
+        f++;
+        on_intersection(u);
+      } else if (u > w) {
+        f++;
+      } else {
+        e++;
+      }
+    }
+
+    return intersection_count;
+  }
+
+  __host__ __device__ __forceinline__ weight_type
+  get_edge_weight(edge_type const& e) const {
+    return thread::load(&values[e]);
+  }
+
+  // Representation specific functions
+  // ...
+  __host__ __device__ __forceinline__ auto get_row_offsets() const {
+    return offsets;
+  }
+
+  /**
+   * @brief Indexable decoder of the column indices (not a pointer).
+   */
+  __host__ __device__ __forceinline__ auto get_column_indices() const {
+    return indices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_nonzero_values() const {
+    return values;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_rows() const {
+    return number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_columns() const {
+    return number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_nonzeros() const {
+    return number_of_edges;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_vertices() const {
+    return number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_edges() const {
+    return number_of_edges;
+  }
+
+ protected:
+  __host__ void set(
+      gunrock::format::compressed_csr_t<space, vertex_t, edge_t, weight_t>&
+          csr) {
+    this->number_of_vertices = csr.number_of_rows;
+    this->number_of_edges = csr.number_of_nonzeros;
+    // Set raw pointers
+    offsets = raw_pointer_cast(csr.row_offsets.data());
+    indices.bases = raw_pointer_cast(csr.block_bases.data());
+    indices.words = raw_pointer_cast(csr.block_words.data());
+    indices.packed = raw_pointer_cast(csr.packed_deltas.data());
+    values = raw_pointer_cast(csr.nonzero_values.data());
+  }
+
+ private:
+  // Underlying data storage
+  vertex_type number_of_vertices;
+  edge_type number_of_edges;
+
+  edge_type* offsets;
+  indices_type indices;
+  weight_type* values;
+
+};  // class graph_compressed_csr_t
+
+}  // namespace graph
+}  // namespace gunrock
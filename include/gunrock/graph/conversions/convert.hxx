@@ -24,7 +24,7 @@ void offsets_to_indices(const offset_t* offsets,
                         index_t* indices,
                         index_t const& size_of_indices) {
   using execution_policy_t =
-      std::conditional_t<space == memory_space_t::device,
+      std::conditional_t<space != memory_space_t::host,
                          decltype(thrust::device), decltype(thrust::host)>;
   execution_policy_t exec;
   // convert compressed offsets into uncompressed indices
@@ -54,7 +54,7 @@ void indices_to_offsets(const index_t* indices,
                         offset_t* offsets,
                         offset_t const& size_of_offsets) {
   using execution_policy_t =
-      std::conditional_t<space == memory_space_t::device,
+      std::conditional_t<space != memory_space_t::host,
                          decltype(thrust::device), decltype(thrust::host)>;
   execution_policy_t exec;
   // convert uncompressed indices into compressed offsets
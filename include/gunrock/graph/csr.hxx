@@ -225,6 +225,19 @@ class graph_csr_t {
     values = raw_pointer_cast(csr.nonzero_values.data());
   }
 
+  /**
+   * @brief Set the view from any CSR-like format (for example,
+   * format::striped_csr_t) exposing the sizes and `data()` of the arrays.
+   */
+  template <typename format_t>
+  __host__ void set(format_t& csr) {
+    this->number_of_vertices = csr.number_of_rows;
+    this->number_of_edges = csr.number_of_nonzeros;
+    offsets = raw_pointer_cast(csr.row_offsets.data());
+    indices = raw_pointer_cast(csr.column_indices.data());
+    values = raw_pointer_cast(csr.nonzero_values.data());
+  }
+
  private:
   // Underlying data storage
   vertex_type number_of_vertices;
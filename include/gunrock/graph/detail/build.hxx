@@ -32,6 +32,42 @@ auto builder(graph::graph_properties_t properties,
   return G;
 }
 
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto builder(
+    graph::graph_properties_t properties,
+    format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& csr) {
+  // Enable compressed CSR.
+  using csr_v_t =
+      graph::graph_compressed_csr_t<space, vertex_t, edge_t, weight_t>;
+  using csr_f_t = format::compressed_csr_t<space, vertex_t, edge_t, weight_t>;
+  using graph_type = graph::graph_t<space, vertex_t, edge_t, weight_t, csr_v_t>;
+
+  graph_type G(properties);
+  G.template set<csr_v_t, csr_f_t>(csr);
+
+  return G;
+}
+
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto builder(graph::graph_properties_t properties,
+             format::dynamic_csr_t<space, vertex_t, edge_t, weight_t>& csr) {
+  // Enable dynamic CSR.
+  using csr_v_t = graph::graph_dynamic_csr_t<space, vertex_t, edge_t, weight_t>;
+  using csr_f_t = format::dynamic_csr_t<space, vertex_t, edge_t, weight_t>;
+  using graph_type = graph::graph_t<space, vertex_t, edge_t, weight_t, csr_v_t>;
+
+  graph_type G(properties);
+  G.template set<csr_v_t, csr_f_t>(csr);
+
+  return G;
+}
+
 template <memory_space_t space,
           typename edge_t,
           typename vertex_t,
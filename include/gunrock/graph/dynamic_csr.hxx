@@ -0,0 +1,167 @@
+/**
+ * @file dynamic_csr.hxx
+ * @brief Graph view over a gapped (dynamic) CSR, @see format::dynamic_csr_t.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/memory.hxx>
+#include <gunrock/util/load_store.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/graph/vertex_pair.hxx>
+#include <gunrock/formats/formats.hxx>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+
+namespace gunrock {
+namespace graph {
+
+using namespace memory;
+
+/**
+ * @brief Compressed Sparse Row graph view with free slots after every row (@see
+ * format::dynamic_csr_t), a drop-in replacement of `graph_csr_t` for
+ * traversals: the neighbors of `v` are the edges `[get_starting_edge(v),
+ * get_starting_edge(v) + get_number_of_neighbors(v))`.
+ *
+ * @par Overview
+ * Edge ids are slots, such that `get_number_of_edges()` is the number of slots
+ * (edges and free slots, arrays indexed by edge ids are sized by it) and
+ * `get_number_of_valid_edges()` the number of edges. The destination of a
+ * free slot is `invalid()`, operators that iterate over all edge ids (rather
+ * than over neighbor lists) must skip it. Neighbor lists are unsorted. The
+ * view holds pointers to the format's arrays, rebuild it after every update.
+ */
+template <memory_space_t space,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+class graph_dynamic_csr_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  using vertex_pair_type = vertex_pair_t<vertex_type>;
+
+ public:
+  __host__ __device__ graph_dynamic_csr_t()
+      : offsets(nullptr), sizes(nullptr), indices(nullptr), values(nullptr) {}
+
+  __host__ __device__ __forceinline__ edge_type
+  get_number_of_neighbors(vertex_type const& v) const {
+    return thread::load(&sizes[v]);
+  }
+
+  // Slots of a row are contiguous, the row of a slot is found as in CSR.
+  __host__ __device__ __forceinline__ vertex_type
+  get_source_vertex(edge_type const& e) const {
+    auto keys = offsets;
+    auto key = e;
+
+    auto it = thrust::lower_bound(
+        thrust::seq, thrust::counting_iterator<edge_t>(0),
+        thrust::counting_iterator<edge_t>(this->number_of_vertices), key,
+        [keys] __host__ __device__(const edge_t& pivot, const edge_t& key) {
+          return keys[pivot] <= key;
+        });
+
+    return (*it) - 1;
+  }
+
+  __host__ __device__ __forceinline__ vertex_type
+  get_destination_vertex(edge_type const& e) const {
+    return thread::load(&indices[e]);
+  }
+
+  __host__ __device__ __forceinline__ edge_type
+  get_starting_edge(vertex_type const& v) const {
+    return thread::load(&offsets[v]);
+  }
+
+  __host__ __device__ __forceinline__ vertex_pair_type
+  get_source_and_destination_vertices(const edge_type& e) const {
+    return {get_source_vertex(e), get_destination_vertex(e)};
+  }
+
+  /**
+   * @brief Edge (slot) from source to destination (linear search), or
+   * `invalid()` if there is no such edge.
+   */
+  __host__ __device__ __forceinline__ edge_type
+  get_edge(const vertex_type& source, const vertex_type& destination) const {
+    auto first = get_starting_edge(source);
+    auto last = first + get_number_of_neighbors(source);
+    for (auto e = first; e < last; ++e)
+      if (get_destination_vertex(e) == destination)
+        return e;
+    return gunrock::numeric_limits<edge_type>::invalid();
+  }
+
+  __host__ __device__ __forceinline__ weight_type
+  get_edge_weight(edge_type const& e) const {
+    return thread::load(&values[e]);
+  }
+
+  // Representation specific functions
+  // ...
+  __host__ __device__ __forceinline__ auto get_row_offsets() const {
+    return offsets;
+  }
+
+  __host__ __device__ __forceinline__ auto get_row_sizes() const {
+    return sizes;
+  }
+
+  __host__ __device__ __forceinline__ auto get_column_indices() const {
+    return indices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_nonzero_values() const {
+    return values;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_vertices() const {
+    return number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_edges() const {
+    return number_of_slots;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_valid_edges() const {
+    return number_of_edges;
+  }
+
+ protected:
+  __host__ void set(
+      gunrock::format::dynamic_csr_t<space, vertex_t, edge_t, weight_t>& csr) {
+    this->number_of_vertices = csr.number_of_rows;
+    this->number_of_edges = csr.number_of_nonzeros;
+    this->number_of_slots = csr.get_number_of_slots();
+    // Set raw pointers
+    offsets = raw_pointer_cast(csr.row_offsets.data());
+    sizes = raw_pointer_cast(csr.row_sizes.data());
+    indices = raw_pointer_cast(csr.column_indices.data());
+    values = raw_pointer_cast(csr.nonzero_values.data());
+  }
+
+ private:
+  // Underlying data storage
+  vertex_type number_of_vertices;
+  edge_type number_of_edges;
+  edge_type number_of_slots;
+
+  edge_type* offsets;
+  edge_type* sizes;
+  vertex_type* indices;
+  weight_type* values;
+
+};  // class graph_dynamic_csr_t
+
+}  // namespace graph
+}  // namespace gunrock
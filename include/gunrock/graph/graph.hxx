@@ -17,6 +17,8 @@
 #include <gunrock/graph/coo.hxx>
 #include <gunrock/graph/csc.hxx>
 #include <gunrock/graph/csr.hxx>
+#include <gunrock/graph/compressed_csr.hxx>
+#include <gunrock/graph/dynamic_csr.hxx>
 #include <gunrock/formats/formats.hxx>
 
 namespace gunrock {
@@ -87,6 +89,10 @@ class graph_t : public graph_view_t... {
       graph_csc_t<space, vertex_type, edge_type, weight_type>;
   using graph_coo_view_t =
       graph_coo_t<space, vertex_type, edge_type, weight_type>;
+  using graph_compressed_csr_view_t =
+      graph_compressed_csr_t<space, vertex_type, edge_type, weight_type>;
+  using graph_dynamic_csr_view_t =
+      graph_dynamic_csr_t<space, vertex_type, edge_type, weight_type>;
 
   /**
    * @brief Default constructor for the graph.
@@ -338,6 +344,17 @@ class graph_t : public graph_view_t... {
 
 };  // class graph_t
 
+/**
+ * @brief Compile-time equivalent of `graph_t::contains_representation()`, true
+ * if the graph type inherits the given graph representation view.
+ *
+ * @tparam graph_type graph type.
+ * @tparam input_view_t input graph view to check.
+ */
+template <typename graph_type, typename input_view_t>
+constexpr bool has_representation_v =
+    std::is_base_of_v<input_view_t, graph_type>;
+
 /**
  * @brief Get the average degree of a graph.
  *
@@ -0,0 +1,525 @@
+/**
+ * @file reorder.hxx
+ * @brief Vertex reordering (degree sort, reverse Cuthill-McKee and community
+ * order) of device graph formats, to improve the locality of the gathers of
+ * per-vertex data along the edges.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/memory.hxx>
+#include <gunrock/util/math.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/formats/formats.hxx>
+
+#include <thrust/binary_search.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/find.h>
+#include <thrust/gather.h>
+#include <thrust/reduce.h>
+#include <thrust/reverse.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+
+namespace gunrock {
+namespace graph {
+namespace reorder {
+
+using namespace memory;
+
+/**
+ * @brief Vertex ordering, @see permute().
+ *
+ * - `degree` sorts the vertices by decreasing degree, packing the hubs (whose
+ *   data is gathered the most) together.
+ * - `rcm` is reverse Cuthill-McKee, a breadth-first order that reduces the
+ *   bandwidth of the adjacency matrix (neighbors get close ids).
+ * - `community` groups the vertices by label-propagation communities (by
+ *   decreasing degree within a community), in the spirit of Rabbit order.
+ */
+enum order_t { degree, rcm, community };
+
+/**
+ * @brief Permutation of the vertices, vertex `v` of the original graph is
+ * vertex `old_to_new[v]` of the reordered graph.
+ */
+template <typename vertex_t>
+struct permutation_t {
+  thrust::device_vector<vertex_t> old_to_new;
+  thrust::device_vector<vertex_t> new_to_old;
+
+  permutation_t(std::size_t size = 0) : old_to_new(size), new_to_old(size) {}
+
+  std::size_t size() const { return old_to_new.size(); }
+
+  /**
+   * @brief Set `old_to_new` as the inverse of `new_to_old`.
+   */
+  void invert(gcuda::stream_t stream = 0) {
+    old_to_new.resize(new_to_old.size());
+    thrust::scatter(thrust::cuda::par.on(stream),
+                    thrust::counting_iterator<vertex_t>(0),
+                    thrust::counting_iterator<vertex_t>(new_to_old.size()),
+                    new_to_old.begin(), old_to_new.begin());
+  }
+
+  /**
+   * @brief Id in the reordered graph of an original vertex (e.g. a source).
+   */
+  vertex_t to_new(vertex_t const& v) const { return old_to_new[v]; }
+
+  /**
+   * @brief Original id of a vertex of the reordered graph.
+   */
+  vertex_t to_original(vertex_t const& v) const { return new_to_old[v]; }
+
+  /**
+   * @brief Per-vertex data of the reordered graph to the original order,
+   * `original[v] = reordered[old_to_new[v]]` (device arrays of |V|).
+   */
+  template <typename type_t>
+  void to_original(type_t const* reordered,
+                   type_t* original,
+                   gcuda::stream_t stream = 0) const {
+    thrust::gather(thrust::cuda::par.on(stream), old_to_new.begin(),
+                   old_to_new.end(), thrust::device_pointer_cast(reordered),
+                   thrust::device_pointer_cast(original));
+  }
+
+  /**
+   * @brief Per-vertex data of the original graph to the reordered order.
+   */
+  template <typename type_t>
+  void to_reordered(type_t const* original,
+                    type_t* reordered,
+                    gcuda::stream_t stream = 0) const {
+    thrust::gather(thrust::cuda::par.on(stream), new_to_old.begin(),
+                   new_to_old.end(), thrust::device_pointer_cast(original),
+                   thrust::device_pointer_cast(reordered));
+  }
+
+  /**
+   * @brief Map vertex ids stored as data (e.g. predecessors) of the reordered
+   * graph to the original ids, in place. Invalid ids are kept.
+   */
+  void to_original_ids(vertex_t* ids,
+                       std::size_t size,
+                       gcuda::stream_t stream = 0) const {
+    auto map = new_to_old.data().get();
+    auto d_ids = thrust::device_pointer_cast(ids);
+    thrust::transform(thrust::cuda::par.on(stream), d_ids, d_ids + size, d_ids,
+                      [map] __device__(vertex_t const& v) {
+                        return gunrock::util::limits::is_valid(v) ? map[v] : v;
+                      });
+  }
+};
+
+namespace detail {
+
+template <typename vertex_t, typename edge_t>
+thrust::device_vector<edge_t> degrees(edge_t const* offsets,
+                                      vertex_t n_vertices,
+                                      gcuda::stream_t stream) {
+  thrust::device_vector<edge_t> degrees(n_vertices);
+  thrust::transform(thrust::cuda::par.on(stream), offsets + 1,
+                    offsets + n_vertices + 1, offsets, degrees.begin(),
+                    thrust::minus<edge_t>());
+  return degrees;
+}
+
+/**
+ * @brief Renumber the vertices of a compressed (CSR or CSC) matrix, the
+ * segments are reordered and the indices within a segment sorted.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename offsets_t,
+          typename indices_t,
+          typename values_t>
+void permute_compressed(permutation_t<vertex_t> const& permutation,
+                        vertex_t n_vertices,
+                        edge_t n_edges,
+                        offsets_t const& offsets,
+                        indices_t const& indices,
+                        values_t const& values,
+                        offsets_t& new_offsets,
+                        indices_t& new_indices,
+                        values_t& new_values,
+                        gcuda::stream_t stream) {
+  auto policy = thrust::cuda::par.on(stream);
+  auto map = permutation.old_to_new.data().get();
+
+  thrust::device_vector<vertex_t> segments(n_edges);
+  convert::offsets_to_indices<memory_space_t::device>(
+      offsets.data().get(), (edge_t)(n_vertices + 1), segments.data().get(),
+      (vertex_t)n_edges);
+
+  new_indices.resize(n_edges);
+  new_values = values;
+  auto to_new = [map] __device__(vertex_t const& v) { return map[v]; };
+  thrust::transform(policy, segments.begin(), segments.end(), segments.begin(),
+                    to_new);
+  thrust::transform(policy, indices.begin(), indices.end(),
+                    new_indices.begin(), to_new);
+
+  auto keys = thrust::make_zip_iterator(
+      thrust::make_tuple(segments.begin(), new_indices.begin()));
+  thrust::stable_sort_by_key(policy, keys, keys + n_edges, new_values.begin());
+
+  new_offsets.resize(n_vertices + 1);
+  thrust::lower_bound(policy, segments.begin(), segments.end(),
+                      thrust::counting_iterator<vertex_t>(0),
+                      thrust::counting_iterator<vertex_t>(n_vertices + 1),
+                      new_offsets.begin());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Degree sort, vertices by decreasing degree (ties by id).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+permutation_t<vertex_t> degree_order(
+    format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> const&
+        csr,
+    gcuda::stream_t stream = 0) {
+  auto policy = thrust::cuda::par.on(stream);
+  vertex_t n_vertices = csr.number_of_rows;
+
+  permutation_t<vertex_t> permutation(n_vertices);
+  auto degrees =
+      detail::degrees(csr.row_offsets.data().get(), n_vertices, stream);
+  thrust::sequence(policy, permutation.new_to_old.begin(),
+                   permutation.new_to_old.end());
+  thrust::stable_sort_by_key(policy, degrees.begin(), degrees.end(),
+                             permutation.new_to_old.begin(),
+                             thrust::greater<edge_t>());
+  permutation.invert(stream);
+  return permutation;
+}
+
+/**
+ * @brief Reverse Cuthill-McKee. Every connected component is traversed
+ * breadth-first from its unvisited vertex of lowest degree, the vertices of a
+ * level are ordered by their first parent in the previous level and then by
+ * degree (as in the sequential algorithm), and the order is reversed. The
+ * graph is expected to be symmetric (the outgoing edges are followed).
+ *
+ * @par Overview
+ * A level is discovered by one pass over the edges of the previous level
+ * (recording the lowest position of a parent with an atomic min) and ordered
+ * by a sort, a level (and a component) costs one readback.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+permutation_t<vertex_t> rcm_order(
+    format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> const&
+        csr,
+    gcuda::stream_t stream = 0) {
+  auto policy = thrust::cuda::par.on(stream);
+  vertex_t n_vertices = csr.number_of_rows;
+
+  permutation_t<vertex_t> permutation(n_vertices);
+  auto& order = permutation.new_to_old;
+  auto& position = permutation.old_to_new;
+
+  auto degrees =
+      detail::degrees(csr.row_offsets.data().get(), n_vertices, stream);
+  thrust::device_vector<vertex_t> parent(n_vertices);
+  thrust::device_vector<unsigned long long> counter(1);
+
+  // Component roots, by increasing degree.
+  thrust::device_vector<vertex_t> roots(n_vertices);
+  thrust::sequence(policy, roots.begin(), roots.end());
+  {
+    auto keys = degrees;
+    thrust::stable_sort_by_key(policy, keys.begin(), keys.end(),
+                               roots.begin());
+  }
+
+  auto unvisited = gunrock::numeric_limits<vertex_t>::invalid();
+  auto unset = std::numeric_limits<vertex_t>::max();
+  thrust::fill(policy, position.begin(), position.end(), unvisited);
+  thrust::fill(policy, parent.begin(), parent.end(), unset);
+
+  auto offsets = csr.row_offsets.data().get();
+  auto indices = csr.column_indices.data().get();
+  auto d_order = order.data().get();
+  auto d_position = position.data().get();
+  auto d_parent = parent.data().get();
+  auto d_degrees = degrees.data().get();
+  auto d_counter = counter.data().get();
+
+  vertex_t placed = 0;
+  auto cursor = roots.begin();
+  while (placed < n_vertices) {
+    cursor = thrust::find_if(policy, cursor, roots.end(),
+                             [d_position] __device__(vertex_t const& v) {
+                               return !gunrock::util::limits::is_valid(
+                                   d_position[v]);
+                             });
+    vertex_t root = *cursor;
+    order[placed] = root;
+    position[root] = placed;
+
+    vertex_t begin = placed;
+    vertex_t end = placed + 1;
+    while (begin < end) {
+      /// 1. Discover the next level, recording the first parent.
+      counter[0] = 0;
+      thrust::for_each(
+          policy, thrust::counting_iterator<vertex_t>(begin),
+          thrust::counting_iterator<vertex_t>(end),
+          [=] __device__(vertex_t const& i) {
+            vertex_t u = d_order[i];
+            for (edge_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+              vertex_t v = indices[e];
+              if (gunrock::util::limits::is_valid(d_position[v]))
+                continue;
+              if (math::atomic::min(&d_parent[v], i) == unset) {
+                auto slot = math::atomic::add(d_counter, 1ull);
+                d_order[end + slot] = v;
+              }
+            }
+          });
+      unsigned long long discovered = counter[0];
+      vertex_t size = discovered;
+
+      /// 2. Order it by (parent, degree, id) and place it.
+      thrust::sort(policy, order.begin() + end, order.begin() + end + size,
+                   [d_parent, d_degrees] __device__(vertex_t const& a,
+                                                    vertex_t const& b) {
+                     if (d_parent[a] != d_parent[b])
+                       return d_parent[a] < d_parent[b];
+                     if (d_degrees[a] != d_degrees[b])
+                       return d_degrees[a] < d_degrees[b];
+                     return a < b;
+                   });
+      thrust::for_each(policy, thrust::counting_iterator<vertex_t>(end),
+                       thrust::counting_iterator<vertex_t>(end + size),
+                       [d_order, d_position] __device__(vertex_t const& i) {
+                         d_position[d_order[i]] = i;
+                       });
+
+      begin = end;
+      end += size;
+    }
+    placed = end;
+  }
+
+  // Reverse.
+  thrust::reverse(policy, order.begin(), order.end());
+  permutation.invert(stream);
+  return permutation;
+}
+
+/**
+ * @brief Community order, the vertices are grouped by the labels of a few
+ * rounds of label propagation (every vertex takes the label most frequent
+ * among its neighbors and itself, ties to the lowest label; half of the
+ * vertices move per round, avoiding the oscillations of synchronous
+ * propagation), then sorted by decreasing degree within a community.
+ *
+ * @par Overview
+ * Rabbit order merges communities hierarchically and orders the resulting
+ * dendrogram depth-first; this flat variant keeps its main effect (intra
+ * community edges get close ids) with only sorts and reductions over the
+ * edges.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+permutation_t<vertex_t> community_order(
+    format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> const&
+        csr,
+    int rounds = 10,
+    gcuda::stream_t stream = 0) {
+  auto policy = thrust::cuda::par.on(stream);
+  vertex_t n_vertices = csr.number_of_rows;
+  edge_t n_edges = csr.number_of_nonzeros;
+
+  thrust::device_vector<vertex_t> labels(n_vertices);
+  thrust::sequence(policy, labels.begin(), labels.end());
+
+  // Votes (vertex, label of a neighbor or of itself).
+  std::size_t n_votes = n_edges + n_vertices;
+  thrust::device_vector<vertex_t> voters(n_votes);
+  thrust::device_vector<vertex_t> votes(n_votes);
+  thrust::device_vector<vertex_t> candidates(n_votes);
+  thrust::device_vector<edge_t> counts(n_votes);
+  thrust::device_vector<vertex_t> winners(n_vertices);
+  thrust::device_vector<edge_t> winner_counts(n_vertices);
+
+  convert::offsets_to_indices<memory_space_t::device>(
+      csr.row_offsets.data().get(), (edge_t)(n_vertices + 1),
+      voters.data().get(), (vertex_t)n_edges);
+  thrust::sequence(policy, voters.begin() + n_edges, voters.end());
+
+  auto indices = csr.column_indices.data().get();
+  auto d_labels = labels.data().get();
+  for (int round = 0; round < rounds; ++round) {
+    thrust::transform(policy, thrust::counting_iterator<std::size_t>(0),
+                      thrust::counting_iterator<std::size_t>(n_votes),
+                      votes.begin(),
+                      [=] __device__(std::size_t const& i) {
+                        return (i < (std::size_t)n_edges)
+                                   ? d_labels[indices[i]]
+                                   : d_labels[i - n_edges];
+                      });
+
+    auto sorted_voters = voters;
+    auto sorted_keys = thrust::make_zip_iterator(
+        thrust::make_tuple(sorted_voters.begin(), votes.begin()));
+    thrust::sort(policy, sorted_keys, sorted_keys + n_votes);
+
+    // Count the votes per (vertex, label), then keep the best per vertex.
+    auto unique_voters = voters;
+    auto counted = thrust::reduce_by_key(
+        policy, sorted_keys, sorted_keys + n_votes,
+        thrust::constant_iterator<edge_t>(1),
+        thrust::make_zip_iterator(
+            thrust::make_tuple(unique_voters.begin(), candidates.begin())),
+        counts.begin());
+    std::size_t n_counted = counted.second - counts.begin();
+
+    auto values = thrust::make_zip_iterator(
+        thrust::make_tuple(counts.begin(), candidates.begin()));
+    thrust::reduce_by_key(
+        policy, unique_voters.begin(), unique_voters.begin() + n_counted,
+        values, thrust::make_discard_iterator(),
+        thrust::make_zip_iterator(
+            thrust::make_tuple(winner_counts.begin(), winners.begin())),
+        thrust::equal_to<vertex_t>(),
+        [] __device__(thrust::tuple<edge_t, vertex_t> const& a,
+                      thrust::tuple<edge_t, vertex_t> const& b) {
+          if (thrust::get<0>(a) != thrust::get<0>(b))
+            return (thrust::get<0>(a) > thrust::get<0>(b)) ? a : b;
+          return (thrust::get<1>(a) < thrust::get<1>(b)) ? a : b;
+        });
+
+    auto d_winners = winners.data().get();
+    thrust::for_each(policy, thrust::counting_iterator<vertex_t>(0),
+                     thrust::counting_iterator<vertex_t>(n_vertices),
+                     [=] __device__(vertex_t const& v) {
+                       if ((v & 1) == (round & 1))
+                         d_labels[v] = d_winners[v];
+                     });
+  }
+
+  permutation_t<vertex_t> permutation(n_vertices);
+  auto degrees =
+      detail::degrees(csr.row_offsets.data().get(), n_vertices, stream);
+  auto d_degrees = degrees.data().get();
+  thrust::sequence(policy, permutation.new_to_old.begin(),
+                   permutation.new_to_old.end());
+  thrust::sort(policy, permutation.new_to_old.begin(),
+               permutation.new_to_old.end(),
+               [d_labels, d_degrees] __device__(vertex_t const& a,
+                                                vertex_t const& b) {
+                 if (d_labels[a] != d_labels[b])
+                   return d_labels[a] < d_labels[b];
+                 if (d_degrees[a] != d_degrees[b])
+                   return d_degrees[a] > d_degrees[b];
+                 return a < b;
+               });
+  permutation.invert(stream);
+  return permutation;
+}
+
+/**
+ * @brief Permutation of the given order, @see order_t.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+permutation_t<vertex_t> get_permutation(
+    format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> const&
+        csr,
+    order_t order,
+    gcuda::stream_t stream = 0) {
+  if (order == order_t::rcm)
+    return rcm_order(csr, stream);
+  if (order == order_t::community)
+    return community_order(csr, 10, stream);
+  return degree_order(csr, stream);
+}
+
+/**
+ * @brief Renumber the vertices of a CSR, @see permutation_t for mapping the
+ * results back to the original ids. Neighbor lists are sorted.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> permute(
+    format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> const&
+        csr,
+    permutation_t<vertex_t> const& permutation,
+    gcuda::stream_t stream = 0) {
+  format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> result;
+  result.number_of_rows = csr.number_of_rows;
+  result.number_of_columns = csr.number_of_columns;
+  result.number_of_nonzeros = csr.number_of_nonzeros;
+  detail::permute_compressed(
+      permutation, csr.number_of_rows, csr.number_of_nonzeros, csr.row_offsets,
+      csr.column_indices, csr.nonzero_values, result.row_offsets,
+      result.column_indices, result.nonzero_values, stream);
+  return result;
+}
+
+/**
+ * @brief Renumber the vertices of a CSC.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+format::csc_t<memory_space_t::device, vertex_t, edge_t, weight_t> permute(
+    format::csc_t<memory_space_t::device, vertex_t, edge_t, weight_t> const&
+        csc,
+    permutation_t<vertex_t> const& permutation,
+    gcuda::stream_t stream = 0) {
+  format::csc_t<memory_space_t::device, vertex_t, edge_t, weight_t> result;
+  result.number_of_rows = csc.number_of_rows;
+  result.number_of_columns = csc.number_of_columns;
+  result.number_of_nonzeros = csc.number_of_nonzeros;
+  detail::permute_compressed(
+      permutation, csc.number_of_columns, (edge_t)csc.number_of_nonzeros,
+      csc.column_offsets, csc.row_indices, csc.nonzero_values,
+      result.column_offsets, result.row_indices, result.nonzero_values,
+      stream);
+  return result;
+}
+
+/**
+ * @brief Renumber the vertices of a COO, sorted by (row, column).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+format::coo_t<memory_space_t::device, vertex_t, edge_t, weight_t> permute(
+    format::coo_t<memory_space_t::device, vertex_t, edge_t, weight_t> const&
+        coo,
+    permutation_t<vertex_t> const& permutation,
+    gcuda::stream_t stream = 0) {
+  auto policy = thrust::cuda::par.on(stream);
+  auto map = permutation.old_to_new.data().get();
+  auto to_new = [map] __device__(vertex_t const& v) { return map[v]; };
+
+  format::coo_t<memory_space_t::device, vertex_t, edge_t, weight_t> result(
+      coo.number_of_rows, coo.number_of_columns, coo.number_of_nonzeros);
+  thrust::transform(policy, coo.row_indices.begin(), coo.row_indices.end(),
+                    result.row_indices.begin(), to_new);
+  thrust::transform(policy, coo.column_indices.begin(),
+                    coo.column_indices.end(), result.column_indices.begin(),
+                    to_new);
+  result.nonzero_values = coo.nonzero_values;
+
+  auto keys = thrust::make_zip_iterator(thrust::make_tuple(
+      result.row_indices.begin(), result.column_indices.begin()));
+  thrust::stable_sort_by_key(policy, keys, keys + result.number_of_nonzeros,
+                             result.nonzero_values.begin());
+  return result;
+}
+
+}  // namespace reorder
+}  // namespace graph
+}  // namespace gunrock
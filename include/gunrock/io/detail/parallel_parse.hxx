@@ -0,0 +1,255 @@
+/**
+ * @file parallel_parse.hxx
+ * @brief Memory-mapped files and multi-threaded parsing of text (line-based)
+ * inputs, used by the Matrix Market reader.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <gunrock/error.hxx>
+
+namespace gunrock {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ */
+class mapped_file_t {
+ public:
+  mapped_file_t(std::string const& filename) {
+    descriptor = ::open(filename.c_str(), O_RDONLY);
+    error::throw_if_exception(descriptor < 0,
+                              "File could not be opened: " + filename);
+
+    struct stat info;
+    error::throw_if_exception(::fstat(descriptor, &info) != 0,
+                              "File could not be stat'ed: " + filename);
+    bytes = info.st_size;
+
+    if (bytes > 0) {
+      void* ptr =
+          ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (ptr == MAP_FAILED) {
+        ::close(descriptor);
+        error::throw_if_exception(true,
+                                  "File could not be mapped: " + filename);
+      }
+      // Every byte is read once, front to back (per thread). The advice
+      // values are not flags, they are given one call each.
+      ::madvise(ptr, bytes, MADV_SEQUENTIAL);
+      ::madvise(ptr, bytes, MADV_WILLNEED);
+      address = static_cast<char const*>(ptr);
+    }
+  }
+
+  mapped_file_t(const mapped_file_t& rhs) = delete;
+  mapped_file_t& operator=(const mapped_file_t& rhs) = delete;
+
+  ~mapped_file_t() {
+    if (address)
+      ::munmap(const_cast<char*>(address), bytes);
+    if (descriptor >= 0)
+      ::close(descriptor);
+  }
+
+  char const* begin() const { return address; }
+  char const* end() const { return address + bytes; }
+  std::size_t size() const { return bytes; }
+
+ private:
+  int descriptor{-1};
+  char const* address{nullptr};
+  std::size_t bytes{0};
+};
+
+/**
+ * @brief Run `f(chunk)` for every chunk in `[0, num_chunks)`, one thread per
+ * chunk, and rethrow the first exception raised.
+ */
+template <typename function_t>
+void parallel_for_chunks(std::size_t num_chunks, function_t f) {
+  std::vector<std::thread> threads;
+  std::vector<std::exception_ptr> errors(num_chunks);
+
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    threads.emplace_back([&, chunk]() {
+      try {
+        f(chunk);
+      } catch (...) {
+        errors[chunk] = std::current_exception();
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (auto& error : errors)
+    if (error)
+      std::rethrow_exception(error);
+}
+
+/**
+ * @brief Number of threads to parse `bytes` bytes with, at least 1 MiB each.
+ */
+inline std::size_t number_of_parse_threads(std::size_t bytes) {
+  std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+  std::size_t useful = std::max<std::size_t>(1, bytes >> 20);
+  return std::min(hardware, useful);
+}
+
+/**
+ * @brief Split `[begin, end)` into `num_chunks` byte ranges that start at the
+ * beginning of a line. Returns `num_chunks + 1` boundaries.
+ */
+inline std::vector<char const*> split_lines(char const* begin,
+                                            char const* end,
+                                            std::size_t num_chunks) {
+  std::vector<char const*> bounds(num_chunks + 1, end);
+  bounds[0] = begin;
+  std::size_t bytes = end - begin;
+  for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    char const* p = std::max(begin + (bytes * chunk) / num_chunks,
+                             bounds[chunk - 1]);
+    char const* newline =
+        static_cast<char const*>(std::memchr(p, '\n', end - p));
+    bounds[chunk] = newline ? newline + 1 : end;
+  }
+  return bounds;
+}
+
+inline bool is_blank(char c) {
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * @brief Skip blanks (not newlines), returns the first non-blank.
+ */
+inline char const* skip_blanks(char const* p, char const* end) {
+  while (p < end && is_blank(*p))
+    ++p;
+  return p;
+}
+
+/**
+ * @brief Skip to the beginning of the next line.
+ */
+inline char const* next_line(char const* p, char const* end) {
+  char const* newline =
+      static_cast<char const*>(std::memchr(p, '\n', end - p));
+  return newline ? newline + 1 : end;
+}
+
+/**
+ * @brief True if the line starting at `p` holds data (not blank, not a `%`
+ * comment).
+ */
+inline bool is_data_line(char const* p, char const* end) {
+  p = skip_blanks(p, end);
+  return p < end && *p != '\n' && *p != '%';
+}
+
+/**
+ * @brief Parse an unsigned decimal integer at `p` (after blanks), advancing
+ * `p` past it. Returns false if there is no digit.
+ */
+inline bool parse_unsigned(char const*& p,
+                           char const* end,
+                           std::size_t& x) {
+  p = skip_blanks(p, end);
+  char const* first = p;
+  std::size_t value = 0;
+  while (p < end && unsigned(*p - '0') < 10)
+    value = value * 10 + (*p++ - '0');
+  x = value;
+  return p != first;
+}
+
+/**
+ * @brief Parse a floating-point number at `p` (after blanks), advancing `p`
+ * past it. Plain decimal and scientific notations are parsed inline, anything
+ * else (for example, `inf` or `nan`) falls back to `strtod`. Returns false if
+ * there is no number.
+ */
+inline bool parse_real(char const*& p, char const* end, double& x) {
+  p = skip_blanks(p, end);
+  char const* first = p;
+
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+'))
+    negative = (*p++ == '-');
+
+  // Accumulate the digits as an integer and apply the decimal exponent once.
+  std::uint64_t mantissa = 0;
+  int exponent = 0;
+  std::size_t digits = 0;
+  for (; p < end && unsigned(*p - '0') < 10; ++p, ++digits)
+    mantissa = mantissa * 10 + (*p - '0');
+
+  if (p < end && *p == '.') {
+    for (++p; p < end && unsigned(*p - '0') < 10; ++p, ++digits, --exponent)
+      mantissa = mantissa * 10 + (*p - '0');
+  }
+
+  if (digits > 0 && p < end && (*p == 'e' || *p == 'E')) {
+    char const* q = p + 1;
+    bool negative_exponent = false;
+    if (q < end && (*q == '-' || *q == '+'))
+      negative_exponent = (*q++ == '-');
+    if (q < end && unsigned(*q - '0') < 10) {
+      int e = 0;
+      while (q < end && unsigned(*q - '0') < 10)
+        e = e * 10 + (*q++ - '0');
+      exponent += negative_exponent ? -e : e;
+      p = q;
+    }
+  }
+
+  bool delimited = (p == end) || is_blank(*p) || *p == '\n';
+  // Up to 19 digits are exact, longer mantissas go through strtod.
+  if (digits > 0 && digits < 20 && delimited) {
+    double value = double(mantissa);
+    if (exponent > 0)
+      value *= std::pow(10.0, exponent);
+    else if (exponent < 0)
+      value /= std::pow(10.0, -exponent);
+    x = negative ? -value : value;
+    return true;
+  }
+
+  // Uncommon spelling, copy the token to terminate it for strtod.
+  p = first;
+  char token[64];
+  std::size_t length = 0;
+  while (p < end && !is_blank(*p) && *p != '\n' && length < sizeof(token) - 1)
+    token[length++] = *p++;
+  token[length] = '\0';
+
+  char* parsed;
+  x = std::strtod(token, &parsed);
+  return parsed != token;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace gunrock
@@ -10,10 +10,17 @@
 
 #pragma once
 
-#include <string>
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <gunrock/io/detail/mmio.hxx>
+#include <gunrock/io/detail/parallel_parse.hxx>
 
 #include <gunrock/util/filepath.hxx>
 #include <gunrock/formats/formats.hxx>
@@ -93,6 +100,12 @@ struct matrix_market_t {
    * coordinate array. This needs to be further extended to support dense
    * arrays, those are the only two formats mtx are written in.
    *
+   * @par Overview
+   * The entries are parsed from a memory mapping of the file by multiple
+   * threads (one per byte range of at least 1 MiB, up to the number of
+   * hardware threads), and symmetric matrices are expanded in parallel. The
+   * order of the entries is the order of the file.
+   *
    * @param _filename input file name (.mtx)
    * @return coordinate sparse format
    */
@@ -132,6 +145,11 @@ struct matrix_market_t {
       exit(1);
     }
 
+    // The entries start right after the size line, they are parsed from a
+    // memory mapping of the file.
+    long data_offset = ftell(file);
+    fclose(file);
+
     error::throw_if_exception(
         num_rows >= std::numeric_limits<vertex_t>::max() ||
             num_columns >= std::numeric_limits<vertex_t>::max(),
@@ -153,104 +171,254 @@ struct matrix_market_t {
     if (mm_is_pattern(code)) {
       properties.weighted = false;
       data = matrix_market_data_t::pattern;
-
-      // pattern matrix defines sparsity pattern, but not values
-      for (vertex_t i = 0; i < num_nonzeros; ++i) {
-        std::size_t row_index{0}, col_index{0};
-        auto num_assigned = fscanf(file, " %zu %zu \n", &row_index, &col_index);
-        error::throw_if_exception(num_assigned != 2,
-                                  "Could not read edge from market file");
-        error::throw_if_exception(row_index == 0,
-                                  "Market file is zero-indexed");
-        error::throw_if_exception(col_index == 0,
-                                  "Market file is zero-indexed");
-        // set and adjust from 1-based to 0-based indexing
-        coo.row_indices[i] = (vertex_t)row_index - 1;
-        coo.column_indices[i] = (vertex_t)col_index - 1;
-        coo.nonzero_values[i] =
-            (weight_t)1.0;  // use value 1.0 for all nonzero entries
-      }
     } else if (mm_is_real(code) || mm_is_integer(code)) {
       properties.weighted = true;
       if (mm_is_real(code))
         data = matrix_market_data_t::real;
       else
         data = matrix_market_data_t::integer;
-
-      for (vertex_t i = 0; i < coo.number_of_nonzeros; ++i) {
-        std::size_t row_index{0}, col_index{0};
-        double weight{0.0};
-
-        auto num_assigned =
-            fscanf(file, " %zu %zu %lf \n", &row_index, &col_index, &weight);
-
-        error::throw_if_exception(
-            num_assigned != 3, "Could not read weighted edge from market file");
-        error::throw_if_exception(row_index == 0,
-                                  "Market file is zero-indexed");
-        error::throw_if_exception(col_index == 0,
-                                  "Market file is zero-indexed");
-
-        coo.row_indices[i] = (vertex_t)row_index - 1;
-        coo.column_indices[i] = (vertex_t)col_index - 1;
-        coo.nonzero_values[i] = (weight_t)weight;
-      }
     } else {
       std::cerr << "Unrecognized matrix market format type" << std::endl;
       exit(1);
     }
 
+    read_entries(data_offset, coo);
+
     if (mm_is_symmetric(code)) {  // duplicate off diagonal entries
       properties.symmetric = true;
       properties.directed = false;
       scheme = matrix_market_storage_scheme_t::symmetric;
-      vertex_t off_diagonals = 0;
-      for (vertex_t i = 0; i < coo.number_of_nonzeros; ++i) {
-        if (coo.row_indices[i] != coo.column_indices[i])
-          ++off_diagonals;
+      symmetrize(coo);
+    }  // end symmetric case
+    else {
+      properties.symmetric = false;
+      properties.directed = true;
+    }
+
+    return {properties, coo};
+  }
+
+  /**
+   * @brief Loads the given .mtx file directly into a (host) compressed sparse
+   * row format, built in parallel. The column indices of each row are sorted
+   * (unlike `csr_t::from_coo()`, which keeps the order of the file).
+   *
+   * @param _filename input file name (.mtx)
+   * @return compressed sparse row format
+   */
+  std::tuple<gunrock::graph::graph_properties_t,
+             format::csr_t<gunrock::memory::memory_space_t::host,
+                           vertex_t,
+                           edge_t,
+                           weight_t>>
+  load_csr(std::string _filename) {
+    auto [properties, coo] = load(_filename);
+
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr(
+        coo.number_of_rows, coo.number_of_columns, coo.number_of_nonzeros);
+
+    std::size_t n_rows = coo.number_of_rows;
+    std::size_t nnz = coo.number_of_nonzeros;
+    auto num_chunks = detail::number_of_parse_threads(nnz * sizeof(vertex_t));
+    auto chunk_begin = [&](std::size_t chunk, std::size_t n) {
+      return (n * chunk) / num_chunks;
+    };
+
+    auto I = coo.row_indices.data();
+    auto J = coo.column_indices.data();
+    auto V = coo.nonzero_values.data();
+    auto Ap = csr.row_offsets.data();
+    auto Aj = csr.column_indices.data();
+    auto Ax = csr.nonzero_values.data();
+
+    // 1. Count the nonzeros per row.
+    std::unique_ptr<std::atomic<edge_t>[]> cursor(
+        new std::atomic<edge_t>[n_rows]);
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      for (auto r = chunk_begin(chunk, n_rows);
+           r < chunk_begin(chunk + 1, n_rows); ++r)
+        cursor[r].store(0, std::memory_order_relaxed);
+    });
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      for (auto n = chunk_begin(chunk, nnz); n < chunk_begin(chunk + 1, nnz);
+           ++n)
+        cursor[I[n]].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    // 2. Cumulative sum the nnz per row to get row_offsets[].
+    edge_t sum = 0;
+    for (std::size_t r = 0; r < n_rows; ++r) {
+      Ap[r] = sum;
+      sum += cursor[r].load(std::memory_order_relaxed);
+      cursor[r].store(Ap[r], std::memory_order_relaxed);
+    }
+    Ap[n_rows] = sum;
+
+    // 3. Scatter the nonzeros into their rows.
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      for (auto n = chunk_begin(chunk, nnz); n < chunk_begin(chunk + 1, nnz);
+           ++n) {
+        auto dest = cursor[I[n]].fetch_add(1, std::memory_order_relaxed);
+        Aj[dest] = J[n];
+        Ax[dest] = V[n];
+      }
+    });
+
+    // 4. The scatter order is arbitrary, sort each row for a deterministic
+    // result.
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      std::vector<std::pair<vertex_t, weight_t>> row;
+      for (auto r = chunk_begin(chunk, n_rows);
+           r < chunk_begin(chunk + 1, n_rows); ++r) {
+        row.clear();
+        for (auto e = Ap[r]; e < Ap[r + 1]; ++e)
+          row.emplace_back(Aj[e], Ax[e]);
+        std::sort(row.begin(), row.end());
+        for (auto e = Ap[r]; e < Ap[r + 1]; ++e) {
+          Aj[e] = row[e - Ap[r]].first;
+          Ax[e] = row[e - Ap[r]].second;
+        }
       }
+    });
 
-      vertex_t _nonzeros =
-          2 * off_diagonals + (coo.number_of_nonzeros - off_diagonals);
+    return {properties, csr};
+  }
 
-      vector_t<vertex_t, memory_space_t::host> new_I(_nonzeros);
-      vector_t<vertex_t, memory_space_t::host> new_J(_nonzeros);
-      vector_t<weight_t, memory_space_t::host> new_V(_nonzeros);
+ private:
+  /**
+   * @brief Parse the entries (starting at byte `data_offset`) into `coo`, the
+   * file is split in byte ranges on line boundaries, one per thread. A first
+   * pass counts the entries of every range, such that the second pass writes
+   * them in the order of the file.
+   */
+  void read_entries(
+      long data_offset,
+      format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>& coo) {
+    detail::mapped_file_t file(filename);
+    char const* begin = file.begin() + data_offset;
+    char const* end = file.end();
+
+    auto num_chunks = detail::number_of_parse_threads(end - begin);
+    auto bounds = detail::split_lines(begin, end, num_chunks);
+
+    // 1. Count the entries of each chunk.
+    std::vector<std::size_t> offsets(num_chunks + 1, 0);
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      std::size_t count = 0;
+      for (char const* line = bounds[chunk]; line < bounds[chunk + 1];
+           line = detail::next_line(line, bounds[chunk + 1]))
+        if (detail::is_data_line(line, bounds[chunk + 1]))
+          ++count;
+      offsets[chunk + 1] = count;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::size_t num_nonzeros = coo.number_of_nonzeros;
+    bool weighted = (data != matrix_market_data_t::pattern);
+    error::throw_if_exception(offsets[num_chunks] < num_nonzeros,
+                              weighted
+                                  ? "Could not read weighted edge from market "
+                                    "file"
+                                  : "Could not read edge from market file");
+
+    // 2. Parse the entries of each chunk at its offset.
+    auto I = coo.row_indices.data();
+    auto J = coo.column_indices.data();
+    auto V = coo.nonzero_values.data();
+
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      char const* stop = bounds[chunk + 1];
+      std::size_t i = offsets[chunk];
+      for (char const* line = bounds[chunk]; line < stop && i < num_nonzeros;
+           line = detail::next_line(line, stop)) {
+        if (!detail::is_data_line(line, stop))
+          continue;
+
+        char const* p = line;
+        std::size_t row_index{0}, col_index{0};
+        double weight{1.0};  // use value 1.0 for all pattern entries
 
-      vertex_t* _I = new_I.data();
-      vertex_t* _J = new_J.data();
-      weight_t* _V = new_V.data();
+        bool parsed = detail::parse_unsigned(p, stop, row_index) &&
+                      detail::parse_unsigned(p, stop, col_index);
+        if (weighted)
+          parsed = parsed && detail::parse_real(p, stop, weight);
 
-      vertex_t ptr = 0;
-      for (vertex_t i = 0; i < coo.number_of_nonzeros; ++i) {
-        if (coo.row_indices[i] != coo.column_indices[i]) {
-          _I[ptr] = coo.row_indices[i];
-          _J[ptr] = coo.column_indices[i];
-          _V[ptr] = coo.nonzero_values[i];
-          ++ptr;
-          _J[ptr] = coo.row_indices[i];
-          _I[ptr] = coo.column_indices[i];
-          _V[ptr] = coo.nonzero_values[i];
-          ++ptr;
-        } else {
-          _I[ptr] = coo.row_indices[i];
-          _J[ptr] = coo.column_indices[i];
-          _V[ptr] = coo.nonzero_values[i];
+        error::throw_if_exception(
+            !parsed, weighted ? "Could not read weighted edge from market file"
+                              : "Could not read edge from market file");
+        error::throw_if_exception(row_index == 0,
+                                  "Market file is zero-indexed");
+        error::throw_if_exception(col_index == 0,
+                                  "Market file is zero-indexed");
+
+        // set and adjust from 1-based to 0-based indexing
+        I[i] = (vertex_t)row_index - 1;
+        J[i] = (vertex_t)col_index - 1;
+        V[i] = (weight_t)weight;
+        ++i;
+      }
+    });
+  }
+
+  /**
+   * @brief Duplicate the off diagonal entries (in parallel), every entry is
+   * followed by its transpose.
+   */
+  void symmetrize(
+      format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>& coo) {
+    std::size_t nnz = coo.number_of_nonzeros;
+    auto num_chunks = detail::number_of_parse_threads(nnz * sizeof(vertex_t));
+    auto chunk_begin = [&](std::size_t chunk) {
+      return (nnz * chunk) / num_chunks;
+    };
+
+    auto I = coo.row_indices.data();
+    auto J = coo.column_indices.data();
+    auto V = coo.nonzero_values.data();
+
+    // 1. Size of the output of each chunk.
+    std::vector<std::size_t> offsets(num_chunks + 1, 0);
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      std::size_t size = 0;
+      for (auto i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i)
+        size += (I[i] != J[i]) ? 2 : 1;
+      offsets[chunk + 1] = size;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::size_t _nonzeros = offsets[num_chunks];
+    error::throw_if_exception(
+        _nonzeros >= std::numeric_limits<edge_t>::max(), "edge_t overflow");
+
+    vector_t<vertex_t, memory_space_t::host> new_I(_nonzeros);
+    vector_t<vertex_t, memory_space_t::host> new_J(_nonzeros);
+    vector_t<weight_t, memory_space_t::host> new_V(_nonzeros);
+
+    vertex_t* _I = new_I.data();
+    vertex_t* _J = new_J.data();
+    weight_t* _V = new_V.data();
+
+    // 2. Write the entries and their transposes.
+    detail::parallel_for_chunks(num_chunks, [&](std::size_t chunk) {
+      std::size_t ptr = offsets[chunk];
+      for (auto i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+        _I[ptr] = I[i];
+        _J[ptr] = J[i];
+        _V[ptr] = V[i];
+        ++ptr;
+        if (I[i] != J[i]) {
+          _I[ptr] = J[i];
+          _J[ptr] = I[i];
+          _V[ptr] = V[i];
           ++ptr;
         }
       }
-      coo.row_indices = new_I;
-      coo.column_indices = new_J;
-      coo.nonzero_values = new_V;
-      coo.number_of_nonzeros = _nonzeros;
-    }  // end symmetric case
-    else {
-      properties.symmetric = false;
-      properties.directed = true;
-    }
-    fclose(file);
+    });
 
-    return {properties, coo};
+    coo.row_indices = new_I;
+    coo.column_indices = new_J;
+    coo.nonzero_values = new_V;
+    coo.number_of_nonzeros = (edge_t)_nonzeros;
   }
 };
 
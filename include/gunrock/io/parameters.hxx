@@ -10,11 +10,17 @@ struct parameters_t {
   std::string json_dir = ".";
   std::string json_file = "";
   std::string tag_string = "";
+  std::string mode = "";
+  std::string reorder = "";
   int num_runs = 1;
+  float delta = 0;
+  int samples = 0;
+  float epsilon = 0;
   cxxopts::Options options;
   bool export_metrics = false;
   bool validate = false;
   bool binary = false;
+  bool managed = false;
 
   /**
    * @brief Construct a new parameters object and parse command line arguments.
@@ -39,6 +45,7 @@ struct parameters_t {
     // Algorithms with sources
     if (algorithm == "Betweenness Centrality" ||
         algorithm == "Breadth First Search" ||
+        algorithm == "Multi-Source Breadth First Search" ||
         algorithm == "Single Source Shortest Path") {
       options.add_options()("s,src",
                             "Source(s) (random if omitted); "
@@ -47,14 +54,42 @@ struct parameters_t {
           ("n,num_runs", "Number of runs (ignored if multiple sources passed)",
            cxxopts::value<int>());  // runs
       if (algorithm == "Breadth First Search" ||
+          algorithm == "Multi-Source Breadth First Search" ||
           algorithm == "Single Source Shortest Path") {
         options.add_options()("validate", "CPU validation");  // validate
       }
+      if (algorithm == "Betweenness Centrality") {
+        options.add_options()(
+            "samples", "Approximate from a number of sampled sources",
+            cxxopts::value<int>())  // samples
+            ("epsilon",
+             "Approximate within an error bound (sample size adaptive)",
+             cxxopts::value<float>());  // epsilon
+      }
+      if (algorithm == "Single Source Shortest Path") {
+        options.add_options()(
+            "delta", "Delta-stepping bucket width (0 for Bellman-Ford)",
+            cxxopts::value<float>());  // delta
+      }
     } else {
       options.add_options()("n,num_runs", "Number of runs",
                             cxxopts::value<int>());  // runs
     }
 
+    if (algorithm == "Page Rank") {
+      options.add_options()(
+          "mode", "Update scheme (power, push or pull; default power)",
+          cxxopts::value<std::string>());  // mode
+    }
+
+    if (algorithm == "Page Rank" || algorithm == "Breadth First Search") {
+      options.add_options()(
+          "reorder", "Renumber the vertices (degree, rcm or community)",
+          cxxopts::value<std::string>())  // reorder
+          ("managed",
+           "Stream the graph from managed memory (larger than the GPU's)");
+    }
+
     // Parse command line arguments
     auto result = options.parse(argc, argv);
 
@@ -80,6 +115,10 @@ struct parameters_t {
       validate = true;
     }
 
+    if (result.count("managed") == 1) {
+      managed = true;
+    }
+
     if (result.count("export_metrics") == 1) {
       export_metrics = true;
     }
@@ -92,6 +131,26 @@ struct parameters_t {
       tag_string = result["tag"].as<std::string>();
     }
 
+    if (result.count("delta") == 1) {
+      delta = result["delta"].as<float>();
+    }
+
+    if (result.count("samples") == 1) {
+      samples = result["samples"].as<int>();
+    }
+
+    if (result.count("epsilon") == 1) {
+      epsilon = result["epsilon"].as<float>();
+    }
+
+    if (result.count("mode") == 1) {
+      mode = result["mode"].as<std::string>();
+    }
+
+    if (result.count("reorder") == 1) {
+      reorder = result["reorder"].as<std::string>();
+    }
+
     if (result.count("src") == 1) {
       source_string = result["src"].as<std::string>();
     }
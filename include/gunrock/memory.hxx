@@ -12,16 +12,23 @@
 
 #include <iostream>
 #include <memory>
+#include <cstdint>
+#include <type_traits>
 
 #include <thrust/device_ptr.h>
+#include <thrust/universal_ptr.h>
+#include <thrust/device_malloc_allocator.h>
+#include <thrust/execution_policy.h>
 #include <gunrock/error.hxx>
 
 namespace gunrock {
 namespace memory {
 
 /**
- * @brief memory space; cuda (device) or host.
- * Can be extended to support uvm and multi-gpu.
+ * @brief memory space; cuda (device), host or managed (unified memory, pages
+ * migrate on demand between the host and the device, which allows a graph
+ * larger than the device's memory, @see streaming::prefetcher_t).
+ * Can be extended to support multi-gpu.
  *
  * @todo change this enum to support cudaMemoryType
  * (see ref;  std::underlying_type<cudaMemoryType>::type)
@@ -30,7 +37,7 @@ namespace memory {
  * for this.
  *
  */
-enum memory_space_t { device, host };
+enum memory_space_t { device, host, managed };
 
 /**
  * @brief allocate memory on defined memory space on a specific pointer.
@@ -38,16 +45,17 @@ enum memory_space_t { device, host };
  * @tparam type_t type of the pointer
  * @param pointer pointer to the memory
  * @param size size of the memory in bytes
- * @param space memory space (device or host)
+ * @param space memory space (device, host or managed)
  */
 template <typename type_t>
 void allocate(type_t* pointer,
               std::size_t size,
               memory_space_t space = memory_space_t::device) {
   if (size) {
-    error::throw_if_exception((device == space)
-                                  ? cudaMalloc(&pointer, size)
-                                  : cudaMallocHost(&pointer, size));
+    error::throw_if_exception(
+        (device == space)    ? cudaMalloc(&pointer, size)
+        : (managed == space) ? cudaMallocManaged(&pointer, size)
+                             : cudaMallocHost(&pointer, size));
   }
 }
 
@@ -64,9 +72,10 @@ inline type_t* allocate(std::size_t size,
                         memory_space_t space = memory_space_t::device) {
   void* pointer = nullptr;
   if (size) {
-    error::throw_if_exception((device == space)
-                                  ? cudaMalloc(&pointer, size)
-                                  : cudaMallocHost(&pointer, size));
+    error::throw_if_exception(
+        (device == space)    ? cudaMalloc(&pointer, size)
+        : (managed == space) ? cudaMallocManaged(&pointer, size)
+                             : cudaMallocHost(&pointer, size));
   }
   return reinterpret_cast<type_t*>(pointer);
 }
@@ -82,11 +91,57 @@ template <typename type_t>
 inline void free(type_t* pointer,
                  memory_space_t space = memory_space_t::device) {
   if (pointer) {
-    error::throw_if_exception((device == space) ? cudaFree((void*)pointer)
-                                                : cudaFreeHost((void*)pointer));
+    error::throw_if_exception((host == space) ? cudaFreeHost((void*)pointer)
+                                              : cudaFree((void*)pointer));
   }
 }
 
+/**
+ * @brief Configure the default memory pool of a device (used by the
+ * stream-ordered allocations below) to keep the freed memory reserved instead
+ * of releasing it to the driver at every synchronization. Repeated allocations
+ * (for example, per query or per `enact()`) are then served from the pool.
+ *
+ * @param device device whose default memory pool is configured.
+ * @param release_threshold bytes kept reserved by the pool (default: all).
+ */
+inline void retain_pool_memory(int device = 0,
+                               std::uint64_t release_threshold = UINT64_MAX) {
+  cudaMemPool_t pool;
+  error::throw_if_exception(cudaDeviceGetDefaultMemPool(&pool, device));
+  error::throw_if_exception(cudaMemPoolSetAttribute(
+      pool, cudaMemPoolAttrReleaseThreshold, &release_threshold));
+}
+
+/**
+ * @brief Stream-ordered allocation from the device's memory pool.
+ *
+ * @tparam type_t return type of the pointer being allocated.
+ * @param size size in bytes (bytes to be allocated).
+ * @param stream stream the allocation is ordered on.
+ * @return type_t* allocated pointer, usable by work ordered after it.
+ */
+template <typename type_t>
+inline type_t* allocate_async(std::size_t size, cudaStream_t stream = 0) {
+  void* pointer = nullptr;
+  if (size)
+    error::throw_if_exception(cudaMallocAsync(&pointer, size, stream));
+  return reinterpret_cast<type_t*>(pointer);
+}
+
+/**
+ * @brief Stream-ordered free, returns the memory to the device's pool.
+ *
+ * @tparam type_t type of the pointer.
+ * @param pointer pointer allocated using `allocate_async()`.
+ * @param stream stream the free is ordered on.
+ */
+template <typename type_t>
+inline void free_async(type_t* pointer, cudaStream_t stream = 0) {
+  if (pointer)
+    error::throw_if_exception(cudaFreeAsync((void*)pointer, stream));
+}
+
 /**
  * @brief Wrapper around thrust::raw_pointer_cast() to accept .data() or raw
  * pointer and return a raw pointer. Useful when we would like to return a raw
@@ -104,6 +159,19 @@ inline type_t* raw_pointer_cast(thrust::device_ptr<type_t> pointer) {
   return thrust::raw_pointer_cast(pointer);
 }
 
+/**
+ * @brief Wrapper around thrust::raw_pointer_cast() to accept the .data() of a
+ * thrust universal (managed) vector and return a raw pointer.
+ *
+ * @tparam type_t
+ * @param pointer
+ * @return type_t*
+ */
+template <typename type_t>
+inline type_t* raw_pointer_cast(thrust::universal_ptr<type_t> pointer) {
+  return thrust::raw_pointer_cast(pointer);
+}
+
 /**
  * @brief Wrapper around thrust::raw_pointer_cast() to accept .data() or raw
  * pointer and return a raw pointer. Useful when we would like to return a raw
@@ -149,7 +217,72 @@ struct allocator_t {
    * @param size size in bytes.
    * @return type_t* returns the allocated pointer.
    */
-  type_t* operator()(size_t bytes) const { allocate<type_t>(bytes); }
+  type_t* operator()(size_t bytes) const { return allocate<type_t>(bytes); }
+};
+
+/**
+ * @brief Thrust allocator backed by the device's memory pool (stream-ordered
+ * `cudaMallocAsync` and `cudaFreeAsync`), @see retain_pool_memory().
+ *
+ * @par Overview
+ * Use with `thrust::device_vector` (@see gunrock::pooled_vector_t) for buffers
+ * that are allocated and freed often, such as frontiers and per-run problem
+ * data. The allocator is bound to the stream the buffer is used on (the
+ * context's stream): allocations, frees, and the fills and copies thrust does
+ * to construct or resize the vector are all ordered on it. A free therefore
+ * only returns the memory to the pool once the work on that stream is done.
+ *
+ * @tparam type_t type of the elements.
+ */
+template <typename type_t>
+struct pool_allocator_t : thrust::device_malloc_allocator<type_t> {
+  using base_t = thrust::device_malloc_allocator<type_t>;
+  using pointer = typename base_t::pointer;
+  using size_type = typename base_t::size_type;
+
+  /*!
+   * Execution policy of the vector's own algorithms, found by thrust through
+   * `system()`.
+   */
+  using system_type = decltype(thrust::cuda::par_nosync.on(cudaStream_t{}));
+
+  template <typename other_t>
+  struct rebind {
+    using other = pool_allocator_t<other_t>;
+  };
+
+  /*!
+   * A vector moved or swapped into another keeps its stream.
+   */
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit pool_allocator_t(cudaStream_t _stream)
+      : stream(_stream), policy(thrust::cuda::par_nosync.on(_stream)) {}
+
+  template <typename other_t>
+  pool_allocator_t(pool_allocator_t<other_t> const& rhs)
+      : pool_allocator_t(rhs.stream) {}
+
+  pointer allocate(size_type n) {
+    return pointer(allocate_async<type_t>(n * sizeof(type_t), stream));
+  }
+
+  void deallocate(pointer p, size_type n) {
+    free_async(thrust::raw_pointer_cast(p), stream);
+  }
+
+  system_type& system() { return policy; }
+
+  bool operator==(pool_allocator_t const& rhs) const {
+    return stream == rhs.stream;
+  }
+  bool operator!=(pool_allocator_t const& rhs) const {
+    return !(*this == rhs);
+  }
+
+  cudaStream_t stream;
+  system_type policy;
 };
 
 }  // namespace memory
@@ -0,0 +1,387 @@
+/**
+ * @file engine.hxx
+ * @brief Long-lived, in-process graph analytics engine: a graph is loaded
+ * onto the device once and queried repeatedly, with the problems and enactors
+ * of the algorithms kept warm between the queries.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <gunrock/algorithms/bfs.hxx>
+#include <gunrock/algorithms/sssp.hxx>
+#include <gunrock/algorithms/pr.hxx>
+#include <gunrock/algorithms/ppr.hxx>
+
+#include <gunrock/io/matrix_market.hxx>
+#include <gunrock/util/filepath.hxx>
+
+namespace gunrock {
+namespace service {
+namespace detail {
+
+/**
+ * @brief Breadth-first search, reusing its problem and enactor (and their
+ * frontiers) across the queries.
+ */
+template <typename graph_t>
+struct bfs_worker_t {
+  using vertex_t = typename graph_t::vertex_type;
+
+  using param_type = bfs::param_t<vertex_t>;
+  using result_type = bfs::result_t<vertex_t>;
+  using problem_type = bfs::problem_t<graph_t, param_type, result_type>;
+  using enactor_type = bfs::enactor_t<problem_type>;
+
+  param_type param;
+  result_type result;
+  problem_type problem;
+  enactor_type enactor;
+
+  bfs_worker_t(std::shared_ptr<gcuda::multi_context_t> context, graph_t& G)
+      : param(0),
+        result(nullptr, nullptr),
+        problem(G, param, result, context),
+        enactor(&problem, context, properties()) {
+    problem.init();
+  }
+
+  float operator()(vertex_t source, vertex_t* distances, vertex_t* preds) {
+    problem.param.single_source = source;
+    problem.result.distances = distances;
+    problem.result.predecessors = preds;
+    problem.reset();
+    return enactor.enact();
+  }
+
+  static enactor_properties_t properties() {
+    // As in `bfs::run()`.
+    enactor_properties_t props;
+    if constexpr (operators::advance::pull::has_csc_view_v<graph_t>)
+      props.dense_frontier_ratio =
+          1.0f / operators::advance::direction_optimized_params_t().beta;
+    return props;
+  }
+};
+
+/**
+ * @brief Single-source shortest path, for a given delta-stepping bucket width
+ * (the enactor's buckets are sized by it).
+ */
+template <typename graph_t>
+struct sssp_worker_t {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = sssp::param_t<vertex_t, weight_t>;
+  using result_type = sssp::result_t<vertex_t, weight_t>;
+  using problem_type = sssp::problem_t<graph_t, param_type, result_type>;
+  using enactor_type = sssp::enactor_t<problem_type>;
+
+  param_type param;
+  result_type result;
+  problem_type problem;
+  enactor_type enactor;
+
+  sssp_worker_t(std::shared_ptr<gcuda::multi_context_t> context,
+                graph_t& G,
+                weight_t delta)
+      : param(0, delta),
+        result(nullptr, nullptr, G.get_number_of_vertices()),
+        problem(G, param, result, context),
+        enactor(&problem, context, properties()) {
+    problem.init();
+  }
+
+  float operator()(vertex_t source, weight_t* distances, vertex_t* preds) {
+    problem.param.single_source = source;
+    problem.result.distances = distances;
+    problem.result.predecessors = preds;
+    problem.reset();
+    return enactor.enact();
+  }
+
+  weight_t get_delta() const { return problem.param.delta; }
+
+  static enactor_properties_t properties() {
+    // As in `sssp::run()`.
+    enactor_properties_t props;
+    props.dense_frontier_ratio = 0.1f;
+    return props;
+  }
+};
+
+/**
+ * @brief PageRank (power iteration, captured).
+ */
+template <typename graph_t>
+struct pr_worker_t {
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = pr::param_t<weight_t>;
+  using result_type = pr::result_t<weight_t>;
+  using problem_type = pr::problem_t<graph_t, param_type, result_type>;
+  using enactor_type = pr::enactor_t<problem_type>;
+
+  param_type param;
+  result_type result;
+  problem_type problem;
+  enactor_type enactor;
+
+  pr_worker_t(std::shared_ptr<gcuda::multi_context_t> context, graph_t& G)
+      : param(0.85, 1e-6),
+        result(nullptr),
+        problem(G, param, result, context),
+        enactor(&problem, context, properties()) {
+    problem.init();
+  }
+
+  float operator()(weight_t alpha, weight_t tol, weight_t* p) {
+    problem.param.alpha = alpha;
+    problem.param.tol = tol;
+    problem.result.p = p;
+    problem.reset();
+    return enactor.enact();
+  }
+
+  static enactor_properties_t properties() {
+    // As in `pr::run()`.
+    enactor_properties_t props;
+    props.self_manage_frontiers = true;
+    props.capture_graph = true;
+    return props;
+  }
+};
+
+/**
+ * @brief Personalized PageRank, @see ppr::batch_worker_t.
+ */
+template <typename graph_t>
+struct ppr_worker_t {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using param_type = ppr::param_t<vertex_t, weight_t>;
+  using result_type = ppr::result_t<weight_t>;
+  using problem_type = ppr::problem_t<graph_t, param_type, result_type>;
+  using enactor_type = ppr::enactor_t<problem_type>;
+
+  param_type param;
+  result_type result;
+  problem_type problem;
+  enactor_type enactor;
+
+  ppr_worker_t(std::shared_ptr<gcuda::multi_context_t> context, graph_t& G)
+      : param(0, 0.15, 1e-6),
+        result(nullptr),
+        problem(G, param, result, context),
+        enactor(&problem, context) {
+    problem.init();
+  }
+
+  float operator()(vertex_t seed, weight_t alpha, weight_t epsilon,
+                   weight_t* p) {
+    // The constants derived from alpha are computed by `init()`.
+    if (alpha != problem.param.alpha) {
+      problem.param.alpha = alpha;
+      problem.init();
+    }
+    problem.param.seed = seed;
+    problem.param.epsilon = epsilon;
+    problem.result.p = p;
+    problem.reset();
+    return enactor.enact();
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A graph resident in device memory, and the algorithms to query it.
+ *
+ * @par Overview
+ * The engine owns the device CSR, the graph view built over it and a
+ * `gcuda::multi_context_t`, created once. The problem and enactor of an
+ * algorithm are created by its first query and reused by the following ones,
+ * such that a query only resets the algorithm's state and runs its kernels.
+ * Outputs are written to caller-provided device arrays (no copies). Queries
+ * are serialized, they share the context's stream, and run on the engine's
+ * device whichever thread (and current device) they come from.
+ *
+ * @tparam vertex_t Vertex type.
+ * @tparam edge_t Edge type.
+ * @tparam weight_t Weight type.
+ */
+template <typename vertex_t = int,
+          typename edge_t = int,
+          typename weight_t = float>
+class engine_t {
+ public:
+  using csr_type = format::
+      csr_t<memory::memory_space_t::device, vertex_t, edge_t, weight_t>;
+  using graph_type =
+      decltype(graph::build<memory::memory_space_t::device>(
+          std::declval<graph::graph_properties_t>(),
+          std::declval<csr_type&>()));
+
+  /**
+   * @brief Load a graph from a matrix-market (`.mtx`) or binary CSR (`.csr`)
+   * file onto the device.
+   *
+   * @param filename graph file.
+   * @param device device the graph lives (and the queries run) on.
+   */
+  engine_t(std::string const& filename, gcuda::device_id_t device = 0)
+      : context(std::make_shared<gcuda::multi_context_t>(device)) {
+    graph::graph_properties_t properties;
+    if (util::is_binary_csr(filename)) {
+      csr.read_binary(filename);
+    } else {
+      io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+      auto [mm_properties, coo] = mm.load(filename);
+      properties = mm_properties;
+      csr.from_coo(coo);
+    }
+    build(properties);
+  }
+
+  /**
+   * @brief Copy a graph onto the device.
+   *
+   * @tparam space memory space of `_csr`.
+   * @param _csr graph in CSR.
+   * @param properties graph properties.
+   * @param device device the graph lives (and the queries run) on.
+   */
+  template <memory::memory_space_t space>
+  engine_t(format::csr_t<space, vertex_t, edge_t, weight_t> const& _csr,
+           graph::graph_properties_t properties = graph::graph_properties_t(),
+           gcuda::device_id_t device = 0)
+      : context(std::make_shared<gcuda::multi_context_t>(device)), csr(_csr) {
+    build(properties);
+  }
+
+  engine_t(engine_t const&) = delete;
+  engine_t& operator=(engine_t const&) = delete;
+
+  vertex_t get_number_of_vertices() const { return number_of_vertices; }
+  edge_t get_number_of_edges() const { return number_of_edges; }
+
+  /**
+   * @brief Breadth-first search from `source`, @see bfs::run().
+   *
+   * @param distances Device array of size number of vertices.
+   * @param predecessors Device array of size number of vertices (optional).
+   * @return float Time taken by the query (ms).
+   */
+  float bfs(vertex_t source,
+            vertex_t* distances,
+            vertex_t* predecessors = nullptr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    set_device();
+    check_vertex(source);
+    if (!bfs_worker)
+      bfs_worker = std::make_unique<detail::bfs_worker_t<graph_type>>(
+          context, *G);
+    return (*bfs_worker)(source, distances, predecessors);
+  }
+
+  /**
+   * @brief Single-source shortest path from `source`, @see sssp::run().
+   *
+   * @param distances Device array of size number of vertices.
+   * @param predecessors Device array of size number of vertices (optional).
+   * @param delta Delta-stepping bucket width, 0 for Bellman-Ford.
+   * @return float Time taken by the query (ms).
+   */
+  float sssp(vertex_t source,
+             weight_t* distances,
+             vertex_t* predecessors = nullptr,
+             weight_t delta = 0) {
+    std::lock_guard<std::mutex> lock(mutex);
+    set_device();
+    check_vertex(source);
+    if (!sssp_worker || sssp_worker->get_delta() != delta)
+      sssp_worker = std::make_unique<detail::sssp_worker_t<graph_type>>(
+          context, *G, delta);
+    return (*sssp_worker)(source, distances, predecessors);
+  }
+
+  /**
+   * @brief PageRank, @see pr::run().
+   *
+   * @param p Device array of size number of vertices.
+   * @return float Time taken by the query (ms).
+   */
+  float pr(weight_t* p, weight_t alpha = 0.85, weight_t tol = 1e-6) {
+    std::lock_guard<std::mutex> lock(mutex);
+    set_device();
+    if (!pr_worker)
+      pr_worker =
+          std::make_unique<detail::pr_worker_t<graph_type>>(context, *G);
+    return (*pr_worker)(alpha, tol, p);
+  }
+
+  /**
+   * @brief Personalized PageRank from `seed`, @see ppr::run().
+   *
+   * @param p Device array of size number of vertices.
+   * @return float Time taken by the query (ms).
+   */
+  float ppr(vertex_t seed,
+            weight_t* p,
+            weight_t alpha = 0.15,
+            weight_t epsilon = 1e-6) {
+    std::lock_guard<std::mutex> lock(mutex);
+    set_device();
+    check_vertex(seed);
+    if (!ppr_worker)
+      ppr_worker =
+          std::make_unique<detail::ppr_worker_t<graph_type>>(context, *G);
+    return (*ppr_worker)(seed, alpha, epsilon, p);
+  }
+
+ private:
+  void build(graph::graph_properties_t properties) {
+    G = std::make_unique<graph_type>(
+        graph::build<memory::memory_space_t::device>(properties, csr));
+    number_of_vertices = G->get_number_of_vertices();
+    number_of_edges = G->get_number_of_edges();
+  }
+
+  /**
+   * @brief Make the engine's device current on the calling thread, queries may
+   * come from threads that use (or default to) other devices.
+   */
+  void set_device() const {
+    gcuda::device::set(context->get_context(0)->ordinal());
+  }
+
+  void check_vertex(vertex_t v) const {
+    error::throw_if_exception(v < 0 || v >= number_of_vertices,
+                              "Vertex out of range.");
+  }
+
+  std::shared_ptr<gcuda::multi_context_t> context;
+  csr_type csr;
+  std::unique_ptr<graph_type> G;
+  vertex_t number_of_vertices = 0;
+  edge_t number_of_edges = 0;
+
+  std::mutex mutex;
+  std::unique_ptr<detail::bfs_worker_t<graph_type>> bfs_worker;
+  std::unique_ptr<detail::sssp_worker_t<graph_type>> sssp_worker;
+  std::unique_ptr<detail::pr_worker_t<graph_type>> pr_worker;
+  std::unique_ptr<detail::ppr_worker_t<graph_type>> ppr_worker;
+};
+
+}  // namespace service
+}  // namespace gunrock
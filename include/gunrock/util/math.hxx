@@ -128,6 +128,18 @@ __host__ __device__ __forceinline__ type_t exch(type_t* address, type_t value) {
 #endif
 }
 
+template <typename type_t>
+__host__ __device__ __forceinline__ type_t bit_or(type_t* address,
+                                                  type_t value) {
+#ifdef __CUDA_ARCH__
+  return atomicOr(address, value);
+#else
+  type_t old = *address;
+  *address = old | value;  // use std::atomic;
+  return old;
+#endif
+}
+
 }  // namespace atomic
 }  // namespace math
 }  // namespace gunrock
\ No newline at end of file
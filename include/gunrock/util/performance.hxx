@@ -21,7 +21,7 @@ using vertex_t = int;
 using edge_t = int;
 
 // Date JSON schema was last updated
-std::string schema_version = "2022-10-28";
+std::string schema_version = "2026-10-14";
 
 class system_info_t {
  private:
@@ -181,8 +181,8 @@ void export_performance_stats(
 
   // Include additional stats if this is a full performance run
   std::vector<int> search_depths;
-  std::vector<unsigned int> nodes_visited;
-  std::vector<unsigned int> edges_visited;
+  std::vector<benchmark::counter_t> nodes_visited;
+  std::vector<benchmark::counter_t> edges_visited;
 
 #if ESSENTIALS_COLLECT_METRICS
   int avg_search_depth;
@@ -200,15 +200,13 @@ void export_performance_stats(
 
   std::transform(benchmark_metrics.begin(), benchmark_metrics.end(),
                  std::back_inserter(nodes_visited),
-                 [](benchmark::host_benchmark_t const& b) -> unsigned int {
-                   return b.vertices_visited;
-                 });
+                 [](benchmark::host_benchmark_t const& b)
+                     -> benchmark::counter_t { return b.vertices_visited; });
 
   std::transform(benchmark_metrics.begin(), benchmark_metrics.end(),
                  std::back_inserter(edges_visited),
-                 [](benchmark::host_benchmark_t const& b) -> unsigned int {
-                   return b.edges_visited;
-                 });
+                 [](benchmark::host_benchmark_t const& b)
+                     -> benchmark::counter_t { return b.edges_visited; });
 
   // Get average search depth
   avg_search_depth =
@@ -245,6 +243,45 @@ void export_performance_stats(
                                                      min_search_depth));
   jsn.push_back(nlohmann::json::object_t::value_type("max_search_depth",
                                                      max_search_depth));
+  // Direction and load-balancing technique of every advance (run and
+  // requested).
+  auto to_json = [](std::vector<benchmark::advance_record_t> const& records) {
+    nlohmann::json advances = nlohmann::json::array();
+    for (auto const& r : records)
+      advances.push_back(
+          {{"direction", operators::advance_direction_name(r.direction)},
+           {"load_balance", operators::load_balance_name(r.load_balance)},
+           {"requested_direction",
+            operators::advance_direction_name(r.requested_direction)},
+           {"requested_load_balance",
+            operators::load_balance_name(r.requested_load_balance)}});
+    return advances;
+  };
+
+  // Per-iteration records of each run.
+  std::vector<nlohmann::json> iterations;
+  for (auto const& b : benchmark_metrics) {
+    nlohmann::json run = nlohmann::json::array();
+    for (auto const& record : b.iterations) {
+      run.push_back({{"iteration", record.iteration},
+                     {"input_size", record.input_size},
+                     {"output_size", record.output_size},
+                     {"edges_visited", record.edges_visited},
+                     {"vertices_visited", record.vertices_visited},
+                     {"elapsed", record.elapsed},
+                     {"advances", to_json(record.advances)}});
+    }
+    iterations.push_back(run);
+  }
+
+  jsn.push_back(nlohmann::json::object_t::value_type("iterations", iterations));
+
+  // Advances of each run.
+  std::vector<nlohmann::json> advances;
+  for (auto const& b : benchmark_metrics)
+    advances.push_back(to_json(b.advances));
+
+  jsn.push_back(nlohmann::json::object_t::value_type("advances", advances));
   jsn.push_back(nlohmann::json::object_t::value_type("mteps", mteps));
   jsn.push_back(nlohmann::json::object_t::value_type("avg_mteps", avg_mteps));
   jsn.push_back(nlohmann::json::object_t::value_type("min_mteps", min_mteps));
@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 #include <cuda.h>
 #include <gunrock/error.hxx>
 
@@ -210,5 +211,37 @@ class striped_memory_mapper_t {
   }
 };
 
+/**
+ * @brief Array of `size` elements striped in equal, contiguous chunks across
+ * `devices` and mapped into one virtual address range accessible (read-write)
+ * from all of them. Device `devices[i]` holds the elements
+ * `[i * elements_per_partition(), (i + 1) * elements_per_partition())`.
+ *
+ * @note The striped memory mapper places the stripe of a device at the offset
+ * of its ordinal, so `devices` must be `{0, 1, ..., n - 1}`.
+ *
+ * @tparam type_t Element type.
+ */
+template <typename type_t>
+class striped_array_t {
+  // Destroyed in reverse order: unmap, free the range, release the memory.
+  physical_memory_t<type_t> phys;
+  virtual_memory_t<type_t> virt;
+  striped_memory_mapper_t<type_t> map;
+
+ public:
+  striped_array_t(std::size_t size, const std::vector<int>& devices)
+      : phys(size * sizeof(type_t), devices),
+        virt(phys.padded_size),
+        map(virt, phys, devices) {}
+
+  striped_array_t(const striped_array_t& rhs) = delete;
+  striped_array_t& operator=(const striped_array_t& rhs) = delete;
+
+  type_t* data() { return map.data(); }
+  std::size_t size() { return map.number_of_elements(); }
+  std::size_t elements_per_partition() { return map.elements_per_partition(); }
+};
+
 }  // namespace memory
 }  // namespace gunrock
\ No newline at end of file
@@ -0,0 +1,80 @@
+/**
+ * @file bc.cuh
+ * @brief Unit test for the approximate (sampled, batched sources)
+ * betweenness centrality.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/algorithms/bc.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, bc_approximate) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // Riondato-Kornaropoulos bound: 0.5 / 0.1^2 * (floor(log2(8)) + 1 + ln 10).
+  EXPECT_EQ(bc::approximate::sample_size(0.1, 0.1, 10), 316);
+
+  // An (undirected) 20 x 20 grid, with a few unreachable vertices.
+  int side = 20;
+  int n = side * side + 3;
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    if (v >= side * side)
+      continue;
+    int x = v % side, y = v / side;
+    for (int u : {v - side, v - 1, v + 1, v + side}) {
+      bool neighbor = (u == v - side && y > 0) || (u == v - 1 && x > 0) ||
+                      (u == v + 1 && x < side - 1) ||
+                      (u == v + side && y < side - 1);
+      if (neighbor) {
+        h_csr.column_indices.push_back(u);
+        h_csr.nonzero_values.push_back(1);
+      }
+    }
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  graph::graph_properties_t properties;
+  properties.directed = false;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  thrust::device_vector<float> exact(n);
+  bc::run(G, exact.data().get());
+
+  // Sampling every vertex, in batches that do not divide them, is exact.
+  thrust::device_vector<float> approximate(n);
+  bc::approximate::sampling_t sampling;
+  sampling.number_of_samples = n;
+  sampling.batch_size = 7;
+  bc::approximate::run(G, approximate.data().get(), sampling);
+
+  thrust::host_vector<float> h_exact = exact;
+  thrust::host_vector<float> h_approximate = approximate;
+  for (int v = 0; v < n; ++v)
+    EXPECT_NEAR(h_approximate[v], h_exact[v], 1e-3f * (1 + h_exact[v]))
+        << "vertex " << v;
+
+  // A sample: the total is an unbiased estimate, off by a few percent here.
+  sampling.number_of_samples = 100;
+  sampling.batch_size = 32;
+  bc::approximate::run(G, approximate.data().get(), sampling);
+  h_approximate = approximate;
+  double total_exact = 0, total_approximate = 0;
+  for (int v = 0; v < n; ++v) {
+    total_exact += h_exact[v];
+    total_approximate += h_approximate[v];
+  }
+  EXPECT_NEAR(total_approximate / total_exact, 1.0, 0.2);
+}
@@ -0,0 +1,128 @@
+/**
+ * @file bfs.cuh
+ * @brief Unit tests for the direction-optimized (push-pull) BFS, whose dense
+ * frontiers are pulled from the enactor's bitmaps, and for the multi-GPU BFS
+ * over partitioned distances.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/algorithms/bfs.hxx>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+TEST(algorithm, bfs_direction_optimized) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // A ring, plus 8 pseudo-random out-edges per vertex: the frontier grows
+  // about 8x per level, such that the middle levels are pulled.
+  int n = 20000;
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    h_csr.column_indices.push_back((v + 1) % n);
+    for (int j = 0; j < 8; ++j)
+      h_csr.column_indices.push_back((v * 7 + j * 1237 + 13) % n);
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+  h_csr.nonzero_values.resize(h_csr.number_of_nonzeros, 1);
+
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  format::csc_t<memory_space_t::device, int, int, float> csc;
+  csc.from_csr(csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csc, csr);
+  auto G_push = graph::build<memory_space_t::device>(properties, csr);
+
+  int source = 0;
+  thrust::device_vector<int> distances(n);
+
+  // Reference: push-only.
+  bfs::run(G_push, source, distances.data().get(), (int*)nullptr);
+  thrust::host_vector<int> expected = distances;
+
+  bfs::run(G, source, distances.data().get(), (int*)nullptr);
+  thrust::host_vector<int> h_distances = distances;
+  for (int v = 0; v < n; ++v) {
+    ASSERT_LT(expected[v], n) << "vertex " << v;
+    ASSERT_EQ(h_distances[v], expected[v]) << "vertex " << v;
+  }
+}
+
+TEST(algorithm, bfs_multi_gpu) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // A ring with chords, such that most edges cross the partitions.
+  int n = 10000;
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    h_csr.column_indices.push_back((v + 1) % n);
+    for (int j = 0; j < 3; ++j)
+      h_csr.column_indices.push_back((v * 13 + j * 4099 + 7) % n);
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+  h_csr.nonzero_values.resize(h_csr.number_of_nonzeros, 1);
+
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+  using graph_t = decltype(G);
+
+  int source = n - 1;
+  thrust::device_vector<int> distances(n);
+
+  // Reference: single-GPU.
+  bfs::run(G, source, distances.data().get(), (int*)nullptr);
+  thrust::host_vector<int> expected = distances;
+
+  using param_type = bfs::param_t<int>;
+  using result_type = bfs::result_t<int>;
+  using problem_type = bfs::problem_t<graph_t, param_type, result_type>;
+
+  // One device (the degenerate partition), and two if present (G is read
+  // from its device's memory by the other one).
+  int n_devices = 0;
+  cudaGetDeviceCount(&n_devices);
+  std::vector<thrust::host_vector<gcuda::device_id_t>> device_sets(1);
+  device_sets[0].push_back(0);
+  if (n_devices >= 2)
+    device_sets.push_back(thrust::host_vector<gcuda::device_id_t>(
+        std::vector<gcuda::device_id_t>{0, 1}));
+
+  for (auto& devices : device_sets) {
+    auto context = std::make_shared<gcuda::multi_context_t>(devices);
+    thrust::fill(distances.begin(), distances.end(), -1);
+
+    param_type param(source);
+    result_type result(distances.data().get(), (int*)nullptr);
+    problem_type problem(G, param, result, context);
+    problem.init();
+    problem.reset();
+
+    bfs::multi_gpu_enactor_t<problem_type> enactor(&problem, context);
+    enactor.enact();
+
+    thrust::host_vector<int> h_distances = distances;
+    for (int v = 0; v < n; ++v) {
+      ASSERT_LT(expected[v], n) << "vertex " << v;
+      ASSERT_EQ(h_distances[v], expected[v])
+          << "vertex " << v << " (" << devices.size() << " devices)";
+    }
+  }
+}
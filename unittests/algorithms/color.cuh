@@ -0,0 +1,75 @@
+/**
+ * @file color.cuh
+ * @brief Unit test for graph coloring (Jones-Plassmann-Luby and speculative).
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/algorithms/color.hxx>
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, color) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // (Undirected) graph with a few hubs, a clique and isolated vertices.
+  int n = 5000;
+  std::vector<std::set<int>> adjacency(n);
+  auto connect = [&](int u, int v) {
+    if (u == v)
+      return;
+    adjacency[u].insert(v);
+    adjacency[v].insert(u);
+  };
+  for (int v = 0; v < n - 10; ++v) {
+    connect(v, (v * 7919 + 13) % (n - 10));
+    connect(v, (v + 1) % (n - 10));
+    connect(v, v % 4);
+  }
+  for (int u = 100; u < 170; ++u)
+    for (int v = u + 1; v < 170; ++v)
+      connect(u, v);
+
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    for (int u : adjacency[v]) {
+      h_csr.column_indices.push_back(u);
+      h_csr.nonzero_values.push_back(1);
+    }
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  graph::graph_properties_t properties;
+  properties.directed = false;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  thrust::device_vector<int> colors(n);
+  for (auto mode : {color::mode_t::jpl, color::mode_t::speculative}) {
+    color::run(G, colors.data().get(), mode);
+
+    thrust::host_vector<int> h_colors = colors;
+    for (int v = 0; v < n; ++v) {
+      ASSERT_TRUE(gunrock::util::limits::is_valid(h_colors[v]))
+          << "vertex " << v;
+      for (int u : adjacency[v])
+        ASSERT_NE(h_colors[v], h_colors[u]) << "edge " << v << " " << u;
+    }
+
+    // First-fit never needs more than the maximum degree plus one colors.
+    if (mode == color::mode_t::speculative)
+      for (int v = 0; v < n; ++v)
+        EXPECT_LE(h_colors[v], int(adjacency[v].size())) << "vertex " << v;
+  }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file kcore.cuh
+ * @brief Unit test for the bucketed peeling k-core decomposition.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/algorithms/kcore.hxx>
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, kcore) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // (Undirected) cliques of 2 to 30 vertices chained by single edges, chords
+  // between them and a few isolated vertices.
+  std::vector<std::set<int>> adjacency;
+  auto connect = [&](int u, int v) {
+    if (u == v)
+      return;
+    adjacency[u].insert(v);
+    adjacency[v].insert(u);
+  };
+  int previous = -1;
+  for (int size = 2; size <= 30; ++size) {
+    int first = adjacency.size();
+    adjacency.resize(first + size);
+    for (int u = first; u < first + size; ++u)
+      for (int v = u + 1; v < first + size; ++v)
+        connect(u, v);
+    if (previous >= 0)
+      connect(previous, first);
+    previous = first + size - 1;
+  }
+  int n = adjacency.size() + 5;
+  adjacency.resize(n);
+  for (int v = 0; v + 97 < n - 5; v += 13)
+    connect(v, v + 97);
+
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    for (int u : adjacency[v]) {
+      h_csr.column_indices.push_back(u);
+      h_csr.nonzero_values.push_back(1);
+    }
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+
+  // Reference: sequential peeling of a minimum degree vertex.
+  std::vector<int> expected(n), degree(n);
+  std::set<std::pair<int, int>> queue;
+  for (int v = 0; v < n; ++v) {
+    degree[v] = adjacency[v].size();
+    queue.insert({degree[v], v});
+  }
+  int k = 0;
+  while (!queue.empty()) {
+    auto [d, v] = *queue.begin();
+    queue.erase(queue.begin());
+    k = std::max(k, d);
+    expected[v] = k;
+    for (int u : adjacency[v])
+      if (queue.erase({degree[u], u}))
+        queue.insert({--degree[u], u});
+  }
+
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  graph::graph_properties_t properties;
+  properties.directed = false;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  thrust::device_vector<int> k_cores(n);
+  kcore::run(G, k_cores.data().get());
+
+  thrust::host_vector<int> h_k_cores = k_cores;
+  for (int v = 0; v < n; ++v)
+    EXPECT_EQ(h_k_cores[v], expected[v]) << "vertex " << v;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file pr.cuh
+ * @brief Unit tests for the pull (CSC gather) PageRank, with its captured
+ * iteration replayed on every neighborreduce row kernel, and for the
+ * residual-push PageRank.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/algorithms/pr.hxx>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+TEST(algorithm, pr_pull) {
+  using namespace gunrock;
+  using namespace memory;
+  using kernel_t = operators::neighborreduce::kernel_t;
+
+  // Out-edges to neighbors and (40 parallel edges each) to a hub of in-degree
+  // above 32 * 1024, a gather the automatic plan gives to merge-path and which
+  // spans many of its blocks, and a few dangling vertices.
+  int n = 1000;
+  int hub = 5;
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    if (v % 97 == 0)
+      continue;
+    for (int i = 1; i <= v % 4; ++i) {
+      h_csr.column_indices.push_back((v + i * 31) % n);
+      h_csr.nonzero_values.push_back(1);
+    }
+    for (int i = 0; (v != hub) && (i < 40); ++i) {
+      h_csr.column_indices.push_back(hub);
+      h_csr.nonzero_values.push_back(1);
+    }
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  format::csc_t<memory_space_t::device, int, int, float> csc;
+  csc.from_csr(csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csc, csr);
+  auto G_push = graph::build<memory_space_t::device>(properties, csr);
+
+  gcuda::multi_context_t context(0);
+  auto plan = operators::neighborreduce::make_plan<float>(
+      G.get_column_offsets(), G.get_number_of_vertices(),
+      G.get_number_of_edges(), context);
+  ASSERT_EQ(plan.kernel, kernel_t::merge_path);
+  ASSERT_GT(plan.merge_path_blocks, std::size_t(1));
+
+  float alpha = 0.85;
+  float tol = 1e-6;
+  thrust::device_vector<float> p(n);
+
+  // Reference: the scatter (atomics) power iteration.
+  pr::run(G_push, alpha, tol, p.data().get());
+  thrust::host_vector<float> expected = p;
+
+  for (auto kernel : {kernel_t::merge_path, kernel_t::csr_vector,
+                      kernel_t::automatic}) {
+    thrust::fill(p.begin(), p.end(), 0);
+    pr::run_pull(G, alpha, tol, p.data().get(), kernel);
+    thrust::host_vector<float> h_p = p;
+    for (int v = 0; v < n; ++v)
+      ASSERT_NEAR(h_p[v], expected[v], 1e-5)
+          << "vertex " << v << " (kernel " << int(kernel) << ")";
+  }
+}
+
+TEST(algorithm, pr_push) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // Weighted out-edges of varying degree, and a few dangling vertices.
+  int n = 2000;
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    if (v % 89 == 0)
+      continue;
+    for (int i = 0; i <= v % 6; ++i) {
+      h_csr.column_indices.push_back((v * 11 + i * 37 + 3) % n);
+      h_csr.nonzero_values.push_back(1 + (v + i) % 4);
+    }
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  float alpha = 0.85;
+  float tol = 1e-6;
+  thrust::device_vector<float> p(n);
+
+  // Reference: the power iteration, to a tighter tolerance than the push's
+  // bound (tol / (1 - alpha) in L1).
+  pr::run(G, alpha, 1e-8f, p.data().get());
+  thrust::host_vector<float> expected = p;
+
+  thrust::fill(p.begin(), p.end(), 0);
+  pr::run_push(G, alpha, tol, p.data().get());
+  thrust::host_vector<float> h_p = p;
+
+  float l1 = 0;
+  for (int v = 0; v < n; ++v) {
+    ASSERT_NEAR(h_p[v], expected[v], 1e-5) << "vertex " << v;
+    l1 += std::abs(h_p[v] - expected[v]);
+  }
+  EXPECT_LT(l1, 1e-5 / (1 - alpha));
+}
@@ -0,0 +1,95 @@
+/**
+ * @file spgemm.cuh
+ * @brief Unit test for the two-pass (symbolic/numeric) SpGEMM, with rows in
+ * every bin (shared memory hash tables and expand-sort-compress), for single
+ * and double precision values.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/algorithms/spgemm.hxx>
+
+#include <map>
+
+#include <gtest/gtest.h>
+
+template <typename weight_t>
+void test_spgemm() {
+  using namespace gunrock;
+  using namespace memory;
+  using h_csr_t = format::csr_t<memory_space_t::host, int, int, weight_t>;
+
+  // A: rows of 0 to 13 nonzeros, and one dense row. B: rows of 0 to 49
+  // nonzeros, and one dense row; the products per row of C cover every bin.
+  int n = 3000;
+  auto make = [&](int dense_row, int modulo, int stride) {
+    h_csr_t m;
+    m.number_of_rows = n;
+    m.number_of_columns = n;
+    for (int v = 0; v < n; ++v) {
+      m.row_offsets.push_back(m.column_indices.size());
+      int length = (v == dense_row) ? n : (v % modulo);
+      for (int i = 0; i < length; ++i) {
+        m.column_indices.push_back((length == n) ? i : (v + i * stride) % n);
+        m.nonzero_values.push_back(weight_t((v + i) % 3) - 1);
+      }
+    }
+    m.row_offsets.push_back(m.column_indices.size());
+    m.number_of_nonzeros = m.column_indices.size();
+    return m;
+  };
+  h_csr_t h_a = make(7, 14, 37);
+  h_csr_t h_b = make(11, 50, 61);
+
+  // Reference (the values are small integers, the sums are exact).
+  std::vector<std::map<int, weight_t>> expected(n);
+  for (int r = 0; r < n; ++r)
+    for (int a = h_a.row_offsets[r]; a < h_a.row_offsets[r + 1]; ++a) {
+      int k = h_a.column_indices[a];
+      for (int b = h_b.row_offsets[k]; b < h_b.row_offsets[k + 1]; ++b)
+        expected[r][h_b.column_indices[b]] +=
+            h_a.nonzero_values[a] * h_b.nonzero_values[b];
+    }
+
+  format::csr_t<memory_space_t::device, int, int, weight_t> a_csr(h_a);
+  format::csr_t<memory_space_t::device, int, int, weight_t> b_csr(h_b);
+  graph::graph_properties_t properties;
+  auto A = graph::build<memory_space_t::device>(properties, a_csr);
+  auto B = graph::build<memory_space_t::device>(properties, b_csr);
+
+  format::csr_t<memory_space_t::device, int, int, weight_t> C;
+  spgemm::run(A, B, C);
+
+  thrust::host_vector<int> offsets = C.row_offsets;
+  thrust::host_vector<int> columns = C.column_indices;
+  thrust::host_vector<weight_t> values = C.nonzero_values;
+
+  ASSERT_EQ(C.number_of_rows, n);
+  ASSERT_EQ(C.number_of_columns, n);
+  ASSERT_EQ(offsets.size(), n + 1);
+  ASSERT_EQ(C.number_of_nonzeros, offsets[n]);
+  ASSERT_EQ(columns.size(), offsets[n]);
+  for (int r = 0; r < n; ++r) {
+    ASSERT_EQ(offsets[r + 1] - offsets[r], int(expected[r].size()))
+        << "row " << r;
+    int e = offsets[r];
+    for (auto const& [column, value] : expected[r]) {
+      EXPECT_EQ(columns[e], column) << "row " << r;
+      EXPECT_EQ(values[e], value) << "row " << r;
+      ++e;
+    }
+  }
+}
+
+TEST(algorithm, spgemm) {
+  test_spgemm<float>();
+}
+
+// Wider values halve the largest shared memory bin.
+TEST(algorithm, spgemm_double) {
+  test_spgemm<double>();
+}
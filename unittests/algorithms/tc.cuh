@@ -12,6 +12,8 @@
 #include <gunrock/formats/formats.hxx>
 #include <gunrock/algorithms/tc.hxx>
 
+#include <gtest/gtest.h>
+
 using namespace gunrock;
 using namespace memory;
 
@@ -27,14 +29,17 @@ TEST(algorithm, tc) {
 
   vertex_t number_of_rows = 4, number_of_columns = 4;
   edge_t number_of_nonzeros = 10;
-  thrust::device_vector<edge_t> Ap = std::vector{0, 3, 5, 8, 10};
-  thrust::device_vector<vertex_t> Aj =
-      std::vector{1, 2, 3, 0, 2, 0, 1, 3, 0, 2};
-  thrust::device_vector<weight_t> Ax(number_of_nonzeros, 0);
-
-  auto G = graph::build::from_csr<memory_space_t::device, graph::view_t::csr>(
-      number_of_rows, number_of_columns, number_of_nonzeros, Ap.data().get(),
-      Aj.data().get(), Ax.data().get());
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.number_of_rows = number_of_rows;
+  h_csr.number_of_columns = number_of_columns;
+  h_csr.number_of_nonzeros = number_of_nonzeros;
+  h_csr.row_offsets = std::vector{0, 3, 5, 8, 10};
+  h_csr.column_indices = std::vector{1, 2, 3, 0, 2, 0, 1, 3, 0, 2};
+  h_csr.nonzero_values = std::vector<weight_t>(number_of_nonzeros, 0);
+
+  format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr(h_csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
 
   std::size_t total_triangles = 0;
   thrust::device_vector<vertex_t> d_triangles_count(number_of_rows, 0);
@@ -65,14 +70,17 @@ TEST(algorithm, tc_self_loop_vertex) {
 
   vertex_t number_of_rows = 4, number_of_columns = 4;
   edge_t number_of_nonzeros = 12;
-  thrust::device_vector<edge_t> Ap = std::vector{0, 4, 7, 10, 12};
-  thrust::device_vector<vertex_t> Aj =
-      std::vector{0, 1, 2, 3, 0, 1, 2, 0, 1, 3, 0, 2};
-  thrust::device_vector<weight_t> Ax(number_of_nonzeros, 0);
-
-  auto G = graph::build::from_csr<memory_space_t::device, graph::view_t::csr>(
-      number_of_rows, number_of_columns, number_of_nonzeros, Ap.data().get(),
-      Aj.data().get(), Ax.data().get());
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.number_of_rows = number_of_rows;
+  h_csr.number_of_columns = number_of_columns;
+  h_csr.number_of_nonzeros = number_of_nonzeros;
+  h_csr.row_offsets = std::vector{0, 4, 7, 10, 12};
+  h_csr.column_indices = std::vector{0, 1, 2, 3, 0, 1, 2, 0, 1, 3, 0, 2};
+  h_csr.nonzero_values = std::vector<weight_t>(number_of_nonzeros, 0);
+
+  format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr(h_csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
 
   std::size_t total_triangles = 0;
   thrust::device_vector<vertex_t> d_triangles_count(number_of_rows, 0);
@@ -90,3 +98,94 @@ TEST(algorithm, tc_self_loop_vertex) {
 
   EXPECT_EQ(total_triangles, reference_total_triangles);
 }
+
+TEST(algorithm, tc_clique) {
+  // Complete graph on 40 vertices, the oriented degrees range over 0..39 such
+  // that both the warp and the hash intersections are used.
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = int;
+
+  vertex_t n = 40;
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (vertex_t u = 0; u < n; u++) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    for (vertex_t v = 0; v < n; v++)
+      if (u != v)
+        h_csr.column_indices.push_back(v);
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+  h_csr.nonzero_values.resize(h_csr.number_of_nonzeros, 0);
+
+  format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr(h_csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  std::size_t total_triangles = 0;
+  thrust::device_vector<vertex_t> d_triangles_count(n, 0);
+  tc::run(G, true, d_triangles_count.data().get(), &total_triangles);
+
+  thrust::host_vector<vertex_t> h_triangles_count(d_triangles_count);
+  for (vertex_t v = 0; v < n; v++)
+    EXPECT_EQ(h_triangles_count[v], (n - 1) * (n - 2) / 2);
+
+  EXPECT_EQ(total_triangles, std::size_t(n) * (n - 1) * (n - 2) / 2);
+}
+
+TEST(algorithm, tc_bitmap) {
+  // Clique on k vertices, each of them with v % 3 pendant leaves: the clique
+  // vertices without leaves come first in the degree ordering, vertex 0 has
+  // an oriented degree of k - 1 > 1024 and is intersected with a bitmap, the
+  // hash and warp intersections take the other clique vertices.
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = int;
+
+  vertex_t k = 1100;
+  ASSERT_GT(std::size_t(k - 1), tc::detail::hash_degree);
+
+  std::vector<std::vector<vertex_t>> neighbors(k);
+  for (vertex_t u = 0; u < k; u++)
+    for (vertex_t v = 0; v < k; v++)
+      if (u != v)
+        neighbors[u].push_back(v);
+  for (vertex_t u = 0; u < k; u++) {
+    for (vertex_t i = 0; i < u % 3; i++) {
+      vertex_t leaf = neighbors.size();
+      neighbors[u].push_back(leaf);
+      neighbors.push_back({u});
+    }
+  }
+
+  vertex_t n = neighbors.size();
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (vertex_t u = 0; u < n; u++) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    for (auto v : neighbors[u])
+      h_csr.column_indices.push_back(v);
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+  h_csr.nonzero_values.resize(h_csr.number_of_nonzeros, 0);
+
+  format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr(h_csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  std::size_t total_triangles = 0;
+  thrust::device_vector<vertex_t> d_triangles_count(n, 0);
+  tc::run(G, true, d_triangles_count.data().get(), &total_triangles);
+
+  thrust::host_vector<vertex_t> h_triangles_count(d_triangles_count);
+  vertex_t clique_count = (k - 1) * (k - 2) / 2;
+  for (vertex_t v = 0; v < n; v++)
+    EXPECT_EQ(h_triangles_count[v], (v < k) ? clique_count : 0)
+        << "vertex " << v;
+
+  EXPECT_EQ(total_triangles, std::size_t(k) * clique_count);
+}
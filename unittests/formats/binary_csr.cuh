@@ -0,0 +1,67 @@
+/**
+ * @file binary_csr.cuh
+ * @brief Unit test for the binary CSR container (write, read and mapping).
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+
+#include <gunrock/formats/formats.hxx>
+
+#include <thrust/host_vector.h>
+
+#include <gtest/gtest.h>
+
+TEST(formats, binary_csr) {
+  using namespace gunrock;
+  using namespace memory;
+
+  using host_csr_t = format::csr_t<memory_space_t::host, int, int, float>;
+  using device_csr_t = format::csr_t<memory_space_t::device, int, int, float>;
+
+  // 0 -> {1, 2}, 1 -> {2}, 2 -> {}
+  host_csr_t csr(3, 3, 3);
+  csr.row_offsets[0] = 0;
+  csr.row_offsets[1] = 2;
+  csr.row_offsets[2] = 3;
+  csr.row_offsets[3] = 3;
+  csr.column_indices[0] = 1;
+  csr.column_indices[1] = 2;
+  csr.column_indices[2] = 2;
+  csr.nonzero_values[0] = 0.5f;
+  csr.nonzero_values[1] = 1.5f;
+  csr.nonzero_values[2] = 2.5f;
+
+  std::string filename = "binary_csr_unittest.csr";
+  csr.write_binary(filename);
+
+  // Host read.
+  host_csr_t host;
+  host.read_binary(filename, true);
+  EXPECT_EQ(host.number_of_nonzeros, 3);
+  EXPECT_EQ(host.row_offsets, csr.row_offsets);
+  EXPECT_EQ(host.column_indices, csr.column_indices);
+  EXPECT_EQ(host.nonzero_values, csr.nonzero_values);
+
+  // Device read (staged).
+  device_csr_t device;
+  device.read_binary(filename, true);
+  thrust::host_vector<int> indices = device.column_indices;
+  EXPECT_EQ(indices, csr.column_indices);
+
+  // Zero-copy mapping.
+  format::mapped_csr_t<int, int, float> mapped(filename);
+  mapped.verify();
+  EXPECT_EQ(mapped.number_of_rows, 3);
+  EXPECT_EQ(mapped.row_offsets[1], 2);
+  EXPECT_EQ(mapped.nonzero_values[2], 2.5f);
+
+  // Mismatching types are rejected.
+  format::csr_t<memory_space_t::host, int, long, double> other;
+  EXPECT_ANY_THROW(other.read_binary(filename));
+
+  std::remove(filename.c_str());
+}
@@ -0,0 +1,54 @@
+/**
+ * @file frontier.cuh
+ * @brief Unit test for the bitmap frontier and the sparse (vector) to dense
+ * (bitmap) frontier conversions.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/framework/frontier/frontier.hxx>
+
+#include <thrust/host_vector.h>
+
+#include <gtest/gtest.h>
+
+TEST(frontier, bitmap_conversion) {
+  using namespace gunrock::frontier;
+  using vector_frontier_t = frontier_t<int, int>;
+  using bitmap_frontier_t =
+      frontier_t<int, int, frontier_kind_t::vertex_frontier,
+                 frontier_view_t::bitmap>;
+
+  // Sparse frontier with duplicates and an invalid element.
+  vector_frontier_t X;
+  X.push_back(40);
+  X.push_back(3);
+  X.push_back(40);
+  X.push_back(gunrock::numeric_limits<int>::invalid());
+  X.push_back(0);
+  X.push_back(33);
+
+  bitmap_frontier_t B(64);
+  EXPECT_TRUE(B.is_empty());
+
+  B.from_vector(X);
+  EXPECT_FALSE(B.is_empty());
+  EXPECT_EQ(B.get_number_of_elements(), (std::size_t)4);
+
+  B.to_vector(X);
+  ASSERT_EQ(X.get_number_of_elements(), (std::size_t)4);
+
+  thrust::host_vector<int> h_X(thrust::device_pointer_cast(X.begin()),
+                               thrust::device_pointer_cast(X.end()));
+  EXPECT_EQ(h_X[0], 0);
+  EXPECT_EQ(h_X[1], 3);
+  EXPECT_EQ(h_X[2], 33);
+  EXPECT_EQ(h_X[3], 40);
+
+  B.fill(1);
+  EXPECT_EQ(B.get_number_of_elements(), (std::size_t)64);
+  B.fill(0);
+  EXPECT_TRUE(B.is_empty());
+}
@@ -0,0 +1,91 @@
+/**
+ * @file service.cuh
+ * @brief Unit test for the graph analytics engine (queries reusing a
+ * resident graph and warm algorithm state).
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/service/engine.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(framework, service_engine) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // A (directed) ring with chords and unit weights.
+  int n = 2000;
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(h_csr.column_indices.size());
+    for (int u : {(v + 1) % n, (v + 37) % n}) {
+      h_csr.column_indices.push_back(u);
+      h_csr.nonzero_values.push_back(1);
+    }
+  }
+  h_csr.row_offsets.push_back(h_csr.column_indices.size());
+  h_csr.number_of_nonzeros = h_csr.column_indices.size();
+
+  graph::graph_properties_t properties;
+  properties.directed = true;
+  service::engine_t<> engine(h_csr, properties);
+  ASSERT_EQ(engine.get_number_of_vertices(), n);
+  ASSERT_EQ(engine.get_number_of_edges(), 2 * n);
+
+  // Reference runs on a separately built graph.
+  format::csr_t<memory_space_t::device, int, int, float> csr(h_csr);
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  thrust::device_vector<int> distances(n), expected(n);
+  thrust::device_vector<float> weights(n), expected_weights(n);
+  for (int source : {0, 1234, 7, 0}) {
+    engine.bfs(source, distances.data().get());
+    bfs::run(G, source, expected.data().get(), (int*)nullptr);
+    thrust::host_vector<int> h_distances = distances;
+    thrust::host_vector<int> h_expected = expected;
+    for (int v = 0; v < n; ++v)
+      ASSERT_EQ(h_distances[v], h_expected[v]) << "bfs " << source;
+
+    engine.sssp(source, weights.data().get());
+    thrust::host_vector<float> h_weights = weights;
+    for (int v = 0; v < n; ++v)
+      ASSERT_EQ(h_weights[v], float(h_expected[v])) << "sssp " << source;
+  }
+
+  // Changing the delta-stepping width rebuilds the worker.
+  engine.sssp(5, weights.data().get(), nullptr, 4.0f);
+  engine.bfs(5, distances.data().get());
+  thrust::host_vector<float> h_weights = weights;
+  thrust::host_vector<int> h_distances = distances;
+  for (int v = 0; v < n; ++v)
+    ASSERT_EQ(h_weights[v], float(h_distances[v]));
+
+  // PageRank of a regular graph is uniform, twice (warm).
+  thrust::device_vector<float> p(n);
+  for (int i = 0; i < 2; ++i) {
+    engine.pr(p.data().get(), 0.85f, 1e-6f);
+    thrust::host_vector<float> h_p = p;
+    for (int v = 0; v < n; ++v)
+      ASSERT_NEAR(h_p[v], 1.0f / n, 1e-6f);
+  }
+
+  // Personalized PageRank, warm and after a change of alpha.
+  thrust::device_vector<float> q(n);
+  for (float alpha : {0.15f, 0.15f, 0.3f}) {
+    int seed = 3;
+    float epsilon = 1e-6f;
+    engine.ppr(seed, p.data().get(), alpha, epsilon);
+    ppr::run(G, seed, q.data().get(), alpha, epsilon);
+    thrust::host_vector<float> h_p = p;
+    thrust::host_vector<float> h_q = q;
+    for (int v = 0; v < n; ++v)
+      ASSERT_NEAR(h_p[v], h_q[v], 1e-6f) << "ppr alpha " << alpha;
+  }
+
+  EXPECT_THROW(engine.bfs(n, distances.data().get()), std::exception);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file streaming.cuh
+ * @brief Unit test for streaming graphs from managed memory.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/bfs.hxx>
+#include <gunrock/framework/streaming.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(framework, streaming) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // A ring, in managed memory.
+  int n = 4096;
+  format::csr_t<memory_space_t::host, int, int, float> h_csr;
+  h_csr.number_of_rows = n;
+  h_csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    h_csr.row_offsets.push_back(v);
+    h_csr.column_indices.push_back((v + 1) % n);
+    h_csr.nonzero_values.push_back(1);
+  }
+  h_csr.row_offsets.push_back(n);
+  h_csr.number_of_nonzeros = n;
+
+  format::csr_t<memory_space_t::managed, int, int, float> csr(h_csr);
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::managed>(properties, csr);
+
+  // 8 bytes per edge, 128 edges per chunk and a budget of 4 chunks.
+  using graph_t = decltype(G);
+  streaming::prefetcher_t<graph_t> prefetcher;
+  prefetcher.init(G, 0, 1024, 4 * 1024);
+  EXPECT_EQ(prefetcher.get_number_of_chunks(), 32);
+
+  using frontier_t = frontier::frontier_t<int, int>;
+  frontier_t f;
+  f.push_back(0);
+  f.push_back(127);
+  f.push_back(128);
+  f.push_back(4095);
+  f.push_back(gunrock::numeric_limits<int>::invalid());
+  prefetcher.prefetch(&f, 0);
+  EXPECT_EQ(prefetcher.get_number_of_resident_chunks(), 3);
+
+  // Evicts (at least) the least recently used chunks to stay in the budget.
+  frontier_t g;
+  for (int v = 1024; v < 1024 + 3 * 128; v += 128)
+    g.push_back(v);
+  prefetcher.prefetch(&g, 0);
+  prefetcher.synchronize();
+  EXPECT_EQ(prefetcher.get_number_of_resident_chunks(), 4);
+
+  // The resident chunks of the frontier stay, only one chunk can be evicted
+  // and only one of the two missing ones is paged in.
+  frontier_t h;
+  for (int v = 1024; v < 1024 + 3 * 128; v += 128)
+    h.push_back(v);
+  h.push_back(20 * 128);
+  h.push_back(21 * 128);
+  prefetcher.prefetch(&h, 0);
+  prefetcher.synchronize();
+  EXPECT_EQ(prefetcher.get_number_of_resident_chunks(), 4);
+
+  // BFS on the streamed graph.
+  thrust::device_vector<int> distances(n);
+  thrust::device_vector<int> predecessors(n);
+  int source = 0;
+  gunrock::bfs::run(G, source, distances.data().get(),
+                    predecessors.data().get());
+
+  thrust::host_vector<int> h_distances = distances;
+  for (int v = 0; v < n; ++v)
+    EXPECT_EQ(h_distances[v], v);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file dynamic_csr.cuh
+ * @brief Unit test for the dynamic (gapped) CSR format updates.
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/graph/build.hxx>
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+TEST(graph, dynamic_csr) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // A ring, updated with a batch that overflows the slack of vertex 0 (and
+  // repeats an edge) and a batch that deletes a missing edge.
+  int n = 64;
+  format::csr_t<memory_space_t::host, int, int, float> csr;
+  csr.number_of_rows = n;
+  csr.number_of_columns = n;
+  for (int v = 0; v < n; ++v) {
+    csr.row_offsets.push_back(v);
+    csr.column_indices.push_back((v + 1) % n);
+    csr.nonzero_values.push_back(1);
+  }
+  csr.row_offsets.push_back(n);
+  csr.number_of_nonzeros = n;
+
+  format::dynamic_csr_t<memory_space_t::device, int, int, float> dynamic_csr;
+  dynamic_csr.from_csr(csr);
+
+  std::set<std::pair<int, int>> expected;
+  for (int v = 0; v < n; ++v)
+    expected.insert({v, (v + 1) % n});
+
+  thrust::host_vector<int> sources, destinations;
+  for (int i = 2; i < 34; ++i) {
+    sources.push_back(0);
+    destinations.push_back(i);
+  }
+  sources.push_back(0);
+  destinations.push_back(2);
+  sources.push_back(5);
+  destinations.push_back(6);
+
+  format::edge_batch_t<int, float> to_insert(sources.size());
+  to_insert.sources = sources;
+  to_insert.destinations = destinations;
+  thrust::fill(to_insert.values.begin(), to_insert.values.end(), 2.f);
+
+  auto inserted = dynamic_csr.insert_edges(to_insert);
+  EXPECT_EQ(inserted.size(), 32);
+  for (int i = 2; i < 34; ++i)
+    expected.insert({0, i});
+
+  sources.clear();
+  destinations.clear();
+  sources.push_back(0);
+  destinations.push_back(1);
+  sources.push_back(0);
+  destinations.push_back(17);
+  sources.push_back(7);
+  destinations.push_back(9);
+
+  format::edge_batch_t<int, float> to_delete(sources.size());
+  to_delete.sources = sources;
+  to_delete.destinations = destinations;
+
+  auto deleted = dynamic_csr.delete_edges(to_delete);
+  EXPECT_EQ(deleted.size(), 2);
+  thrust::host_vector<float> deleted_values = deleted.values;
+  EXPECT_EQ(deleted_values[0], 1.f);
+  EXPECT_EQ(deleted_values[1], 2.f);
+  expected.erase({0, 1});
+  expected.erase({0, 17});
+
+  EXPECT_EQ(dynamic_csr.number_of_nonzeros, (int)expected.size());
+
+  auto updated = dynamic_csr.to_csr();
+  thrust::host_vector<int> row_offsets = updated.row_offsets;
+  thrust::host_vector<int> column_indices = updated.column_indices;
+
+  std::set<std::pair<int, int>> found;
+  for (int v = 0; v < n; ++v)
+    for (auto e = row_offsets[v]; e < row_offsets[v + 1]; ++e)
+      found.insert({v, column_indices[e]});
+  EXPECT_EQ(found, expected);
+}
@@ -17,6 +17,7 @@
 // #include "formats/coo.cuh"
 // #include "formats/coocsc.cuh"
 #include "formats/coocsccsr.cuh"
+#include "formats/binary_csr.cuh"
 // #include "formats/coocsr.cuh"
 // #include "formats/csc.cuh"
 // #include "formats/csccsr.cuh"
@@ -25,11 +26,24 @@
 // #include "graph/src_vertex.cuh"
 // #include "graph/graph_load.cuh"
 // #include "graph/graph.cuh"
+#include "graph/compressed_csr.cuh"
+#include "graph/dynamic_csr.cuh"
+#include "framework/streaming.cuh"
+#include "framework/service.cuh"
+#include "algorithms/bfs.cuh"
+#include "algorithms/spmv.cuh"
+#include "algorithms/pr.cuh"
+#include "algorithms/incremental/pr.cuh"
+#include "algorithms/spgemm.cuh"
+#include "algorithms/bc.cuh"
+#include "algorithms/kcore.cuh"
+#include "algorithms/color.cuh"
 
 // #include "memory/virtual_memory.cuh"
 // #include "memory/memory.cuh"
 
 // #include "framework/problem.cuh"
+#include "framework/frontier.cuh"
 // #include "framework/operators/for.cuh"
 
 // #include "utils/type_limits.cuh"
@@ -44,4 +58,4 @@
 // #include "io/smtx.cuh"
 // #include "io/mtxbin.cuh"
 
-// #include "algorithms/tc.cuh"
+#include "algorithms/tc.cuh"